@@ -0,0 +1,276 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2025 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+
+/**
+* @defgroup devicesettings
+* @{
+* @defgroup bench
+* @{
+**/
+
+
+/*
+ * Microbenchmarks of the hot paths of the devicesettings client API. The
+ * Host/VideoResolution/AudioOutputPort cases go through whatever IARM and
+ * dsMgr the binary is linked and run with: with the IARM stubs they measure
+ * the client side alone, with the loopback bus and dsMgr in process they
+ * include the server. Results are written as JSON, see dsBench.hpp.
+ *
+ * DS_BENCH_EDID names the EDID used for the parser cases, default
+ * ../test/edid_corpus/hdmi20_tv_4k_hdr.bin.
+ */
+
+#include <fcntl.h>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include "dsBench.hpp"
+#include "dslogger.h"
+#include "edid-parser.hpp"
+#include "host.hpp"
+#include "hostPersistence.hpp"
+#include "manager.hpp"
+#include "audioOutputPort.hpp"
+#include "audioOutputPortType.hpp"
+#include "videoOutputPort.hpp"
+#include "videoResolution.hpp"
+
+using dsbench::State;
+using dsbench::doNotOptimize;
+
+static device::Host &host()
+{
+    static bool initialized = false;
+    if (!initialized) {
+        device::Manager::Initialize();
+        initialized = true;
+    }
+    return device::Host::getInstance();
+}
+
+static void benchGetVideoOutputPortByName(State &state)
+{
+    const std::string name = host().getVideoOutputPorts().at(0).getName();
+    for (size_t i = 0; i < state.iterations; i++) {
+        doNotOptimize(&host().getVideoOutputPort(name));
+    }
+}
+DS_BENCHMARK("Host::getVideoOutputPort(name)", benchGetVideoOutputPortByName);
+
+static std::string resolutionName()
+{
+    const device::List<device::VideoResolution> resolutions = host().getVideoOutputPorts().at(0).getType().getSupportedResolutions();
+    if (0 == resolutions.size()) {
+        throw std::runtime_error("no supported resolution");
+    }
+    /* The last one, so the lookup walks the whole list */
+    return resolutions.at(resolutions.size() - 1).getName();
+}
+
+static void benchVideoResolutionGetInstance(State &state)
+{
+    const std::string name = resolutionName();
+    for (size_t i = 0; i < state.iterations; i++) {
+        doNotOptimize(&device::VideoResolution::getInstance(name));
+    }
+}
+DS_BENCHMARK("VideoResolution::getInstance(name)", benchVideoResolutionGetInstance);
+
+static void benchVideoResolutionGetInstanceIgnoreEdid(State &state)
+{
+    const std::string name = resolutionName();
+    for (size_t i = 0; i < state.iterations; i++) {
+        doNotOptimize(&device::VideoResolution::getInstance(name, true));
+    }
+}
+DS_BENCHMARK("VideoResolution::getInstance(name, ignoreEdid)", benchVideoResolutionGetInstanceIgnoreEdid);
+
+static void benchAudioOutputPortConstruct(State &state)
+{
+    device::AudioOutputPort &port = host().getAudioOutputPorts().at(0);
+    const int type = port.getType().getId();
+    const int index = port.getIndex();
+    const int id = port.getId();
+    for (size_t i = 0; i < state.iterations; i++) {
+        device::AudioOutputPort constructed(type, index, id);
+        doNotOptimize(constructed);
+    }
+}
+DS_BENCHMARK("AudioOutputPort construction", benchAudioOutputPortConstruct);
+
+static void benchListAt(State &state)
+{
+    device::List<device::VideoOutputPort> ports = host().getVideoOutputPorts();
+    const size_t size = ports.size();
+    for (size_t i = 0; i < state.iterations; i++) {
+        doNotOptimize(&ports.at(i % size));
+    }
+}
+DS_BENCHMARK("List<VideoOutputPort>::at", benchListAt);
+
+static const std::vector<unsigned char> &edidBytes()
+{
+    static std::vector<unsigned char> bytes;
+    if (bytes.empty()) {
+        const char *path = getenv("DS_BENCH_EDID");
+        FILE *file = fopen(path ? path : "../test/edid_corpus/hdmi20_tv_4k_hdr.bin", "rb");
+        if (NULL == file) {
+            throw std::runtime_error("cannot read the EDID, set DS_BENCH_EDID");
+        }
+        bytes.resize(1024);
+        bytes.resize(fread(&bytes[0], 1, bytes.size(), file));
+        fclose(file);
+    }
+    return bytes;
+}
+
+static void benchEdidParse(State &state)
+{
+    std::vector<unsigned char> bytes = edidBytes();
+    edid_parser::edid_data_t data;
+    for (size_t i = 0; i < state.iterations; i++) {
+        doNotOptimize(edid_parser::EDID_Parse(&bytes[0], bytes.size(), &data));
+    }
+}
+DS_BENCHMARK("edid_parser::EDID_Parse", benchEdidParse);
+
+/* ds_log writes to stderr, which is sent to /dev/null while measuring */
+class StderrToNull {
+public:
+    StderrToNull() : _saved(dup(STDERR_FILENO))
+    {
+        int devNull = open("/dev/null", O_WRONLY);
+        dup2(devNull, STDERR_FILENO);
+        close(devNull);
+    }
+    ~StderrToNull()
+    {
+        dup2(_saved, STDERR_FILENO);
+        close(_saved);
+    }
+private:
+    int _saved;
+};
+
+static void benchLogDisabled(State &state)
+{
+    StderrToNull quiet;
+    for (size_t i = 0; i < state.iterations; i++) {
+        INT_INFO("suppressed message %zu", i);
+    }
+}
+DS_BENCHMARK("ds_log disabled", benchLogDisabled);
+
+static void benchLogEnabled(State &state)
+{
+    StderrToNull quiet;
+    DS_SetLogLevel(INFO_LEVEL);
+    DS_SetLogAsync(0);
+    for (size_t i = 0; i < state.iterations; i++) {
+        INT_INFO("emitted message %zu", i);
+    }
+    DS_SetLogLevel(ERROR_LEVEL);
+}
+DS_BENCHMARK("ds_log enabled", benchLogEnabled);
+
+/* Includes the flush and the writes done by the caller whenever its ring is full */
+static void benchLogEnabledAsync(State &state)
+{
+    StderrToNull quiet;
+    DS_SetLogLevel(INFO_LEVEL);
+    DS_SetLogAsync(1);
+    for (size_t i = 0; i < state.iterations; i++) {
+        INT_INFO("emitted message %zu", i);
+    }
+    DS_LogFlush();
+    DS_SetLogAsync(0);
+    DS_SetLogLevel(ERROR_LEVEL);
+}
+DS_BENCHMARK("ds_log enabled (async)", benchLogEnabledAsync);
+
+static std::string persistencePath;
+
+static device::HostPersistence &persistence()
+{
+    static device::HostPersistence *store = NULL;
+    if (NULL == store) {
+        char path[] = "/tmp/dsBenchHostDataXXXXXX";
+        int fd = mkstemp(path);
+        if (fd >= 0) {
+            close(fd);
+        }
+        persistencePath = path;
+        store = new device::HostPersistence(path);
+        store->load();
+        store->persistHostProperty("HDMI0.resolution", "1080p60");
+    }
+    return *store;
+}
+
+static void benchPersistenceGet(State &state)
+{
+    device::HostPersistence &store = persistence();
+    const std::string key = "HDMI0.resolution";
+    for (size_t i = 0; i < state.iterations; i++) {
+        doNotOptimize(store.getProperty(key));
+    }
+}
+DS_BENCHMARK("HostPersistence::getProperty", benchPersistenceGet);
+
+static void benchPersistencePutUnchanged(State &state)
+{
+    device::HostPersistence &store = persistence();
+    const std::string key = "HDMI0.resolution";
+    const std::string value = store.getProperty(key);
+    for (size_t i = 0; i < state.iterations; i++) {
+        store.persistHostProperty(key, value);
+    }
+}
+DS_BENCHMARK("HostPersistence::persistHostProperty (unchanged)", benchPersistencePutUnchanged);
+
+static void benchPersistencePutChanged(State &state)
+{
+    device::HostPersistence &store = persistence();
+    const std::string key = "HDMI0.resolution";
+    const std::string values[2] = { "720p", "1080p60" };
+    for (size_t i = 0; i < state.iterations; i++) {
+        store.persistHostProperty(key, values[i & 1]);
+    }
+}
+DS_BENCHMARK("HostPersistence::persistHostProperty (changed)", benchPersistencePutChanged);
+
+int main(int argc, char *argv[])
+{
+    DS_SetLogLevel(ERROR_LEVEL);
+    int ret = dsbench::main("devicesettings-client", argc, argv);
+
+    /* HostPersistence also leaves its secondary file next to the store */
+    if (!persistencePath.empty()) {
+        unlink(persistencePath.c_str());
+        unlink((persistencePath + "tmpDB").c_str());
+    }
+    return ret;
+}
+
+
+/** @} */
+/** @} */
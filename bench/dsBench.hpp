@@ -0,0 +1,280 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2025 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+
+/**
+* @defgroup devicesettings
+* @{
+* @defgroup bench
+* @{
+**/
+
+
+/**
+ * @file dsBench.hpp
+ * @brief Minimal microbenchmark harness of the bench/ suite.
+ *
+ * A benchmark is a function registered with DS_BENCHMARK() that runs its
+ * operation state.iterations times. The harness grows the iteration count
+ * until one run lasts at least the minimum time, repeats the run and
+ * reports the median and fastest time per operation, as a table on stderr
+ * and as JSON on stdout (or in the --json file):
+ *
+ *   { "suite": "...", "timestamp": ..., "results": [
+ *     { "name": "...", "iterations": n, "repetitions": r,
+ *       "ns_per_op": median, "min_ns_per_op": fastest, "ops_per_sec": ... }
+ *   ] }
+ *
+ * A benchmark that throws is reported with "error" instead of timings. What
+ * the code under test prints on stdout is discarded so the JSON stays valid.
+ */
+
+#ifndef _DS_BENCH_HPP_
+#define _DS_BENCH_HPP_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <string>
+#include <vector>
+
+namespace dsbench {
+
+struct State {
+    size_t iterations;
+};
+
+typedef void (*BenchFunction)(State &state);
+
+struct Benchmark {
+    const char *name;
+    BenchFunction function;
+};
+
+inline std::vector<Benchmark> &registry()
+{
+    static std::vector<Benchmark> benchmarks;
+    return benchmarks;
+}
+
+struct Registrar {
+    Registrar(const char *name, BenchFunction function)
+    {
+        Benchmark benchmark = { name, function };
+        registry().push_back(benchmark);
+    }
+};
+
+/** @brief Keep the compiler from optimizing value, or the computation of it, away. */
+template <typename T>
+inline void doNotOptimize(const T &value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+struct Options {
+    double minTimeSec;
+    int repetitions;
+    std::string filter;
+    std::string jsonPath;
+};
+
+struct Result {
+    std::string name;
+    size_t iterations;
+    double nsPerOp;
+    double minNsPerOp;
+    std::string error;
+};
+
+inline double runOnce(BenchFunction function, size_t iterations)
+{
+    State state = { iterations };
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    function(state);
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+inline Result measure(const Benchmark &benchmark, const Options &options)
+{
+    Result result;
+    result.name = benchmark.name;
+    result.iterations = 1;
+    result.nsPerOp = result.minNsPerOp = 0;
+
+    try {
+        double elapsed = runOnce(benchmark.function, result.iterations);
+        while ((elapsed < options.minTimeSec) && (result.iterations < ((size_t)1 << 40))) {
+            /* Aim 20% past the minimum time, at most 100x per step */
+            double scale = (elapsed > 0) ? std::min(100.0, 1.2 * options.minTimeSec / elapsed) : 100.0;
+            result.iterations = std::max(result.iterations + 1, (size_t)(result.iterations * scale));
+            elapsed = runOnce(benchmark.function, result.iterations);
+        }
+
+        std::vector<double> nsPerOp;
+        for (int i = 0; i < options.repetitions; i++) {
+            nsPerOp.push_back(runOnce(benchmark.function, result.iterations) * 1e9 / result.iterations);
+        }
+        std::sort(nsPerOp.begin(), nsPerOp.end());
+        result.nsPerOp = nsPerOp[nsPerOp.size() / 2];
+        result.minNsPerOp = nsPerOp[0];
+    }
+    catch (const std::exception &e) {
+        result.error = e.what();
+    }
+    catch (...) {
+        result.error = "exception";
+    }
+    return result;
+}
+
+inline std::string jsonEscape(const std::string &text)
+{
+    std::string escaped;
+    for (size_t i = 0; i < text.size(); i++) {
+        char c = text[i];
+        if (('"' == c) || ('\\' == c)) {
+            escaped += '\\';
+            escaped += c;
+        } else if ((unsigned char)c < 0x20) {
+            char code[8];
+            snprintf(code, sizeof(code), "\\u%04x", c);
+            escaped += code;
+        } else {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+inline void writeJson(FILE *out, const char *suite, const Options &options, const std::vector<Result> &results)
+{
+    fprintf(out, "{\n  \"suite\": \"%s\",\n  \"timestamp\": %ld,\n", jsonEscape(suite).c_str(), (long)time(NULL));
+    fprintf(out, "  \"min_time_sec\": %g,\n  \"repetitions\": %d,\n  \"results\": [", options.minTimeSec,
+            options.repetitions);
+    for (size_t i = 0; i < results.size(); i++) {
+        const Result &result = results[i];
+        fprintf(out, "%s\n    { \"name\": \"%s\", ", i ? "," : "", jsonEscape(result.name).c_str());
+        if (!result.error.empty()) {
+            fprintf(out, "\"error\": \"%s\" }", jsonEscape(result.error).c_str());
+            continue;
+        }
+        fprintf(out, "\"iterations\": %zu, \"repetitions\": %d, \"ns_per_op\": %.2f, \"min_ns_per_op\": %.2f, "
+                "\"ops_per_sec\": %.0f }", result.iterations, options.repetitions, result.nsPerOp,
+                result.minNsPerOp, (result.nsPerOp > 0) ? 1e9 / result.nsPerOp : 0.0);
+    }
+    fprintf(out, "\n  ]\n}\n");
+}
+
+inline void usage(const char *program)
+{
+    fprintf(stderr, "Usage: %s [--filter substring] [--min-time seconds] [--repetitions n] [--json file] [--list]\n",
+            program);
+}
+
+/** @brief Parse the command line, run the registered benchmarks and report them; returns the exit code. */
+inline int main(const char *suite, int argc, char *argv[])
+{
+    Options options;
+    options.minTimeSec = 0.2;
+    options.repetitions = 5;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+        if (("--filter" == arg) && hasValue) {
+            options.filter = argv[++i];
+        } else if (("--min-time" == arg) && hasValue) {
+            options.minTimeSec = atof(argv[++i]);
+        } else if (("--repetitions" == arg) && hasValue) {
+            options.repetitions = std::max(1, atoi(argv[++i]));
+        } else if (("--json" == arg) && hasValue) {
+            options.jsonPath = argv[++i];
+        } else if ("--list" == arg) {
+            for (size_t b = 0; b < registry().size(); b++) {
+                printf("%s\n", registry()[b].name);
+            }
+            return 0;
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    std::vector<Result> results;
+    fflush(stdout);
+    int savedStdout = dup(STDOUT_FILENO);
+    int devNull = open("/dev/null", O_WRONLY);
+    dup2(devNull, STDOUT_FILENO);
+    close(devNull);
+
+    fprintf(stderr, "%-48s %14s %12s %12s\n", "benchmark", "iterations", "ns/op", "min ns/op");
+    for (size_t b = 0; b < registry().size(); b++) {
+        const Benchmark &benchmark = registry()[b];
+        if (!options.filter.empty() && (NULL == strstr(benchmark.name, options.filter.c_str()))) {
+            continue;
+        }
+        Result result = measure(benchmark, options);
+        if (result.error.empty()) {
+            fprintf(stderr, "%-48s %14zu %12.1f %12.1f\n", result.name.c_str(), result.iterations, result.nsPerOp,
+                    result.minNsPerOp);
+        } else {
+            fprintf(stderr, "%-48s failed: %s\n", result.name.c_str(), result.error.c_str());
+        }
+        results.push_back(result);
+    }
+    fflush(stdout);
+    dup2(savedStdout, STDOUT_FILENO);
+    close(savedStdout);
+
+    FILE *out = stdout;
+    if (!options.jsonPath.empty()) {
+        out = fopen(options.jsonPath.c_str(), "w");
+        if (NULL == out) {
+            fprintf(stderr, "cannot write %s\n", options.jsonPath.c_str());
+            return 1;
+        }
+    }
+    writeJson(out, suite, options, results);
+    if (out != stdout) {
+        fclose(out);
+    }
+    return 0;
+}
+
+}
+
+#define DS_BENCH_CONCAT2(a, b) a##b
+#define DS_BENCH_CONCAT(a, b) DS_BENCH_CONCAT2(a, b)
+
+/** @brief Register function as benchmark name. */
+#define DS_BENCHMARK(name, function) \
+    static dsbench::Registrar DS_BENCH_CONCAT(dsBenchRegistrar, __LINE__)(name, function)
+
+#endif /* _DS_BENCH_HPP_ */
+
+
+/** @} */
+/** @} */
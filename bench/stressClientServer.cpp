@@ -0,0 +1,466 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2025 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+
+/**
+* @defgroup devicesettings
+* @{
+* @defgroup bench
+* @{
+**/
+
+
+/*
+ * Multithreaded stress of the client library and the dsMgr handlers.
+ *
+ * dsMgr runs in this process on the loopback IARM bus
+ * (stubs/iarm_loopback.cpp) over the simulated HAL (stubs/dshal_sim.cpp),
+ * and N threads call the client API with a weighted mix of operations, as
+ * several plugins do in production. At the end the ops/sec and the
+ * p50/p99/p999/max latency of each operation are printed, and written as
+ * JSON with --json. A watchdog reports any call that takes longer than
+ * --watchdog-ms and, as that is most likely a deadlock, aborts the run
+ * with exit code 2 after twice that time.
+ *
+ * Usage: stressClientServer [--threads n] [--duration sec] [--seed n]
+ *            [--mix op=weight,...] [--watchdog-ms ms] [--json file]
+ *
+ * Give the simulated HAL slow or failing calls with DSHAL_SIM_CONFIG, and
+ * the bus a per-call latency with IARM_LOOPBACK_CALL_LATENCY_US.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "dsBench.hpp"
+#include "dslogger.h"
+#include "dsMgr.h"
+#include "libIBus.h"
+#include "host.hpp"
+#include "manager.hpp"
+#include "audioOutputPort.hpp"
+#include "videoOutputPort.hpp"
+#include "videoResolution.hpp"
+
+using dsbench::doNotOptimize;
+
+namespace {
+
+/* Log-linear latency histogram: 16 buckets per power of two of ns, ~6% resolution */
+class Histogram {
+public:
+    enum { kSubBuckets = 16, kBuckets = 61 * kSubBuckets };
+
+    Histogram() : _count(0), _max(0) { memset(_buckets, 0, sizeof(_buckets)); }
+
+    void record(uint64_t ns)
+    {
+        _buckets[index(ns)]++;
+        _count++;
+        if (ns > _max) {
+            _max = ns;
+        }
+    }
+
+    void merge(const Histogram &other)
+    {
+        for (int i = 0; i < kBuckets; i++) {
+            _buckets[i] += other._buckets[i];
+        }
+        _count += other._count;
+        if (other._max > _max) {
+            _max = other._max;
+        }
+    }
+
+    /* Upper bound of the bucket holding quantile q */
+    uint64_t percentile(double q) const
+    {
+        if (0 == _count) {
+            return 0;
+        }
+        uint64_t rank = (uint64_t)(q * (_count - 1)) + 1;
+        uint64_t seen = 0;
+        for (int i = 0; i < kBuckets; i++) {
+            seen += _buckets[i];
+            if (seen >= rank) {
+                return std::min(upperBound(i), _max);
+            }
+        }
+        return _max;
+    }
+
+    uint64_t count() const { return _count; }
+    uint64_t max() const { return _max; }
+
+private:
+    static int index(uint64_t ns)
+    {
+        if (ns < kSubBuckets) {
+            return (int)ns;
+        }
+        int exponent = 63 - __builtin_clzll(ns);
+        int sub = (int)((ns >> (exponent - 4)) & (kSubBuckets - 1));
+        return std::min((exponent - 3) * kSubBuckets + sub, (int)kBuckets - 1);
+    }
+
+    static uint64_t upperBound(int index)
+    {
+        if (index < kSubBuckets) {
+            return (uint64_t)index;
+        }
+        int exponent = index / kSubBuckets + 3;
+        uint64_t sub = index % kSubBuckets;
+        return ((kSubBuckets + sub + 1) << (exponent - 4)) - 1;
+    }
+
+    uint64_t _buckets[kBuckets];
+    uint64_t _count;
+    uint64_t _max;
+};
+
+typedef void (*OpFunction)(std::mt19937 &rng);
+
+struct Op {
+    const char *name;
+    OpFunction function;
+    unsigned int weight;
+};
+
+device::AudioOutputPort &audioPort()
+{
+    return device::Host::getInstance().getAudioOutputPorts().at(0);
+}
+
+device::VideoOutputPort &videoPort()
+{
+    return device::Host::getInstance().getVideoOutputPorts().at(0);
+}
+
+void opSetLevel(std::mt19937 &rng)
+{
+    audioPort().setLevel((float)(rng() % 101));
+}
+
+void opGetLevel(std::mt19937 &rng)
+{
+    doNotOptimize(audioPort().getLevel());
+}
+
+void opSetMuted(std::mt19937 &rng)
+{
+    audioPort().setMuted(0 != (rng() & 1));
+}
+
+void opIsMuted(std::mt19937 &rng)
+{
+    doNotOptimize(audioPort().isMuted());
+}
+
+void opGetResolution(std::mt19937 &rng)
+{
+    doNotOptimize(&videoPort().getResolution());
+}
+
+void opIsDisplayConnected(std::mt19937 &rng)
+{
+    doNotOptimize(videoPort().isDisplayConnected());
+}
+
+void opGetEDIDBytes(std::mt19937 &rng)
+{
+    std::vector<uint8_t> edid;
+    videoPort().getDisplay().getEDIDBytes(edid);
+    doNotOptimize(edid.size());
+}
+
+Op ops[] = {
+    { "setLevel", opSetLevel, 2 },
+    { "getLevel", opGetLevel, 4 },
+    { "setMuted", opSetMuted, 1 },
+    { "isMuted", opIsMuted, 4 },
+    { "getResolution", opGetResolution, 6 },
+    { "isDisplayConnected", opIsDisplayConnected, 8 },
+    { "getEDIDBytes", opGetEDIDBytes, 1 },
+};
+
+const int kOps = sizeof(ops) / sizeof(ops[0]);
+
+struct ThreadStats {
+    Histogram latency[kOps];
+    uint64_t errors[kOps];
+    std::atomic<uint64_t> opStartNs;        /* 0 while between calls */
+    std::atomic<int> currentOp;
+
+    ThreadStats() : opStartNs(0), currentOp(-1) { memset(errors, 0, sizeof(errors)); }
+};
+
+struct Options {
+    int threads;
+    double durationSec;
+    unsigned int seed;
+    unsigned int watchdogMs;
+    std::string jsonPath;
+};
+
+std::atomic<bool> running(true);
+std::atomic<bool> workersJoined(false);
+
+uint64_t nowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void worker(ThreadStats *stats, unsigned int seed, const std::vector<int> *schedule)
+{
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<size_t> pick(0, schedule->size() - 1);
+
+    while (running.load(std::memory_order_relaxed)) {
+        int op = (*schedule)[pick(rng)];
+        uint64_t start = nowNs();
+        stats->currentOp.store(op, std::memory_order_relaxed);
+        stats->opStartNs.store(start, std::memory_order_release);
+        try {
+            ops[op].function(rng);
+        }
+        catch (...) {
+            stats->errors[op]++;
+        }
+        uint64_t end = nowNs();
+        stats->opStartNs.store(0, std::memory_order_release);
+        stats->latency[op].record(end - start);
+    }
+}
+
+/* Returns false when a call stalled. Keeps watching until every worker has
+ * joined, as a call that never returns would otherwise hang the join. */
+bool watchdog(std::vector<ThreadStats *> &stats, unsigned int timeoutMs)
+{
+    bool stalled = false;
+    const uint64_t timeoutNs = (uint64_t)timeoutMs * 1000000;
+
+    while (!workersJoined.load()) {
+        usleep(std::min(100u, timeoutMs / 4 + 1) * 1000);
+        uint64_t now = nowNs();
+        for (size_t t = 0; t < stats.size(); t++) {
+            uint64_t start = stats[t]->opStartNs.load(std::memory_order_acquire);
+            if (!start || (now - start < timeoutNs)) {
+                continue;
+            }
+            int op = stats[t]->currentOp.load();
+            fprintf(stderr, "WATCHDOG: thread %zu stuck in %s for %llu ms\n", t, (op >= 0) ? ops[op].name : "?",
+                    (unsigned long long)((now - start) / 1000000));
+            stalled = true;
+            if (now - start >= 2 * timeoutNs) {
+                fprintf(stderr, "WATCHDOG: giving up, probable deadlock\n");
+                fflush(stderr);
+                _exit(2);
+            }
+        }
+    }
+    return !stalled;
+}
+
+bool parseMix(const char *mix)
+{
+    for (int i = 0; i < kOps; i++) {
+        ops[i].weight = 0;
+    }
+    std::string text = mix;
+    size_t pos = 0;
+    while (pos < text.size()) {
+        size_t end = text.find(',', pos);
+        std::string item = text.substr(pos, (std::string::npos == end) ? std::string::npos : end - pos);
+        size_t eq = item.find('=');
+        bool found = false;
+        for (int i = 0; (i < kOps) && (std::string::npos != eq); i++) {
+            if (item.compare(0, eq, ops[i].name) == 0 && (strlen(ops[i].name) == eq)) {
+                ops[i].weight = (unsigned int)atoi(item.c_str() + eq + 1);
+                found = true;
+            }
+        }
+        if (!found) {
+            fprintf(stderr, "unknown op in mix: '%s'\n", item.c_str());
+            return false;
+        }
+        pos = (std::string::npos == end) ? text.size() : end + 1;
+    }
+    return true;
+}
+
+void usage(const char *program)
+{
+    fprintf(stderr, "Usage: %s [--threads n] [--duration sec] [--seed n] [--mix op=weight,...] "
+            "[--watchdog-ms ms] [--json file]\nops:", program);
+    for (int i = 0; i < kOps; i++) {
+        fprintf(stderr, " %s=%u", ops[i].name, ops[i].weight);
+    }
+    fprintf(stderr, "\n");
+}
+
+void report(FILE *out, const Options &options, double elapsedSec, const Histogram *latency,
+            const uint64_t *errors, bool json)
+{
+    uint64_t total = 0;
+    for (int i = 0; i < kOps; i++) {
+        total += latency[i].count();
+    }
+    if (!json) {
+        fprintf(out, "%d threads, %.1f s, %llu ops, %.0f ops/s\n", options.threads, elapsedSec,
+                (unsigned long long)total, total / elapsedSec);
+        fprintf(out, "%-20s %10s %8s %12s %10s %10s %10s %10s\n", "op", "count", "errors", "ops/s", "p50 us",
+                "p99 us", "p999 us", "max us");
+        for (int i = 0; i < kOps; i++) {
+            const Histogram &h = latency[i];
+            fprintf(out, "%-20s %10llu %8llu %12.0f %10.1f %10.1f %10.1f %10.1f\n", ops[i].name,
+                    (unsigned long long)h.count(), (unsigned long long)errors[i], h.count() / elapsedSec,
+                    h.percentile(0.50) / 1e3, h.percentile(0.99) / 1e3, h.percentile(0.999) / 1e3, h.max() / 1e3);
+        }
+        return;
+    }
+    fprintf(out, "{\n  \"suite\": \"devicesettings-stress\",\n  \"timestamp\": %ld,\n  \"threads\": %d,\n"
+            "  \"duration_sec\": %.3f,\n  \"seed\": %u,\n  \"ops_per_sec\": %.0f,\n  \"results\": [",
+            (long)time(NULL), options.threads, elapsedSec, options.seed, total / elapsedSec);
+    for (int i = 0; i < kOps; i++) {
+        const Histogram &h = latency[i];
+        fprintf(out, "%s\n    { \"name\": \"%s\", \"weight\": %u, \"count\": %llu, \"errors\": %llu, "
+                "\"ops_per_sec\": %.0f, \"p50_ns\": %llu, \"p99_ns\": %llu, \"p999_ns\": %llu, \"max_ns\": %llu }",
+                i ? "," : "", dsbench::jsonEscape(ops[i].name).c_str(), ops[i].weight,
+                (unsigned long long)h.count(), (unsigned long long)errors[i], h.count() / elapsedSec,
+                (unsigned long long)h.percentile(0.50), (unsigned long long)h.percentile(0.99),
+                (unsigned long long)h.percentile(0.999), (unsigned long long)h.max());
+    }
+    fprintf(out, "\n  ]\n}\n");
+}
+
+}
+
+int main(int argc, char *argv[])
+{
+    Options options;
+    options.threads = 8;
+    options.durationSec = 10;
+    options.seed = 1;
+    options.watchdogMs = 2000;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+        if (("--threads" == arg) && hasValue) {
+            options.threads = std::max(1, atoi(argv[++i]));
+        } else if (("--duration" == arg) && hasValue) {
+            options.durationSec = atof(argv[++i]);
+        } else if (("--seed" == arg) && hasValue) {
+            options.seed = (unsigned int)strtoul(argv[++i], NULL, 0);
+        } else if (("--mix" == arg) && hasValue) {
+            if (!parseMix(argv[++i])) {
+                usage(argv[0]);
+                return 1;
+            }
+        } else if (("--watchdog-ms" == arg) && hasValue) {
+            options.watchdogMs = std::max(1, atoi(argv[++i]));
+        } else if (("--json" == arg) && hasValue) {
+            options.jsonPath = argv[++i];
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    std::vector<int> schedule;
+    for (int i = 0; i < kOps; i++) {
+        schedule.insert(schedule.end(), ops[i].weight, i);
+    }
+    if (schedule.empty()) {
+        fprintf(stderr, "the op mix is empty\n");
+        return 1;
+    }
+
+    DS_SetLogLevel(ERROR_LEVEL);
+    IARM_Bus_Init("dsStress");
+    IARM_Bus_Connect();
+    if (IARM_RESULT_SUCCESS != dsMgr_init()) {
+        fprintf(stderr, "dsMgr_init failed\n");
+        return 1;
+    }
+    device::Manager::Initialize();
+
+    std::vector<ThreadStats *> stats;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < options.threads; t++) {
+        stats.push_back(new ThreadStats());
+    }
+    uint64_t start = nowNs();
+    for (int t = 0; t < options.threads; t++) {
+        threads.push_back(std::thread(worker, stats[t], options.seed + t, &schedule));
+    }
+    bool healthy = true;
+    std::thread guard([&stats, &options, &healthy] {
+        healthy = watchdog(stats, options.watchdogMs);
+    });
+    usleep((useconds_t)(options.durationSec * 1e6));
+    running = false;
+    for (size_t t = 0; t < threads.size(); t++) {
+        threads[t].join();
+    }
+    workersJoined = true;
+    guard.join();
+    double elapsedSec = (nowNs() - start) / 1e9;
+
+    Histogram latency[kOps];
+    uint64_t errors[kOps] = { 0 };
+    for (size_t t = 0; t < stats.size(); t++) {
+        for (int i = 0; i < kOps; i++) {
+            latency[i].merge(stats[t]->latency[i]);
+            errors[i] += stats[t]->errors[i];
+        }
+        delete stats[t];
+    }
+
+    report(stderr, options, elapsedSec, latency, errors, false);
+    if (!options.jsonPath.empty()) {
+        FILE *out = fopen(options.jsonPath.c_str(), "w");
+        if (out) {
+            report(out, options, elapsedSec, latency, errors, true);
+            fclose(out);
+        } else {
+            fprintf(stderr, "cannot write %s\n", options.jsonPath.c_str());
+        }
+    }
+
+    device::Manager::DeInitialize();
+    dsMgr_term();
+    IARM_Bus_Disconnect();
+    IARM_Bus_Term();
+    return healthy ? 0 : 2;
+}
+
+
+/** @} */
+/** @} */
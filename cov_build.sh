@@ -34,10 +34,12 @@ echo "Building Devicesttings stubs"
 cd $WORKDIR
 cd ./stubs
 g++ -fPIC -shared -o libIARMBus.so iarm_stubs.cpp -I$WORKDIR/stubs -I/usr/include/glib-2.0 -I/usr/lib/x86_64-linux-gnu/glib-2.0/include -I$IARMBUS_PATH/core -I$IARMBUS_PATH/core/include -fpermissive
+g++ -fPIC -shared -o libIARMBusLoopback.so iarm_loopback.cpp -I$WORKDIR/stubs -I/usr/include/glib-2.0 -I/usr/lib/x86_64-linux-gnu/glib-2.0/include -I$IARMBUS_PATH/core -I$IARMBUS_PATH/core/include -fpermissive -lpthread
 g++ -fPIC -shared -o libWPEFrameworkPowerController.so powerctrl_stubs.cpp  -I$WORKDIR/stubs -I${POWER_IF_PATH}/include -fpermissive
 g++ -fPIC -shared -o libtelemetry_msgsender.so ${TEST_FRAMEWORK_PATH}/Tests/mocks/MockProxy/TelemetryProxy.cpp -I${TEST_FRAMEWORK_PATH}/Tests/mocks -fpermissive
 
 gcc -fPIC -shared -o libdshal.so dshal_stubs.c -I${DS_IF_PATH}/include -I$WORKDIR/mfr/include
+g++ -std=c++11 -fPIC -shared -o libdshalsim.so dshal_sim.cpp -I${DS_IF_PATH}/include -lpthread
 #g++ -fPIC -shared -o libdshalsrv.so dshalsrv_stubs.c -I${DS_IF_PATH}/include -I${DS_PATH}/rpc/include
 #g++ -fPIC -shared -o libds.so ds_stubs.cpp -I${DS_IF_PATH}/include/ -I${DS_PATH}/ds/include -I${DS_PATH}/rpc/include
 
@@ -1734,6 +1734,32 @@ void AudioOutputPort::setLevel(const float newLevel)
 
 }
 
+/**
+ * @fn void AudioOutputPort::rampLevel(const float newLevel, const unsigned int durationMs, const RampCurve curve)
+ * @brief This API is used to move the audio level of a given audio port to newLevel over durationMs.
+ *
+ * The ramp is run by dsMgr and this call returns when it starts. A later setLevel(), rampLevel()
+ * or setAudioDucking() takes over from it. Only newLevel is persisted and broadcast.
+ *
+ * @param[in] newLevel New Audio level for a given audio output port
+ * @param[in] durationMs Length of the ramp in milliseconds, up to 30 seconds
+ * @param[in] curve Shape of the ramp
+ *
+ * @return None
+ */
+void AudioOutputPort::rampLevel(const float newLevel, const unsigned int durationMs, const RampCurve curve)
+{
+	dsError_t ret = dsERR_NONE;
+
+	if ((newLevel < 0) || (curve < kRampLinear) || (curve > kRampExponential)) {
+		ret = dsERR_INVALID_PARAM;
+	} else if ( (ret = dsAudioRampLevel(_handle, newLevel, durationMs, (dsAudioRampCurve_t)curve)) == dsERR_NONE) {
+		_level = newLevel;
+	}
+
+	if (ret != dsERR_NONE) throw Exception(ret);
+}
+
 /**
  * @fn void AudioOutputPort::setAudioDucking(dsAudioDuckingAction_t action, dsAudioDuckingType_t type, const unsigned char  level)
  * @brief This API is used to set the audio level to be used in a given audio port. If output mode is Passthrough/Expert this mutes the audio
@@ -1763,6 +1789,36 @@ void AudioOutputPort::setAudioDucking(dsAudioDuckingAction_t action, dsAudioDuck
 }
 
 
+/**
+ * @fn void AudioOutputPort::setAudioDucking(unsigned int source, int priority, dsAudioDuckingAction_t action, dsAudioDuckingType_t type, const unsigned char level)
+ * @brief This API is used to start or stop the ducking of one source on a given audio port.
+ *
+ * Sources duck independently: the active request of highest priority decides the level, and
+ * stopping it restores the level of the next one, or the volume when none is left.
+ *
+ * @param[in] source Id of the ducking source, not DS_AUDIO_DUCKING_SOURCE_DEFAULT (0), which is reserved
+ * @param[in] priority Priority of the request, higher takes over
+ * @param[in] action action type to start or stop ducking
+ * @param[in] type  ducking type is absolute or relative to current volume level.
+ * @param[in] level Audio level for the request range [0 - 100]
+ *
+ * @return None
+ */
+void AudioOutputPort::setAudioDucking(unsigned int source, int priority, dsAudioDuckingAction_t action, dsAudioDuckingType_t type, const unsigned char level)
+{
+    dsError_t ret = dsERR_NONE;
+
+    if (level > 100) {
+        ret = dsERR_INVALID_PARAM;
+    }
+    else {
+        ret = dsSetAudioDuckingSource(_handle, source, priority, action, type, level);
+    }
+
+    if (ret != dsERR_NONE) throw Exception(ret);
+}
+
+
 /**
  * @fn void AudioOutputPort::setLoopThru(const bool loopThru)
  * @brief This API is used to set the audio port to do loop thro.
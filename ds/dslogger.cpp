@@ -25,11 +25,19 @@
 * @{
 **/
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdio>
 #include <cstdarg>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <thread>
 
 #include "dslogger.h"
 
+#include <strings.h>
 #include <sys/syscall.h>   // for SYS_gettid
 #include <unistd.h>        // for syscall
 
@@ -37,26 +45,331 @@
 #define MAX_LOG_BUFF 1024
 #define kFormatMessageSize (MAX_LOG_BUFF - 128)
 
+#define LEVEL_BIT(level) (1u << (level))
+
+// Levels enabled at each threshold, index is the LogLevel of the threshold
+static const unsigned int kThresholdMasks[] = {
+    /* INFO_LEVEL  */ LEVEL_BIT(ERROR_LEVEL) | LEVEL_BIT(WARN_LEVEL) | LEVEL_BIT(INFO_LEVEL),
+    /* WARN_LEVEL  */ LEVEL_BIT(ERROR_LEVEL) | LEVEL_BIT(WARN_LEVEL),
+    /* ERROR_LEVEL */ LEVEL_BIT(ERROR_LEVEL),
+    /* DEBUG_LEVEL */ LEVEL_BIT(ERROR_LEVEL) | LEVEL_BIT(WARN_LEVEL) | LEVEL_BIT(INFO_LEVEL) | LEVEL_BIT(DEBUG_LEVEL),
+    /* TRACE_LEVEL */ LEVEL_BIT(ERROR_LEVEL) | LEVEL_BIT(WARN_LEVEL) | LEVEL_BIT(INFO_LEVEL) | LEVEL_BIT(DEBUG_LEVEL) | LEVEL_BIT(TRACE_LEVEL),
+};
+
+// Builds that compile in INT_DEBUG/INT_TRACE also show them by default
+#if DS_LOG_LEVEL >= TRACE_LEVEL
+#define DS_LOG_DEFAULT_THRESHOLD TRACE_LEVEL
+#elif DS_LOG_LEVEL >= DEBUG_LEVEL
+#define DS_LOG_DEFAULT_THRESHOLD DEBUG_LEVEL
+#else
+#define DS_LOG_DEFAULT_THRESHOLD INFO_LEVEL
+#endif
+
+std::atomic<unsigned int> dsLogLevelMask(kThresholdMasks[DS_LOG_DEFAULT_THRESHOLD]);
+
 DS_LogCb logCb = NULL;
 
+namespace {
+
+const char *levelMap[] = { "INFO", "WARN", "ERROR", "DEBUG", "TRACE"};
+
+// Per-thread single producer / single consumer ring of preformatted lines.
+// Rings are never freed: when a thread exits its ring is marked orphaned and
+// handed to the next thread that starts logging once it has been drained.
+const unsigned int kRingSlots = 64;
+const unsigned int kMaxRings  = 64;
+
+struct LogSlot {
+    unsigned int length;
+    char text[MAX_LOG_BUFF];
+};
+
+struct LogRing {
+    std::atomic<unsigned int> head;      // next slot to fill, written by the producer
+    std::atomic<unsigned int> tail;      // next slot to write out, written by the consumer
+    std::atomic<bool> orphaned;          // owning thread has exited
+    std::atomic_flag draining;           // held by whoever is consuming the ring
+    LogSlot slots[kRingSlots];
+};
+
+std::atomic<LogRing*> s_rings[kMaxRings];
+std::atomic<bool> s_async(false);
+std::atomic<bool> s_writerIdle(false);
+std::once_flag s_writerOnce;
+
+// The writer thread outlives static destruction, so what it waits on is never destroyed
+std::mutex &s_writerMutex = *new std::mutex;
+std::condition_variable &s_writerCond = *new std::condition_variable;
+
+struct ThreadRing {
+    LogRing *ring = nullptr;
+    bool unavailable = false;
+
+    ~ThreadRing()
+    {
+        if (ring) {
+            ring->orphaned.store(true, std::memory_order_release);
+        }
+    }
+};
+
+thread_local ThreadRing t_ring;
+
+LogRing *acquireRing()
+{
+    for (unsigned int i = 0; i < kMaxRings; i++) {
+        LogRing *ring = s_rings[i].load(std::memory_order_acquire);
+        if (ring && ring->orphaned.load(std::memory_order_acquire) &&
+            ring->head.load(std::memory_order_acquire) == ring->tail.load(std::memory_order_acquire)) {
+            bool expected = true;
+            if (ring->orphaned.compare_exchange_strong(expected, false)) {
+                return ring;
+            }
+        }
+    }
+
+    LogRing *ring = new LogRing();
+    ring->head.store(0);
+    ring->tail.store(0);
+    ring->orphaned.store(false);
+    ring->draining.clear();
+
+    for (unsigned int i = 0; i < kMaxRings; i++) {
+        LogRing *expected = nullptr;
+        if (s_rings[i].compare_exchange_strong(expected, ring)) {
+            return ring;
+        }
+    }
+    delete ring;
+    return nullptr;
+}
+
+// Only uses write(2) and lock-free atomics, safe from a signal handler
+bool writeAll(const char *buf, size_t length)
+{
+    while (length > 0) {
+        ssize_t n = write(STDERR_FILENO, buf, length);
+        if (n <= 0) {
+            return false;
+        }
+        buf += n;
+        length -= n;
+    }
+    return true;
+}
+
+// Writes out everything queued in ring, batching lines into buf. Returns the number of lines written.
+unsigned int drainRing(LogRing *ring, char *buf, size_t bufSize)
+{
+    if (ring->draining.test_and_set(std::memory_order_acquire)) {
+        return 0;
+    }
+
+    unsigned int lines = 0;
+    size_t used = 0;
+    unsigned int tail = ring->tail.load(std::memory_order_relaxed);
+    unsigned int head = ring->head.load(std::memory_order_acquire);
+
+    while (tail != head) {
+        const LogSlot &slot = ring->slots[tail % kRingSlots];
+        if (used + slot.length > bufSize) {
+            writeAll(buf, used);
+            used = 0;
+        }
+        memcpy(buf + used, slot.text, slot.length);
+        used += slot.length;
+        lines++;
+        tail++;
+        ring->tail.store(tail, std::memory_order_release);
+        head = ring->head.load(std::memory_order_acquire);
+    }
+
+    if (used > 0) {
+        writeAll(buf, used);
+    }
+
+    ring->draining.clear(std::memory_order_release);
+    return lines;
+}
+
+unsigned int drainAllRings(char *buf, size_t bufSize)
+{
+    unsigned int lines = 0;
+    for (unsigned int i = 0; i < kMaxRings; i++) {
+        LogRing *ring = s_rings[i].load(std::memory_order_acquire);
+        if (ring) {
+            lines += drainRing(ring, buf, bufSize);
+        }
+    }
+    return lines;
+}
+
+void writerLoop()
+{
+    static char batch[8 * MAX_LOG_BUFF];
+
+    while (true) {
+        if (drainAllRings(batch, sizeof(batch)) > 0) {
+            continue;
+        }
+
+        s_writerIdle.store(true, std::memory_order_seq_cst);
+        // Re-check after announcing idleness so a producer that missed the flag is not delayed
+        if (drainAllRings(batch, sizeof(batch)) > 0) {
+            s_writerIdle.store(false, std::memory_order_relaxed);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(s_writerMutex);
+        s_writerCond.wait_for(lock, std::chrono::milliseconds(100), [] {
+            return !s_writerIdle.load(std::memory_order_relaxed);
+        });
+        s_writerIdle.store(false, std::memory_order_relaxed);
+    }
+}
+
+void wakeWriter()
+{
+    if (s_writerIdle.load(std::memory_order_seq_cst)) {
+        std::lock_guard<std::mutex> lock(s_writerMutex);
+        s_writerIdle.store(false, std::memory_order_relaxed);
+        s_writerCond.notify_one();
+    }
+}
+
+void flushAtExit()
+{
+    DS_LogFlush();
+}
+
+void startWriter()
+{
+    std::thread(writerLoop).detach();
+    atexit(flushAtExit);
+}
+
+bool enqueue(LogLevel priority, const char *fileName, int lineNum, const char *func, const char *format, va_list argptr)
+{
+    if (nullptr == t_ring.ring) {
+        if (t_ring.unavailable) {
+            return false;
+        }
+        std::call_once(s_writerOnce, startWriter);
+        t_ring.ring = acquireRing();
+        if (nullptr == t_ring.ring) {
+            t_ring.unavailable = true;
+            return false;
+        }
+    }
+
+    LogRing *ring = t_ring.ring;
+    unsigned int head = ring->head.load(std::memory_order_relaxed);
+    // Ring full: write it out on this thread rather than lose the message
+    while (head - ring->tail.load(std::memory_order_acquire) >= kRingSlots) {
+        char buf[2 * MAX_LOG_BUFF];
+        if (0 == drainRing(ring, buf, sizeof(buf))) {
+            std::this_thread::yield();
+        }
+    }
+
+    LogSlot &slot = ring->slots[head % kRingSlots];
+    int used = snprintf(slot.text, sizeof(slot.text), "[DS][%d] %s [%s:%d] %s: ",
+                        (int)syscall(SYS_gettid), levelMap[static_cast<int>(priority)], fileName, lineNum, func);
+    if (used < 0 || used >= (int)sizeof(slot.text)) {
+        used = 0;
+    }
+    // leave room for the " \n" trailer
+    int room = (int)sizeof(slot.text) - used - 2;
+    if (room > kFormatMessageSize) {
+        room = kFormatMessageSize;
+    }
+    int msg = vsnprintf(slot.text + used, room, format, argptr);
+    used += (msg < 0) ? 0 : ((msg >= room) ? (room - 1) : msg);
+    slot.text[used++] = ' ';
+    slot.text[used++] = '\n';
+    slot.length = used;
+
+    ring->head.store(head + 1, std::memory_order_release);
+    wakeWriter();
+    return true;
+}
+
+} // namespace
+
 void DS_RegisterForLog(DS_LogCb cb)
 {
     logCb = cb;
 }
 
+void DS_SetLogLevel(int level)
+{
+    if (level < INFO_LEVEL || level > TRACE_LEVEL) {
+        return;
+    }
+    dsLogLevelMask.store(kThresholdMasks[level], std::memory_order_relaxed);
+}
+
+void DS_SetLogAsync(int enable)
+{
+    s_async.store(enable != 0, std::memory_order_relaxed);
+    if (!enable) {
+        DS_LogFlush();
+    }
+}
+
+void DS_LogFlush(void)
+{
+    char buf[2 * MAX_LOG_BUFF];
+    drainAllRings(buf, sizeof(buf));
+}
+
+// Applies DS_LOG_THRESHOLD and DS_LOG_ASYNC from the environment at load time
+static struct LogEnvInit {
+    LogEnvInit()
+    {
+        const char *threshold = getenv("DS_LOG_THRESHOLD");
+        if (threshold) {
+            for (int level = INFO_LEVEL; level <= TRACE_LEVEL; level++) {
+                if (0 == strcasecmp(threshold, levelMap[level])) {
+                    DS_SetLogLevel(level);
+                    break;
+                }
+            }
+        }
+        const char *async = getenv("DS_LOG_ASYNC");
+        if (async && 0 == strcmp(async, "1")) {
+            s_async.store(true, std::memory_order_relaxed);
+        }
+    }
+} s_logEnvInit;
+
 int ds_log(LogLevel priority, const char* fileName, int lineNum, const char *func, const char *format, ...)
 {
     char formatted[MAX_LOG_BUFF] = {'\0'};
-    enum LogLevel {INFO_LEVEL = 0, WARN_LEVEL, ERROR_LEVEL, DEBUG_LEVEL, TRACE_LEVEL};
-    const char *levelMap[] = { "INFO", "WARN", "ERROR", "DEBUG", "TRACE"};
 
     if (!func || !fileName || !format)
     {
         return -1;
     }
 
+    if (unlikely(priority < INFO_LEVEL || priority > TRACE_LEVEL) || !ds_log_enabled(priority))
+    {
+        return 0;
+    }
+
     va_list argptr;
     va_start(argptr, format);
+
+    if (nullptr == logCb && s_async.load(std::memory_order_relaxed)) {
+        bool queued = enqueue(priority, fileName, lineNum, func, format, argptr);
+        va_end(argptr);
+        if (queued) {
+            return 0;
+        }
+        // No ring available for this thread, fall back to a synchronous write
+        va_start(argptr, format);
+    }
+
     vsnprintf(formatted, kFormatMessageSize, format, argptr);
     va_end(argptr);
 
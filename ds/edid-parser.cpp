@@ -27,8 +27,6 @@
 #include <stdint.h>
 #include <ctype.h>
 
-#define UNUSED(_x_) _x_ = _x_
-
 
 namespace edid_parser {
 
@@ -44,470 +42,528 @@ enum EDID_EXTENSION_TAG_BLOCK_MAP
     MANUFACTURER_EXTENSION = 0xFF
 };
 
-static void parse_std_timing(unsigned char* bytes, edid_data_t* data_ptr) {
-    int idx = 0;
-    // two 1 means empty block
-    if (bytes[idx] == 1 && bytes[idx + 1] == 1) return;
-    int h = ((bytes[idx]) + 31) * 8;
-    int v = 0;
-    switch ((bytes[idx + 1] & 0xC0) >> 6) {
-        case 0: v = (h * 10) / 16; break;
-        case 1: v = (h * 3) / 4; break;
-        case 2: v = (h * 4) / 5; break;
-        case 3: v = (h * 9) / 16; break;
-    }
-    int r = (bytes[idx + 1] & 0x3F) + 60;
-    INT_DEBUG("STD %dx%d@%d\n", h, v, r);
-
-    UNUSED(h);
-    UNUSED(v);
-    UNUSED(r);
-}
-
-void parse_monitor_descriptor(unsigned char* bytes, edid_data_t* data_ptr) {
-  // Monitor Descriptor Block
-  if ((bytes[0] == 0) && (bytes[1] == 0) && (bytes[2] == 0)) {
-      //  First Monitor Descriptor Block
-      if (bytes[3] == 0xFC) {
-          memset(data_ptr->monitor_name, '\0', sizeof(data_ptr->monitor_name));
-          for (int i = 5; (i < (5 + 14)) && (bytes[i] != '\n') && isprint(bytes[i]); i++) {
-              data_ptr->monitor_name[i - 5] = bytes[i];
-          }
-          INT_DEBUG("Monitor name:'%s'\n", data_ptr->monitor_name);
-      }
-  }
-}
-
-static void parse_dtd(unsigned char* bytes, edid_data_t* data_ptr, char native) {
-    int idx = 0;
-    // Monitor descriptor block, not detailed timing descriptor.
-    if (bytes[idx] == 0 && bytes[idx + 1] == 0) {
-      parse_monitor_descriptor(bytes, data_ptr);
-    }
-    else {
-       // pixel clock, if any of bytes is 0 means std is invalid
-        if (bytes[idx] == 0 || bytes[idx + 1] == 0) return;
-        idx += 2;
-        // horizonal active
-        idx += 1;
-        // horizonal blanking
-        idx += 1;
-        // horizonal active : horizontal blanking
-        int h = ((bytes[idx] & 0xF0) << 4) | bytes[idx - 2];
-        idx += 1;
-        // vertical active
-        idx += 1;
-        // vertical blanking
-        idx += 1;
-        // vertical active : vertical blanking
-        int v = ((bytes[idx] & 0xF0) << 4) | bytes[idx - 2];
-        idx += 1;
-        // horizontal sync offset
-        idx += 1;
-        // horizontal sync pulse width
-        idx += 1;
-        // vertical sync offset : vertical sunc pulse width
-        idx += 1;
-        // horizontal sync offset, horizontal sync pulse width, vertical sync offset, vertical sync pulse width
-        idx += 1;
-        // horizontal image size
-        idx += 1;
-        // vertical image size
-        idx += 1;
-        // horizontal and vertical image size
-        idx += 1;
-        // horizontal border
-        idx += 1;
-        // vertical border
-        idx += 1;
-        // flags
-        char p = (bytes[idx] & 0x80) ? 0 : 1;
-        idx += 1;
-
-        INT_DEBUG("DTD, %dx%d@%c, native: %d (%s found already)\n", h, v, (p ? 'p' : 'i'), native, (data_ptr->res.native == EDID_NOT_NATIVE ? "not" : ""));
-
-        if (native) {
-            data_ptr->res.progressive = p ? EDID_PROGRESSIVE : EDID_INTERLACED;
-            data_ptr->res.width = h;
-            data_ptr->res.height = v * ((data_ptr->res.progressive == EDID_INTERLACED) ? 2 : 1);
-            data_ptr->res.native = EDID_NATIVE;
-        }
+#define EDID_BLOCK_SIZE 128
+#define EDID_DTD_SIZE 18
+
+/* IEEE OUIs as stored in the EDID, least significant byte first */
+#define OUI_HDMI_LLC 0x000C03
+#define OUI_HDMI_FORUM 0xC45DD8
+#define OUI_DOLBY 0x00D046
+#define OUI_HDR10PLUS 0x90848B
+
+/* CTA-861 extended data block tags */
+enum cta_extended_tag_e {
+    EXT_VIDEO_CAPABILITY = 0,
+    EXT_VENDOR_SPECIFIC_VIDEO = 1,
+    EXT_COLORIMETRY = 5,
+    EXT_HDR_STATIC_METADATA = 6,
+    EXT_HDR_DYNAMIC_METADATA = 7,
+    EXT_YCBCR420_VIDEO = 14,
+    EXT_YCBCR420_CAPABILITY_MAP = 15,
+    EXT_ROOM_CONFIGURATION = 19,
+    EXT_HF_EEODB = 120,
+    EXT_HF_SCDB = 121
+};
+
+/* Bounds checked accessors, out of range reads return 0 */
+static inline uint8_t byte_at(edid_span_t s, size_t idx) {
+    return (idx < s.size) ? s.data[idx] : 0;
+}
+
+static inline edid_span_t subspan(edid_span_t s, size_t offset, size_t len) {
+    edid_span_t sub = { s.data + offset, 0 };
+    if (offset > s.size) {
+        sub.data = s.data + s.size;
+    } else {
+        sub.size = (len < s.size - offset) ? len : s.size - offset;
     }
+    return sub;
 }
 
-typedef struct {
-    int w;
-    int h;
-    int p;
-    int r;
-    int ar_h;
-    int ar_v;
-} edid_vic_t;
-
-static edid_vic_t vic[108] = {
-    {640, 480, 1, 60, 4, 3},
-    {720, 480, 1, 60, 4, 3},
-    {720, 480, 1, 60, 16, 9},
-    {1280, 720, 1, 60, 16, 9},
-    {1920, 1080, 0, 60, 16, 9},
-    {1440, 480, 0, 60, 4, 3},
-    {1440, 480, 0, 60, 16, 9},
-    {1440, 240, 0, 60, 4, 3},
-    {1440, 240, 1, 60, 16, 9},
-    {2880, 480, 0, 60, 4, 3},
-    {2880, 480, 0, 60, 16, 9},
-    {2880, 240, 1, 60, 4, 3},
-    {2880, 240, 1, 60, 16, 9},
-    {1440, 480, 1, 60, 4, 3},
-    {1440, 480, 1, 60, 16, 9},
-    {1920, 1080,1, 60, 16, 9},
-    {720, 576, 1, 50, 4, 3},
-    {720, 576, 1, 50, 16, 9},
-    {1280, 720, 1, 50, 16, 9},
-    {1920, 1080, 0, 50, 16, 9},
-    {1440, 576, 0, 50, 4, 3},
-    {1440, 576, 0, 50, 16, 9},
-    {1440 ,288, 1, 50, 4, 3},
-    {1440, 288, 1, 50, 16, 9},
-    {2880, 576, 0, 50, 4, 3},
-    {2880, 576, 0, 50, 16, 9},
-    {2880, 288, 1, 50, 4, 3},
-    {2880, 288, 1, 50, 16, 9},
-    {1440, 576, 1, 50, 4, 3},
-    {1440, 576, 1, 50, 16, 9},
-    {1920, 1080, 1, 50, 16, 9},
-    {1920, 1080, 1, 24, 16, 9},
-    {1920, 1080, 1, 25, 16, 9},
-    {1920, 1080, 1, 30, 16, 9},
-    {2880, 480, 1, 60,  4, 3},
-    {2880, 480, 1, 60,  16, 9},
-    {2880, 576, 1, 50, 4, 3},
-    {2880, 576, 1, 50, 16, 9},
-    {1920, 1080, 0, 50, 16, 9},
-    {1920, 1080, 0, 100, 16, 9},
-    {1280, 720, 1, 100, 16, 9},
-    {720, 576, 1, 100, 4, 3},
-    {720, 576, 1, 100, 16, 9},
-    {1440, 576, 0, 100, 4, 3},
-    {1440, 576, 0, 100, 16, 9},
-    {1920, 1080, 0, 120, 16, 9},
-    {1280, 720, 1, 120, 16, 9},
-    {720, 480, 1,120, 4, 3},
-    {720, 480, 1, 120, 16, 9},
-    {1440, 480, 0, 120,4, 3},
-    {1440, 480, 0, 120,16, 9},
-    {720, 576, 1, 200, 4, 3},
-    {720, 576, 1, 200, 16, 9},
-    {1440, 576, 0, 200, 4, 3},
-    {720, 576, 0, 200, 16, 9},
-    {720, 480, 1, 240, 4, 3},
-    {720, 480, 1, 240, 16, 9},
-    {720, 480, 0, 240, 4, 3},
-    {720, 480, 0, 240, 16, 9},
-    {1280, 720, 1, 24, 16, 9},
-    {1280, 720, 1, 25, 16, 9},
-    {1280, 720, 1, 30, 16, 9},
-    {1920, 1080, 1, 120, 16, 9},
-    {1920, 1080, 1, 100, 16, 9},
-    {1280, 720, 1, 24, 64, 27},
-    {1280, 720, 1, 25, 64, 27},
-    {1280, 720, 1, 30, 64, 27},
-    {1280, 720, 1, 50, 64, 27},
-    {1280, 720, 1, 60, 64, 27},
-    {1280, 720, 1, 100, 64, 27},
-    {1280, 720, 1, 120, 64, 27},
-    {1920, 1080, 1, 24, 64, 27},
-    {1920, 1080, 1, 25, 64, 27},
-    {1920, 1080, 1, 30, 64, 27},
-    {1920, 1080, 1, 50, 64, 27},
-    {1920, 1080, 1, 60, 64, 27},
-    {1920, 1080, 1, 100, 64, 27},
-    {1920, 1080, 1, 120, 64, 27},
-    {1680, 720, 1, 24, 64, 27},
-    {1680, 720, 1, 25, 64, 27},
-    {1680, 720, 1, 30, 64, 27},
-    {1680, 720, 1, 50, 64, 27},
-    {1680, 720, 1, 60, 64, 27},
-    {1680, 720, 1, 100,64, 27},
-    {1680, 720, 1, 120, 64, 27},
-    {2560, 1080, 1, 24, 64, 27},
-    {2560, 1080, 1, 25, 64, 27},
-    {2560, 1080, 1, 30, 64, 27},
-    {2560, 1080, 1, 50, 64, 27},
-    {2560, 1080, 1, 60, 64, 27},
-    {2560, 1080, 1, 100, 64, 27},
-    {2560, 1080, 1, 120, 64, 27},
-    {3840, 2160, 1, 24, 16, 9},
-    {3840, 2160, 1, 25, 16, 9},
-    {3840, 2160, 1, 30, 16, 9},
-    {3840, 2160, 1, 50, 16, 9},
-    {3840, 2160, 1, 60, 16, 9},
-    {4096, 2160, 1, 24, 256, 135},
-    {4096, 2160, 1, 25, 256, 135},
-    {4096, 2160, 1, 30, 256, 135},
-    {4096, 2160, 1, 50,256, 135},
-    {4096, 2160, 1, 60, 256, 135},
-    {3840, 2160, 1, 24, 64, 27},
-    {3840, 2160, 1, 25, 64, 27},
-    {3840, 2160, 1, 30, 64, 27},
-    {3840, 2160, 1, 50, 64, 27},
-    {3840, 2160, 1, 60, 64, 27},
+static inline uint32_t oui_at(edid_span_t s, size_t idx) {
+    return (uint32_t)byte_at(s, idx) | ((uint32_t)byte_at(s, idx + 1) << 8) | ((uint32_t)byte_at(s, idx + 2) << 16);
+}
+
+static inline void set_vic_bit(uint8_t* bitmap, uint8_t vic) {
+    bitmap[vic >> 3] |= (uint8_t)(1u << (vic & 7));
+}
+
+/* CTA-861-G table 3, indexed by VIC - 1; width, height, progressive, refresh, aspect ratio */
+struct vic_timing_t {
+    uint16_t w;
+    uint16_t h;
+    uint8_t p;
+    uint8_t r;
+    uint16_t ar_h;
+    uint16_t ar_v;
 };
 
-static void parse_ext_video(const unsigned char* bytes, edid_res_t* edid_res, const unsigned int len, const unsigned int native_cnt) {
-    /* only if native resolution was not detected yet */
-    if (edid_res->native == EDID_NOT_NATIVE) {
-        int found_native = 0;
-        unsigned int idx;
-        unsigned int res;
-
-        for (idx = 0; idx < len; idx++) {
-            res = bytes[idx];
-            INT_DEBUG("EXT RES byte 0x%x (num: %d) %s\n", res, (((res >= 129) && (res <= 192)) ? (res & 0x7F) : res), (((res >= 129) && (res <= 192)) ? "native" : ""));
-            /* consider only native codes (CTA-861.F.pdf page 81) */
-            if ((res >= 129) && (res <= 192)) {
-                /* it is number of resolution in table, not index, so -1 */
-                res = (res & 0x7F) - 1;
-                found_native = 1;
-            }
-            /* When the first DTD and SVD do not match and the total number of
-             * DTDs defining Native Video Formats in the whole EDID is zero 
-             * (see Table 41, byte 3, lower 4 bits), the first SVD shall take
-             * precedence. (CTA-861.F.pdf page 75)*/
-            else if ((native_cnt == 0) && (idx == 0)) {
-                res = res - 1;
-                found_native = 1;
-            }
-            if (found_native) {
-                if (res < sizeof(vic) / sizeof(edid_vic_t)) {
-                    edid_res->width = vic[res].w;
-                    edid_res->height = vic[res].h;
-                    edid_res->refresh = vic[res].r;
-                    edid_res->progressive = vic[res].p ? EDID_PROGRESSIVE : EDID_INTERLACED;
-                    edid_res->native = EDID_NATIVE;
-                    INT_DEBUG("EXT RES native found: %dx%d%c@%d\n", vic[res].w, vic[res].h, vic[res].p ? 'p' : 'i', vic[res].r);
-                    return;
-                }
-            }
-        }
+static constexpr vic_timing_t vic_timings[127] = {
+    /*   1 */ {640, 480, 1, 60, 4, 3}, {720, 480, 1, 60, 4, 3}, {720, 480, 1, 60, 16, 9}, {1280, 720, 1, 60, 16, 9},
+    /*   5 */ {1920, 1080, 0, 60, 16, 9}, {1440, 480, 0, 60, 4, 3}, {1440, 480, 0, 60, 16, 9}, {1440, 240, 1, 60, 4, 3},
+    /*   9 */ {1440, 240, 1, 60, 16, 9}, {2880, 480, 0, 60, 4, 3}, {2880, 480, 0, 60, 16, 9}, {2880, 240, 1, 60, 4, 3},
+    /*  13 */ {2880, 240, 1, 60, 16, 9}, {1440, 480, 1, 60, 4, 3}, {1440, 480, 1, 60, 16, 9}, {1920, 1080, 1, 60, 16, 9},
+    /*  17 */ {720, 576, 1, 50, 4, 3}, {720, 576, 1, 50, 16, 9}, {1280, 720, 1, 50, 16, 9}, {1920, 1080, 0, 50, 16, 9},
+    /*  21 */ {1440, 576, 0, 50, 4, 3}, {1440, 576, 0, 50, 16, 9}, {1440, 288, 1, 50, 4, 3}, {1440, 288, 1, 50, 16, 9},
+    /*  25 */ {2880, 576, 0, 50, 4, 3}, {2880, 576, 0, 50, 16, 9}, {2880, 288, 1, 50, 4, 3}, {2880, 288, 1, 50, 16, 9},
+    /*  29 */ {1440, 576, 1, 50, 4, 3}, {1440, 576, 1, 50, 16, 9}, {1920, 1080, 1, 50, 16, 9}, {1920, 1080, 1, 24, 16, 9},
+    /*  33 */ {1920, 1080, 1, 25, 16, 9}, {1920, 1080, 1, 30, 16, 9}, {2880, 480, 1, 60, 4, 3}, {2880, 480, 1, 60, 16, 9},
+    /*  37 */ {2880, 576, 1, 50, 4, 3}, {2880, 576, 1, 50, 16, 9}, {1920, 1080, 0, 50, 16, 9}, {1920, 1080, 0, 100, 16, 9},
+    /*  41 */ {1280, 720, 1, 100, 16, 9}, {720, 576, 1, 100, 4, 3}, {720, 576, 1, 100, 16, 9}, {1440, 576, 0, 100, 4, 3},
+    /*  45 */ {1440, 576, 0, 100, 16, 9}, {1920, 1080, 0, 120, 16, 9}, {1280, 720, 1, 120, 16, 9}, {720, 480, 1, 120, 4, 3},
+    /*  49 */ {720, 480, 1, 120, 16, 9}, {1440, 480, 0, 120, 4, 3}, {1440, 480, 0, 120, 16, 9}, {720, 576, 1, 200, 4, 3},
+    /*  53 */ {720, 576, 1, 200, 16, 9}, {1440, 576, 0, 200, 4, 3}, {1440, 576, 0, 200, 16, 9}, {720, 480, 1, 240, 4, 3},
+    /*  57 */ {720, 480, 1, 240, 16, 9}, {1440, 480, 0, 240, 4, 3}, {1440, 480, 0, 240, 16, 9}, {1280, 720, 1, 24, 16, 9},
+    /*  61 */ {1280, 720, 1, 25, 16, 9}, {1280, 720, 1, 30, 16, 9}, {1920, 1080, 1, 120, 16, 9}, {1920, 1080, 1, 100, 16, 9},
+    /*  65 */ {1280, 720, 1, 24, 64, 27}, {1280, 720, 1, 25, 64, 27}, {1280, 720, 1, 30, 64, 27}, {1280, 720, 1, 50, 64, 27},
+    /*  69 */ {1280, 720, 1, 60, 64, 27}, {1280, 720, 1, 100, 64, 27}, {1280, 720, 1, 120, 64, 27}, {1920, 1080, 1, 24, 64, 27},
+    /*  73 */ {1920, 1080, 1, 25, 64, 27}, {1920, 1080, 1, 30, 64, 27}, {1920, 1080, 1, 50, 64, 27}, {1920, 1080, 1, 60, 64, 27},
+    /*  77 */ {1920, 1080, 1, 100, 64, 27}, {1920, 1080, 1, 120, 64, 27}, {1680, 720, 1, 24, 64, 27}, {1680, 720, 1, 25, 64, 27},
+    /*  81 */ {1680, 720, 1, 30, 64, 27}, {1680, 720, 1, 50, 64, 27}, {1680, 720, 1, 60, 64, 27}, {1680, 720, 1, 100, 64, 27},
+    /*  85 */ {1680, 720, 1, 120, 64, 27}, {2560, 1080, 1, 24, 64, 27}, {2560, 1080, 1, 25, 64, 27}, {2560, 1080, 1, 30, 64, 27},
+    /*  89 */ {2560, 1080, 1, 50, 64, 27}, {2560, 1080, 1, 60, 64, 27}, {2560, 1080, 1, 100, 64, 27}, {2560, 1080, 1, 120, 64, 27},
+    /*  93 */ {3840, 2160, 1, 24, 16, 9}, {3840, 2160, 1, 25, 16, 9}, {3840, 2160, 1, 30, 16, 9}, {3840, 2160, 1, 50, 16, 9},
+    /*  97 */ {3840, 2160, 1, 60, 16, 9}, {4096, 2160, 1, 24, 256, 135}, {4096, 2160, 1, 25, 256, 135}, {4096, 2160, 1, 30, 256, 135},
+    /* 101 */ {4096, 2160, 1, 50, 256, 135}, {4096, 2160, 1, 60, 256, 135}, {3840, 2160, 1, 24, 64, 27}, {3840, 2160, 1, 25, 64, 27},
+    /* 105 */ {3840, 2160, 1, 30, 64, 27}, {3840, 2160, 1, 50, 64, 27}, {3840, 2160, 1, 60, 64, 27}, {1280, 720, 1, 48, 16, 9},
+    /* 109 */ {1280, 720, 1, 48, 64, 27}, {1680, 720, 1, 48, 64, 27}, {1920, 1080, 1, 48, 16, 9}, {1920, 1080, 1, 48, 64, 27},
+    /* 113 */ {2560, 1080, 1, 48, 64, 27}, {3840, 2160, 1, 48, 16, 9}, {4096, 2160, 1, 48, 256, 135}, {3840, 2160, 1, 48, 64, 27},
+    /* 117 */ {3840, 2160, 1, 100, 16, 9}, {3840, 2160, 1, 120, 16, 9}, {3840, 2160, 1, 100, 64, 27}, {3840, 2160, 1, 120, 64, 27},
+    /* 121 */ {5120, 2160, 1, 24, 64, 27}, {5120, 2160, 1, 25, 64, 27}, {5120, 2160, 1, 30, 64, 27}, {5120, 2160, 1, 48, 64, 27},
+    /* 125 */ {5120, 2160, 1, 50, 64, 27}, {5120, 2160, 1, 60, 64, 27}, {5120, 2160, 1, 100, 64, 27},
+};
+
+/* CTA-861-G table 3, VICs 193..219 */
+static constexpr vic_timing_t vic_timings_high[27] = {
+    /* 193 */ {5120, 2160, 1, 120, 64, 27}, {7680, 4320, 1, 24, 16, 9}, {7680, 4320, 1, 25, 16, 9}, {7680, 4320, 1, 30, 16, 9},
+    /* 197 */ {7680, 4320, 1, 48, 16, 9}, {7680, 4320, 1, 50, 16, 9}, {7680, 4320, 1, 60, 16, 9}, {7680, 4320, 1, 100, 16, 9},
+    /* 201 */ {7680, 4320, 1, 120, 16, 9}, {7680, 4320, 1, 24, 64, 27}, {7680, 4320, 1, 25, 64, 27}, {7680, 4320, 1, 30, 64, 27},
+    /* 205 */ {7680, 4320, 1, 48, 64, 27}, {7680, 4320, 1, 50, 64, 27}, {7680, 4320, 1, 60, 64, 27}, {7680, 4320, 1, 100, 64, 27},
+    /* 209 */ {7680, 4320, 1, 120, 64, 27}, {10240, 4320, 1, 24, 64, 27}, {10240, 4320, 1, 25, 64, 27}, {10240, 4320, 1, 30, 64, 27},
+    /* 213 */ {10240, 4320, 1, 48, 64, 27}, {10240, 4320, 1, 50, 64, 27}, {10240, 4320, 1, 60, 64, 27}, {10240, 4320, 1, 100, 64, 27},
+    /* 217 */ {10240, 4320, 1, 120, 64, 27}, {4096, 2160, 1, 100, 256, 135}, {4096, 2160, 1, 120, 256, 135},
+};
+
+static inline const vic_timing_t* vic_lookup(unsigned int vic) {
+    if ((vic >= 1) && (vic <= 127)) {
+        return &vic_timings[vic - 1];
+    }
+    if ((vic >= 193) && (vic <= 219)) {
+        return &vic_timings_high[vic - 193];
     }
+    return NULL;
 }
 
-static void parse_colorimetry_block(unsigned char* bytes, edid_data_t* data_ptr) {
-    data_ptr->colorimetry_info = ((uint32_t)bytes[2]) | ((uint32_t)bytes[3] << 8);
-    INT_DEBUG("colorimetry info:0x%x\n", data_ptr->colorimetry_info);
-}
+/* Established timings, indexed by bit position in established_timings >> 7 */
+struct est_timing_t {
+    uint16_t w;
+    uint16_t h;
+    uint8_t r;
+    uint8_t p;
+};
 
-static void parse_extended_db(uint8_t* bytes, edid_data_t* data_ptr) {
-    const uint8_t extended_code = bytes[1];
-    INT_DEBUG("parse_extended_db extended_code=%d\n", extended_code);
+static constexpr est_timing_t est_timings[17] = {
+    {1152, 870, 75, 1}, {1280, 1024, 75, 1}, {1024, 768, 75, 1}, {1024, 768, 70, 1},
+    {1024, 768, 60, 1}, {1024, 768, 87, 0}, {832, 624, 75, 1}, {800, 600, 75, 1},
+    {800, 600, 72, 1}, {800, 600, 60, 1}, {800, 600, 56, 1}, {640, 480, 75, 1},
+    {640, 480, 72, 1}, {640, 480, 67, 1}, {640, 480, 60, 1}, {720, 400, 88, 1},
+    {720, 400, 70, 1},
+};
 
-    // 0x5 - "Colorimetry Data block"
-    if (extended_code == 5) {
-      parse_colorimetry_block(bytes, data_ptr);
+/* State carried through the single pass over all blocks */
+struct parse_ctx_t {
+    edid_data_t* data;
+    int native_cnt;             /* native DTD count of the current CTA block */
+    edid_res_t cta_native;      /* native format found in the Video Data Blocks */
+    bool cmdb_all;              /* 4:2:0 Capability Map Data Block without a map */
+    uint8_t cmdb_map[EDID_MAX_SVD / 8];
+    uint8_t eeodb_count;        /* extension count override from HF-EEODB */
+};
+
+static void parse_est_timing(edid_span_t bytes, edid_data_t* data_ptr) {
+    data_ptr->established_timings = ((uint32_t)byte_at(bytes, 0) << 16) | ((uint32_t)byte_at(bytes, 1) << 8) | byte_at(bytes, 2);
+#if DS_LOG_LEVEL >= DEBUG_LEVEL
+    for (uint32_t bits = data_ptr->established_timings >> 7; bits; bits &= bits - 1) {
+        const est_timing_t& est = est_timings[__builtin_ctz(bits)];
+        INT_DEBUG("EST %dx%d%c@%d\n", est.w, est.h, est.p ? 'p' : 'i', est.r);
     }
-    // 0x6 - "HDR Static Metadata Data Block" (from CTA-861-G_FINAL_revised_2017.pdf)
-    else if (extended_code == 6) {
+#endif
+}
 
-        uint8_t eotfByte = bytes[2];
-        data_ptr->hdr_capabilities = 0;
+static void parse_std_timing(edid_span_t bytes) {
+    // two 1 means empty block
+    if (byte_at(bytes, 0) == 1 && byte_at(bytes, 1) == 1) return;
+#if DS_LOG_LEVEL >= DEBUG_LEVEL
+    static constexpr uint8_t ar_v[4] = {10, 3, 4, 9};
+    static constexpr uint8_t ar_h[4] = {16, 4, 5, 16};
+    int h = (byte_at(bytes, 0) + 31) * 8;
+    int a = byte_at(bytes, 1) >> 6;
+    INT_DEBUG("STD %dx%d@%d\n", h, (h * ar_v[a]) / ar_h[a], (byte_at(bytes, 1) & 0x3F) + 60);
+#endif
+}
 
-        if (eotfByte & 0x01) {
-            data_ptr->hdr_capabilities |= HDR_standard_SDR;
+static void parse_monitor_descriptor(edid_span_t bytes, edid_data_t* data_ptr) {
+    // Display Product Name descriptor, up to 13 characters terminated by 0x0A
+    if (byte_at(bytes, 2) == 0 && byte_at(bytes, 3) == 0xFC) {
+        memset(data_ptr->monitor_name, '\0', sizeof(data_ptr->monitor_name));
+        for (size_t i = 5; (i < bytes.size) && (bytes.data[i] != '\n') && isprint(bytes.data[i]); i++) {
+            data_ptr->monitor_name[i - 5] = bytes.data[i];
         }
+        INT_DEBUG("Monitor name:'%s'\n", data_ptr->monitor_name);
+    }
+}
+
+static void parse_dtd(edid_span_t bytes, edid_data_t* data_ptr, bool native) {
+    if (bytes.size < EDID_DTD_SIZE) return;
+    const uint8_t* b = bytes.data;
+    // Monitor descriptor block, not detailed timing descriptor.
+    if (b[0] == 0 && b[1] == 0) {
+        parse_monitor_descriptor(bytes, data_ptr);
+        return;
+    }
+    // pixel clock, if any of bytes is 0 means std is invalid
+    if (b[0] == 0 || b[1] == 0) return;
+
+    uint32_t pixel_clock = (uint32_t)(b[0] | (b[1] << 8)) * 10000;
+    int h = ((b[4] & 0xF0) << 4) | b[2];
+    int h_total = h + (((b[4] & 0x0F) << 8) | b[3]);
+    int v = ((b[7] & 0xF0) << 4) | b[5];
+    int v_total = v + (((b[7] & 0x0F) << 8) | b[6]);
+    bool p = !(b[17] & 0x80);
+    uint64_t total = (uint64_t)h_total * v_total;
+    int r = total ? (int)((pixel_clock + total / 2) / total) : 0;
+
+    INT_DEBUG("DTD, %dx%d%c@%d, native: %d (%s found already)\n", h, v, (p ? 'p' : 'i'), r, native, (data_ptr->res.native == EDID_NOT_NATIVE ? "not" : ""));
+
+    if (native) {
+        data_ptr->res.progressive = p ? EDID_PROGRESSIVE : EDID_INTERLACED;
+        data_ptr->res.width = h;
+        data_ptr->res.height = v * (p ? 1 : 2);
+        data_ptr->res.refresh = r;
+        data_ptr->res.native = EDID_NATIVE;
+    }
+}
 
-        if (eotfByte & 0x02) {
-            data_ptr->hdr_capabilities |= HDR_standard_Traditional_HDR;
+static void parse_audio_block(parse_ctx_t& ctx, edid_span_t block) {
+    // Short Audio Descriptors, 3 bytes each
+    for (size_t idx = 1; idx + 3 <= block.size; idx += 3) {
+        uint8_t format = (block.data[idx] >> 3) & 0x0F;
+        uint8_t channels = (block.data[idx] & 0x07) + 1;
+        ctx.data->audio_formats |= (uint16_t)(1u << format);
+        if (channels > ctx.data->audio_max_channels) {
+            ctx.data->audio_max_channels = channels;
         }
+    }
+}
+
+static void add_svd(parse_ctx_t& ctx, uint8_t vic) {
+    edid_data_t* data_ptr = ctx.data;
+    if (data_ptr->svd_count < EDID_MAX_SVD) {
+        data_ptr->svd[data_ptr->svd_count++] = vic;
+    }
+}
+
+static void set_cta_native(parse_ctx_t& ctx, const vic_timing_t* t) {
+    ctx.cta_native.width = t->w;
+    ctx.cta_native.height = t->h;
+    ctx.cta_native.refresh = t->r;
+    ctx.cta_native.progressive = t->p ? EDID_PROGRESSIVE : EDID_INTERLACED;
+    ctx.cta_native.native = EDID_NATIVE;
+    INT_DEBUG("EXT RES native found: %dx%d%c@%d\n", t->w, t->h, t->p ? 'p' : 'i', t->r);
+}
 
-        if (eotfByte & 0x04) {
-            data_ptr->hdr_capabilities |= HDR_standard_HDR10;
+static void parse_video_block(parse_ctx_t& ctx, edid_span_t block) {
+    for (size_t idx = 1; idx < block.size; idx++) {
+        uint8_t code = block.data[idx];
+        /* 129..192 are VICs 1..64 flagged as native (CTA-861.F.pdf page 81) */
+        bool native_flag = (code >= 129) && (code <= 192);
+        uint8_t vic = native_flag ? (code & 0x7F) : code;
+
+        /* 0, 128, 254 and 255 are reserved, e.g. padding reached through a corrupt block length.
+         * They still take a slot (VIC 0) so the YCbCr 4:2:0 Capability Map indices stay aligned. */
+        if ((code == 0) || (code == 128) || (code >= 254)) {
+            add_svd(ctx, 0);
+            continue;
         }
-        if (eotfByte & 0x08) {
-            data_ptr->hdr_capabilities |= HDR_standard_HLG;
+        add_svd(ctx, vic);
+        INT_DEBUG("EXT RES byte 0x%x (num: %d) %s\n", code, vic, native_flag ? "native" : "");
+
+        /* When the first DTD and SVD do not match and the total number of
+         * DTDs defining Native Video Formats in the whole EDID is zero
+         * (see Table 41, byte 3, lower 4 bits), the first SVD shall take
+         * precedence. (CTA-861.F.pdf page 75)*/
+        if ((ctx.cta_native.native == EDID_NOT_NATIVE) && (native_flag || ((ctx.native_cnt == 0) && (idx == 1)))) {
+            const vic_timing_t* t = vic_lookup(vic);
+            if (t) {
+                set_cta_native(ctx, t);
+            }
         }
-    } else {
-        INT_DEBUG("Extended DB - extended code %d not supported\n", extended_code);
     }
 }
 
-static void parse_vendodr_specific_block(unsigned char* bytes, edid_data_t* data_ptr) {
-    data_ptr->physical_address_a = bytes[4]  >> 4;
-    data_ptr->physical_address_b = bytes[4] & 0x0F;
-    data_ptr->physical_address_c = bytes[3]  >> 4;
-    data_ptr->physical_address_d = bytes[5] & 0x0F;
-    INT_DEBUG("Vendor specific bolck, physical adress a:0x%x b:0x%x c:0x%x d:0x%x\n",
+static void parse_hdmi_vsdb(parse_ctx_t& ctx, edid_span_t block) {
+    edid_data_t* data_ptr = ctx.data;
+    if (block.size < 6) return;
+    data_ptr->physical_address_a = block.data[4] >> 4;
+    data_ptr->physical_address_b = block.data[4] & 0x0F;
+    data_ptr->physical_address_c = block.data[5] >> 4;
+    data_ptr->physical_address_d = block.data[5] & 0x0F;
+    INT_DEBUG("Vendor specific block, physical address a:0x%x b:0x%x c:0x%x d:0x%x\n",
           data_ptr->physical_address_a,
           data_ptr->physical_address_b,
           data_ptr->physical_address_c,
           data_ptr->physical_address_d);
 }
 
-static void parse_ext_timing(unsigned char* bytes, edid_data_t* data_ptr) {
-    int idx = 0;
-    // dtd start
-    INT_DEBUG("TimingExtension version: %d\n", bytes[-1]);
-    int dtd_start = bytes[idx] - 2;
-    idx += 1;
-    // extension dtds number (0x0F), underscan (0x80), basic audio (0x40), ycbcr444 (0x20), ycbcr422 (0x10), native formats (0x07)
-    int native_cnt = bytes[idx] & 0x07;
-    INT_DEBUG("Native cnt: %d\n", native_cnt);
-    idx += 1;
-    if (dtd_start != 2) {
-        int end = dtd_start;
-        edid_res_t ext_video_res;
-
-        ext_video_res.native = EDID_NOT_NATIVE;
-        while (idx < end) {
-            int tag = (bytes[idx] & 0xE0) >> 5;
-            int len = bytes[idx] & 0x1F;
-            INT_DEBUG("parse_ext_timing: extension tag=%d len=%d\n", tag, len);
-
-            switch (tag) {
-                // reserved
-                case 0: break;
-                // audio
-                case 1: break;
-                // video
-                case 2: parse_ext_video(&bytes[idx + 1], &ext_video_res, len, native_cnt); break;
-                // vendor specific
-                case 3: parse_vendodr_specific_block(&bytes[idx], data_ptr); break;
-                // speaker
-                case 4: break;
-                // vesa dtc data block
-                case 5: break;
-                // reserved
-                case 6: break;
-                // 'Use Extended Tag'
-                case 7: parse_extended_db(&bytes[idx], data_ptr); break;
-            }
-            idx += len + 1;
+/* HF-VSDB and HF-SCDB share the payload layout, starting at offset 4 of the block */
+static void parse_hf_block(parse_ctx_t& ctx, edid_span_t block) {
+    edid_hf_vsdb_t& hf = ctx.data->hf_vsdb;
+    if (block.size < 7) return;
+
+    hf.present = true;
+    hf.version = byte_at(block, 4);
+    hf.max_tmds_char_rate = byte_at(block, 5) * 5;
+
+    uint8_t b = byte_at(block, 6);
+    hf.scdc_present = b & 0x80;
+    hf.rr_capable = b & 0x40;
+    hf.lte_340mcsc_scramble = b & 0x08;
+
+    b = byte_at(block, 7);
+    hf.max_frl_rate = b >> 4;
+    hf.dc_48bit_420 = b & 0x04;
+    hf.dc_36bit_420 = b & 0x02;
+    hf.dc_30bit_420 = b & 0x01;
+
+    b = byte_at(block, 8);
+    hf.m_delta = b & 0x20;
+    hf.cinema_vrr = b & 0x10;
+    hf.cnmvrr = b & 0x08;
+    hf.fva = b & 0x04;
+    hf.allm = b & 0x02;
+
+    b = byte_at(block, 9);
+    hf.vrr_min = b & 0x3F;
+    hf.vrr_max = (uint16_t)(((b & 0xC0) << 2) | byte_at(block, 10));
+    hf.dsc_1p2 = byte_at(block, 11) & 0x80;
+
+    INT_DEBUG("HF block, version %d max TMDS %d MHz FRL %d ALLM %d VRR %d-%d\n",
+          hf.version, hf.max_tmds_char_rate, hf.max_frl_rate, hf.allm, hf.vrr_min, hf.vrr_max);
+}
+
+typedef void (*block_handler_t)(parse_ctx_t& ctx, edid_span_t block);
+
+struct oui_handler_t {
+    uint32_t oui;
+    block_handler_t handler;
+};
+
+static const oui_handler_t vendor_handlers[] = {
+    {OUI_HDMI_LLC, parse_hdmi_vsdb},
+    {OUI_HDMI_FORUM, parse_hf_block},
+};
+
+static void dispatch_oui(parse_ctx_t& ctx, edid_span_t block, size_t oui_idx, const oui_handler_t* table, size_t n) {
+    uint32_t oui = oui_at(block, oui_idx);
+    for (size_t i = 0; i < n; i++) {
+        if (table[i].oui == oui) {
+            table[i].handler(ctx, block);
+            return;
         }
-        /* if there is native resoluton defined in Video Data Block we will
-         * prioritize that over DTD native - important for example for monitors
-         * where real native resolution could be quite exotic */
-        if (ext_video_res.native != EDID_NOT_NATIVE) {
-            data_ptr->res.width = ext_video_res.width;
-            data_ptr->res.height = ext_video_res.height;
-            data_ptr->res.refresh = ext_video_res.refresh;
-            data_ptr->res.progressive = ext_video_res.progressive;
-            data_ptr->res.native = ext_video_res.native;
+    }
+    INT_DEBUG("Vendor block with OUI 0x%06x not supported\n", oui);
+}
+
+static void parse_vendor_block(parse_ctx_t& ctx, edid_span_t block) {
+    if (block.size < 4) return;
+    dispatch_oui(ctx, block, 1, vendor_handlers, sizeof(vendor_handlers) / sizeof(vendor_handlers[0]));
+}
+
+static void parse_speaker_block(parse_ctx_t& ctx, edid_span_t block) {
+    ctx.data->speaker_allocation = ((uint32_t)byte_at(block, 1) << 16) | ((uint32_t)byte_at(block, 2) << 8) | byte_at(block, 3);
+}
+
+/* Extended blocks: byte 1 is the extended tag, payload starts at byte 2 */
+
+static void parse_video_capability(parse_ctx_t& ctx, edid_span_t block) {
+    ctx.data->video_capability = byte_at(block, 2);
+}
+
+static void parse_dolby_vsvdb(parse_ctx_t& ctx, edid_span_t) {
+    ctx.data->hdr_capabilities |= HDR_standard_DolbyVersion;
+}
+
+static void parse_hdr10plus_vsvdb(parse_ctx_t& ctx, edid_span_t) {
+    ctx.data->hdr_dynamic_metadata |= HDR_DYNAMIC_METADATA_ST2094_40;
+}
+
+static const oui_handler_t video_vendor_handlers[] = {
+    {OUI_DOLBY, parse_dolby_vsvdb},
+    {OUI_HDR10PLUS, parse_hdr10plus_vsvdb},
+};
+
+static void parse_vendor_video_block(parse_ctx_t& ctx, edid_span_t block) {
+    if (block.size < 5) return;
+    dispatch_oui(ctx, block, 2, video_vendor_handlers, sizeof(video_vendor_handlers) / sizeof(video_vendor_handlers[0]));
+}
+
+static void parse_colorimetry_block(parse_ctx_t& ctx, edid_span_t block) {
+    ctx.data->colorimetry_info = ((uint32_t)byte_at(block, 2)) | ((uint32_t)byte_at(block, 3) << 8);
+    INT_DEBUG("colorimetry info:0x%x\n", ctx.data->colorimetry_info);
+}
+
+// "HDR Static Metadata Data Block" (from CTA-861-G_FINAL_revised_2017.pdf)
+static void parse_hdr_static_block(parse_ctx_t& ctx, edid_span_t block) {
+    // EOTF bits 0..3 map to SDR, traditional HDR, SMPTE ST 2084 and HLG
+    static constexpr uint8_t eotf_to_hdr[16] = {
+        0,
+        HDR_standard_SDR,
+        HDR_standard_Traditional_HDR,
+        HDR_standard_SDR | HDR_standard_Traditional_HDR,
+        HDR_standard_HDR10,
+        HDR_standard_HDR10 | HDR_standard_SDR,
+        HDR_standard_HDR10 | HDR_standard_Traditional_HDR,
+        HDR_standard_HDR10 | HDR_standard_Traditional_HDR | HDR_standard_SDR,
+        HDR_standard_HLG,
+        HDR_standard_HLG | HDR_standard_SDR,
+        HDR_standard_HLG | HDR_standard_Traditional_HDR,
+        HDR_standard_HLG | HDR_standard_Traditional_HDR | HDR_standard_SDR,
+        HDR_standard_HLG | HDR_standard_HDR10,
+        HDR_standard_HLG | HDR_standard_HDR10 | HDR_standard_SDR,
+        HDR_standard_HLG | HDR_standard_HDR10 | HDR_standard_Traditional_HDR,
+        HDR_standard_HLG | HDR_standard_HDR10 | HDR_standard_Traditional_HDR | HDR_standard_SDR,
+    };
+    edid_data_t* data_ptr = ctx.data;
+    data_ptr->hdr_capabilities |= eotf_to_hdr[byte_at(block, 2) & 0x0F];
+    data_ptr->hdr_static_metadata = byte_at(block, 3);
+    data_ptr->hdr_max_luminance = byte_at(block, 4);
+    data_ptr->hdr_max_frame_avg_luminance = byte_at(block, 5);
+    data_ptr->hdr_min_luminance = byte_at(block, 6);
+}
+
+static void parse_hdr_dynamic_block(parse_ctx_t& ctx, edid_span_t block) {
+    // sequence of {length, type (2 bytes LE), type specific data}, length counts from the type
+    for (size_t idx = 2; idx + 3 <= block.size; idx += 1 + block.data[idx]) {
+        uint16_t type = (uint16_t)(block.data[idx + 1] | (block.data[idx + 2] << 8));
+        if ((type >= 1) && (type <= 4)) {
+            ctx.data->hdr_dynamic_metadata |= (uint8_t)(1u << (type - 1));
+        }
+        if (block.data[idx] < 2) break;
+    }
+}
+
+static void parse_ycbcr420_video_block(parse_ctx_t& ctx, edid_span_t block) {
+    for (size_t idx = 2; idx < block.size; idx++) {
+        uint8_t vic = block.data[idx];
+        set_vic_bit(ctx.data->ycbcr420_only, vic);
+    }
+}
+
+static void parse_ycbcr420_capability_map(parse_ctx_t& ctx, edid_span_t block) {
+    // without a map every SVD supports 4:2:0; the map is resolved against the SVDs once all blocks are read
+    if (block.size <= 2) {
+        ctx.cmdb_all = true;
+        return;
+    }
+    for (size_t idx = 2; (idx < block.size) && (idx - 2 < sizeof(ctx.cmdb_map)); idx++) {
+        ctx.cmdb_map[idx - 2] |= block.data[idx];
+    }
+}
+
+static void parse_room_configuration(parse_ctx_t& ctx, edid_span_t block) {
+    edid_room_config_t& room = ctx.data->room_config;
+    if (block.size < 6) return;
+    uint8_t b = block.data[2];
+    room.present = true;
+    room.display = b & 0x80;
+    room.sld = b & 0x20;
+    room.speaker_count = (b & 0x40) ? (b & 0x1F) + 1 : 0;
+    room.speaker_mask = ((uint32_t)block.data[3] << 16) | ((uint32_t)block.data[4] << 8) | block.data[5];
+}
+
+static void parse_hf_eeodb(parse_ctx_t& ctx, edid_span_t block) {
+    ctx.eeodb_count = byte_at(block, 2);
+}
+
+struct extended_handler_t {
+    uint8_t tag;
+    block_handler_t handler;
+};
+
+static const extended_handler_t extended_handlers[] = {
+    {EXT_VIDEO_CAPABILITY, parse_video_capability},
+    {EXT_VENDOR_SPECIFIC_VIDEO, parse_vendor_video_block},
+    {EXT_COLORIMETRY, parse_colorimetry_block},
+    {EXT_HDR_STATIC_METADATA, parse_hdr_static_block},
+    {EXT_HDR_DYNAMIC_METADATA, parse_hdr_dynamic_block},
+    {EXT_YCBCR420_VIDEO, parse_ycbcr420_video_block},
+    {EXT_YCBCR420_CAPABILITY_MAP, parse_ycbcr420_capability_map},
+    {EXT_ROOM_CONFIGURATION, parse_room_configuration},
+    {EXT_HF_EEODB, parse_hf_eeodb},
+    // same layout as HF-VSDB, with the extended tag and two reserved bytes in place of the OUI
+    {EXT_HF_SCDB, parse_hf_block},
+};
+
+static void parse_extended_block(parse_ctx_t& ctx, edid_span_t block) {
+    if (block.size < 2) return;
+    const uint8_t extended_code = block.data[1];
+    INT_DEBUG("parse_extended_block extended_code=%d\n", extended_code);
+    for (size_t i = 0; i < sizeof(extended_handlers) / sizeof(extended_handlers[0]); i++) {
+        if (extended_handlers[i].tag == extended_code) {
+            extended_handlers[i].handler(ctx, block);
+            return;
+        }
+    }
+    INT_DEBUG("Extended DB - extended code %d not supported\n", extended_code);
+}
+
+/* Indexed by data block tag code: reserved, audio, video, vendor specific, speaker allocation, VESA DTC, reserved, extended */
+static const block_handler_t block_handlers[8] = {
+    NULL, parse_audio_block, parse_video_block, parse_vendor_block, parse_speaker_block, NULL, NULL, parse_extended_block
+};
+
+static void parse_ext_timing(parse_ctx_t& ctx, edid_span_t block) {
+    edid_data_t* data_ptr = ctx.data;
+    INT_DEBUG("TimingExtension version: %d\n", byte_at(block, 1));
+    // offset of the first DTD; 0 means neither DTDs nor data blocks
+    size_t dtd_start = byte_at(block, 2);
+    // extension dtds number (0x0F), underscan (0x80), basic audio (0x40), ycbcr444 (0x20), ycbcr422 (0x10), native formats (0x07)
+    ctx.native_cnt = byte_at(block, 3) & 0x07;
+    INT_DEBUG("Native cnt: %d\n", ctx.native_cnt);
+    if (dtd_start == 0 || dtd_start > EDID_BLOCK_SIZE - 1) {
+        return;
+    }
+
+    ctx.cta_native.native = EDID_NOT_NATIVE;
+    edid_span_t collection = subspan(block, 4, dtd_start > 4 ? dtd_start - 4 : 0);
+    for (size_t idx = 0; idx < collection.size; ) {
+        uint8_t tag = collection.data[idx] >> 5;
+        size_t len = collection.data[idx] & 0x1F;
+        INT_DEBUG("parse_ext_timing: extension tag=%d len=%zu\n", tag, len);
+        if (block_handlers[tag]) {
+            block_handlers[tag](ctx, subspan(collection, idx, len + 1));
         }
+        idx += len + 1;
     }
-    /* At the moment this implementation parses only 1 (first) native resolution, 
+    /* if there is native resoluton defined in Video Data Block we will
+     * prioritize that over DTD native - important for example for monitors
+     * where real native resolution could be quite exotic */
+    if (ctx.cta_native.native != EDID_NOT_NATIVE) {
+        data_ptr->res = ctx.cta_native;
+    }
+
+    /* At the moment this implementation parses only 1 (first) native resolution,
      * as DTDs are as well in frist EDID block it could be that native resolution
      * is already parsed, and we should not overwrite it */
     if (data_ptr->res.native == EDID_NOT_NATIVE) {
-        idx = dtd_start;
-        while (idx < dtd_start + (4 * 18)) {
-            parse_dtd(&bytes[idx], data_ptr, (data_ptr->res.native == EDID_NOT_NATIVE));
-            idx += 18;
+        for (size_t idx = dtd_start; idx + EDID_DTD_SIZE <= EDID_BLOCK_SIZE - 1; idx += EDID_DTD_SIZE) {
+            parse_dtd(subspan(block, idx, EDID_DTD_SIZE), data_ptr, (data_ptr->res.native == EDID_NOT_NATIVE));
         }
     }
 }
 
-static void parse_est_timing(unsigned char b1, unsigned char b2, unsigned char b3, edid_data_t* data_ptr) {
-    int width = 0;
-    int height = 0;
-    int refresh = 0;
-    char progressive = 1;
-    if ((b1 & 0x01) == 0x01) {
-        width = 800;
-        height = 600;
-        refresh = 60;
-    }
-    if ((b1 & 0x02) == 0x02) {
-        width = 800;
-        height = 600;
-        refresh = 56;
-    }
-    if ((b1 & 0x04) == 0x04) {
-        width = 640;
-        height = 480;
-        refresh = 75;
-    }
-    if ((b1 & 0x08) == 0x08) {
-        width = 640;
-        height = 480;
-        refresh = 72;
-    }
-    if ((b1 & 0x10) == 0x10) {
-        width = 640;
-        height = 480;
-        refresh = 67;
-    }
-    if ((b1 & 0x20) == 0x20) {
-        width = 640;
-        height = 480;
-        refresh = 60;
-    }
-    if ((b1 & 0x40) == 0x40) {
-        width = 720;
-        height = 400;
-        refresh = 88;
-    }
-    if ((b1 & 0x80) == 0x80) {
-        width = 720;
-        height = 400;
-        refresh = 70;
-    }
-    if ((b2 & 0x01) == 0x01) {
-        width = 1280;
-        height = 1024;
-        refresh = 75;
-    }
-    if ((b2 & 0x02) == 0x02) {
-        width = 1024;
-        height = 768;
-        refresh = 75;
-    }
-    if ((b2 & 0x04) == 0x04) {
-        width = 1024;
-        height = 768;
-        refresh = 70;
-    }
-    if ((b2 & 0x08) == 0x08) {
-        width = 1024;
-        height = 768;
-        refresh = 60;
-    }
-    if ((b2 & 0x10) == 0x10) {
-        width = 1024;
-        height = 768;
-        refresh = 87;
-        progressive = 0;
-    }
-    if ((b2 & 0x20) == 0x20) {
-        width = 832;
-        height = 624;
-        refresh = 75;
-    }
-    if ((b2 & 0x40) == 0x40) {
-        width = 800;
-        height = 600;
-        refresh = 75;
-    }
-    if ((b2 & 0x80) == 0x80) {
-        width = 800;
-        height = 600;
-        refresh = 72;
-    }
-    if ((b3 & 0x80) == 0x80) {
-        width = 1152;
-        height = 870;
-        refresh = 75;
-    }
-
-    INT_DEBUG("EST %dx%d%c@%d\n", width, height, progressive ? 'p' : 'i', refresh);
-
-    UNUSED(width);
-    UNUSED(height);
-    UNUSED(progressive);
-    UNUSED(refresh);
-}
-
 // bytes length needs to be (at least) 128
-int block_checksum_ok(unsigned char* bytes) {
+int block_checksum_ok(const unsigned char* bytes) {
     // CTA-861-G_FINAL_revised_2017.pdf:
     //  Checksum byte = (256-(S%256)) %256
     //  Where:
@@ -520,27 +576,20 @@ int block_checksum_ok(unsigned char* bytes) {
     return bytes[127] == (256 - (sum % 256)) % 256;
 }
 
-edid_status_e parse_extension_block(uint32_t base_idx, unsigned char* bytes, edid_data_t* data_ptr)
+static edid_status_e parse_extension_block(parse_ctx_t& ctx, edid_span_t block)
 {
-    int ext_tag = bytes[base_idx];
+    int ext_tag = byte_at(block, 0);
     // skiping revision number
 
     switch (ext_tag) {
-        // LCD timing
-        case LCD_TIMING: break;
         // Additional timing
-        case ADDITIONAL_TIMING: parse_ext_timing(&bytes[base_idx + 2], data_ptr);break;
-        // EDID 2.0 extension
-        case EDID20_EXTENSION: break;
-        // Color information type
-        case COLOR_INFORMATION_TYPE: break;
-        // DVI feature data
-        case DVI_FEATURE_DATA: break;
-        // Touch screen data
-        case TOUCH_SCREEN_DATA: break;
-        // Block Map
-        case EXTENSION_TAG_BLOCK_MAP: break;
-        // Manufacturer extension
+        case ADDITIONAL_TIMING: parse_ext_timing(ctx, block); break;
+        case LCD_TIMING:
+        case EDID20_EXTENSION:
+        case COLOR_INFORMATION_TYPE:
+        case DVI_FEATURE_DATA:
+        case TOUCH_SCREEN_DATA:
+        case EXTENSION_TAG_BLOCK_MAP:
         case MANUFACTURER_EXTENSION: break;
         default: INT_DEBUG("Unsupported tag: 0x%X\n", ext_tag);
     }
@@ -548,10 +597,10 @@ edid_status_e parse_extension_block(uint32_t base_idx, unsigned char* bytes, edi
     return EDID_STATUS_OK;
 }
 
-edid_status_e parse_extension_blocks(uint32_t extensions, unsigned char* bytes, size_t count, edid_data_t* data_ptr)
+static edid_status_e parse_extension_blocks(parse_ctx_t& ctx, uint32_t extensions, edid_span_t edid)
 {
-    if (count < 128 * (1 + extensions)) {
-        INT_ERROR("parse_extension_blocks: too short for extension count - count:%zu extensions:%u\n",count,extensions);
+    if (edid.size < EDID_BLOCK_SIZE * (1 + extensions)) {
+        INT_ERROR("parse_extension_blocks: too short for extension count - count:%zu extensions:%u\n", edid.size, extensions);
         return EDID_STATUS_INVALID_HEADER;
     }
 
@@ -560,15 +609,15 @@ edid_status_e parse_extension_blocks(uint32_t extensions, unsigned char* bytes,
         devices into consideration. For example, when a Source finds an extension count of 2, it may
         attempt to read 3 extensions on the chance that the Sink has incorrectly set its count"
     */
-    if (count == 128 * (2 + extensions)) {
+    if (edid.size == EDID_BLOCK_SIZE * (2 + extensions)) {
         // there is 1 more block (128 bytes) than would seem from extensions count
         // assume we are handling 'incorrectly designed' device & attempt to read 1 more extension
-        INT_WARN("extensions:%d, but count: %zu - increase extension cnt\n", extensions, count);
+        INT_WARN("extensions:%d, but count: %zu - increase extension cnt\n", extensions, edid.size);
         ++extensions;
     }
 
     // extension tag
-    const int first_ext_tag = bytes[128];
+    const int first_ext_tag = edid.data[EDID_BLOCK_SIZE];
     uint32_t extension_block_idx = 0;
 
     if (extensions > 1 ) {
@@ -584,74 +633,72 @@ edid_status_e parse_extension_blocks(uint32_t extensions, unsigned char* bytes,
     edid_status_e ret = EDID_STATUS_OK;
 
     for ( ; extension_block_idx < extensions; ++extension_block_idx) {
-        const uint32_t base_idx = (1 + extension_block_idx) * 128;
-        ret = parse_extension_block(base_idx, bytes, data_ptr);
+        ret = parse_extension_block(ctx, subspan(edid, (1 + extension_block_idx) * EDID_BLOCK_SIZE, EDID_BLOCK_SIZE));
         if (ret != EDID_STATUS_OK) break;
+        // HDMI 2.1 HF-EEODB in the first CTA block overrides the base block extension count
+        if ((extension_block_idx == 0) && (ctx.eeodb_count > extensions) &&
+            (edid.size >= (size_t)EDID_BLOCK_SIZE * (1 + ctx.eeodb_count))) {
+            extensions = ctx.eeodb_count;
+        }
     }
 
     return ret;
 }
 
-#define SET_LETTER(x) ( isprint((x) + '@')  ? (x) + '@' : '\0')
-
-static void parse_manufacturer_name(uint8_t b1, uint8_t b2, edid_data_t* data_ptr)
-{
-    data_ptr->manufacturer_name[0] = SET_LETTER((b1 & 0x7C) >> 2);
-    data_ptr->manufacturer_name[1] = SET_LETTER(((b1 & 0x03) << 3) | ((b2 & 0xE0) >> 5));
-    data_ptr->manufacturer_name[2] = SET_LETTER(b2 & 0x1F);
-    data_ptr->manufacturer_name[3] = '\0';
-    INT_DEBUG("Manufacturer name:'%s'\n", data_ptr->manufacturer_name);
-}
-
-static void parse_product_code(uint8_t b1, uint8_t b2, edid_data_t* data_ptr)
-{
-    data_ptr->product_code =  (((int32_t)b1 << 8) | (int32_t)b2);
-    INT_DEBUG("Product code:%d\n", data_ptr->product_code);
-}
-
-static void parse_serial_number(uint8_t* serial_ptr, edid_data_t* data_ptr)
-{
-    data_ptr->serial_number = ((int32_t)serial_ptr[0] << 24) | ((int32_t)serial_ptr[1] << 16) | ((int32_t)serial_ptr[2] << 8) | ((int32_t)serial_ptr[3]);
-    INT_DEBUG("Serial number:%d\n", data_ptr->serial_number);
-}
-
-static void parse_manufacture_week(uint8_t b1, edid_data_t* data_ptr)
-{
-    data_ptr->manufacture_week = b1;
-    INT_DEBUG("Manufacture week:%d\n", data_ptr->manufacture_week);
+/* Mark the 4:2:0 capable SVDs once all Video and Capability Map Data Blocks are known */
+static void resolve_ycbcr420_map(parse_ctx_t& ctx) {
+    edid_data_t* data_ptr = ctx.data;
+    for (size_t i = 0; i < data_ptr->svd_count; i++) {
+        if ((data_ptr->svd[i] != 0) && (ctx.cmdb_all || ((ctx.cmdb_map[i >> 3] >> (i & 7)) & 1))) {
+            set_vic_bit(data_ptr->ycbcr420_capable, data_ptr->svd[i]);
+        }
+    }
 }
 
-static void parse_manufacture_year(uint8_t b1, edid_data_t* data_ptr)
-{
-    data_ptr->manufacture_year = b1;
-    INT_DEBUG("Manufacture year:%d\n", data_ptr->manufacture_year);
-}
+#define SET_LETTER(x) ( isprint((x) + '@')  ? (x) + '@' : '\0')
 
-static void parse_edid_version(uint8_t b1, uint8_t b2, edid_data_t* data_ptr)
+static void parse_vendor_product(edid_span_t bytes, edid_data_t* data_ptr)
 {
-    data_ptr->edid_version[0] = b1;
-    data_ptr->edid_version[1] = b2;
-    INT_DEBUG("EDID version:%d.%d\n", data_ptr->edid_version[0], data_ptr->edid_version[1]);
+    const uint8_t* b = bytes.data;
+    data_ptr->manufacturer_name[0] = SET_LETTER((b[0] & 0x7C) >> 2);
+    data_ptr->manufacturer_name[1] = SET_LETTER(((b[0] & 0x03) << 3) | ((b[1] & 0xE0) >> 5));
+    data_ptr->manufacturer_name[2] = SET_LETTER(b[1] & 0x1F);
+    data_ptr->manufacturer_name[3] = '\0';
+    data_ptr->product_code = (((int32_t)b[2] << 8) | (int32_t)b[3]);
+    data_ptr->serial_number = ((int32_t)b[4] << 24) | ((int32_t)b[5] << 16) | ((int32_t)b[6] << 8) | ((int32_t)b[7]);
+    data_ptr->manufacture_week = b[8];
+    data_ptr->manufacture_year = b[9];
+    data_ptr->edid_version[0] = b[10];
+    data_ptr->edid_version[1] = b[11];
+    INT_DEBUG("Manufacturer name:'%s' product code:%d serial number:%d week:%d year:%d EDID version:%d.%d\n",
+          data_ptr->manufacturer_name, data_ptr->product_code, data_ptr->serial_number,
+          data_ptr->manufacture_week, data_ptr->manufacture_year, data_ptr->edid_version[0], data_ptr->edid_version[1]);
 }
 
-edid_status_e EDID_Verify(unsigned char* bytes, size_t count) {
-    if (!bytes || count < 128) {
+edid_status_e EDID_Verify(edid_span_t edid) {
+    if (!edid.data || edid.size < EDID_BLOCK_SIZE) {
         return EDID_STATUS_INVALID_PARAMETER;
     }
     static const unsigned char header[8] = {0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00};
-    if (memcmp(bytes, header, sizeof(header)) != 0) {
+    if (memcmp(edid.data, header, sizeof(header)) != 0) {
+        const uint8_t* bytes = edid.data;
         INT_ERROR("Incorrect input, header does not match: %02x %02x %02x %02x %02x %02x %02x %02x\n", bytes[0], bytes[1], bytes[2], bytes[3], bytes[4], bytes[5], bytes[6], bytes[7]);
         return EDID_STATUS_INVALID_HEADER;
     }
     return EDID_STATUS_OK;
 }
 
-edid_status_e EDID_Parse(unsigned char* bytes, size_t count, edid_data_t* data_ptr) {
+edid_status_e EDID_Verify(unsigned char* bytes, size_t count) {
+    edid_span_t edid = { bytes, count };
+    return EDID_Verify(edid);
+}
+
+edid_status_e EDID_Parse(edid_span_t edid, edid_data_t* data_ptr) {
     if (!data_ptr) {
         INT_ERROR("Incorrect input, data_ptr null\n");
         return EDID_STATUS_INVALID_PARAMETER;
     }
-    edid_status_e verify_status = EDID_Verify(bytes, count);
+    edid_status_e verify_status = EDID_Verify(edid);
     if (verify_status != EDID_STATUS_OK) {
         return verify_status;
     }
@@ -659,47 +706,39 @@ edid_status_e EDID_Parse(unsigned char* bytes, size_t count, edid_data_t* data_p
     memset(data_ptr, 0, sizeof(edid_data_t));
     data_ptr->res.native = EDID_NOT_NATIVE;
 
-    int idx = 0;
-
-    idx += 8;
-    // vendor / product ID
-    parse_manufacturer_name(bytes[idx], bytes[idx + 1], data_ptr);
-    parse_product_code(bytes[idx + 2], bytes[idx + 3], data_ptr);
-    parse_serial_number(&bytes[idx + 4], data_ptr);
-    parse_manufacture_week(bytes[idx + 8], data_ptr);
-    parse_manufacture_year(bytes[idx + 9], data_ptr);
-    idx += 10;
-    // EDID version (version, revision)
-    parse_edid_version(bytes[idx], bytes[idx + 1], data_ptr);
-    idx += 2;
-    // basics
-    idx += 5;
-    // colors
-    idx += 10;
-    // established timings
-    parse_est_timing(bytes[idx], bytes[idx + 1], bytes[idx + 2], data_ptr);
-    idx += 3;
+    parse_ctx_t ctx;
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.data = data_ptr;
+    ctx.cta_native.native = EDID_NOT_NATIVE;
+
+    // vendor / product ID, EDID version (version, revision)
+    parse_vendor_product(subspan(edid, 8, 12), data_ptr);
+    // basics, colors; established timings
+    parse_est_timing(subspan(edid, 35, 3), data_ptr);
     // standard timing ID
-    for (int i = idx; i < idx + 16; i += 2) {
-        parse_std_timing(&bytes[i], data_ptr);
+    for (size_t i = 38; i < 54; i += 2) {
+        parse_std_timing(subspan(edid, i, 2));
     }
-    idx += 16;
-    // detailed timing descriptions
-    for (int i = idx; i < idx + 72; i += 18) {
-        parse_dtd(&bytes[i], data_ptr, i == idx);
+    // detailed timing descriptions, the first one is the preferred timing
+    for (size_t i = 54; i < 126; i += EDID_DTD_SIZE) {
+        parse_dtd(subspan(edid, i, EDID_DTD_SIZE), data_ptr, i == 54);
     }
-    idx += 72;
     // extension flag
-    int extension = bytes[idx];
-    idx += 2;
+    int extension = edid.data[126];
 
     edid_status_e ret = EDID_STATUS_OK;
 
     // parse extension blocks, if any
     if (extension > 0)
     {
-        ret = parse_extension_blocks(extension,bytes,count,data_ptr);
+        ret = parse_extension_blocks(ctx, extension, edid);
     }
+    resolve_ycbcr420_map(ctx);
     return ret;
 }
+
+edid_status_e EDID_Parse(unsigned char* bytes, size_t count, edid_data_t* data_ptr) {
+    edid_span_t edid = { bytes, count };
+    return EDID_Parse(edid, data_ptr);
+}
 }
@@ -35,8 +35,10 @@
 
 #include <iostream>
 #include <unistd.h>
+#include <string.h>
 #include "dsError.h"
 #include "dsUtl.h"
+#include "dsInternal.h"
 #include "frontPanelConfig.hpp"
 #include "frontPanelSettings.hpp"
 #include "illegalArgumentException.hpp"
@@ -504,6 +506,88 @@ void FrontPanelConfig::load(fpdConfigs_t* dynamicFPDConfigs)
     return;
 }
 
+FrontPanelConfig::IndicatorScene &FrontPanelConfig::IndicatorScene::setState(int id, bool enable)
+{
+    Settings &settings = _settings[id];
+    settings.mask |= kState;
+    settings.state = enable;
+    return *this;
+}
+
+FrontPanelConfig::IndicatorScene &FrontPanelConfig::IndicatorScene::setColor(int id, uint32_t color)
+{
+    Settings &settings = _settings[id];
+    settings.mask |= kColor;
+    settings.color = color;
+    return *this;
+}
+
+FrontPanelConfig::IndicatorScene &FrontPanelConfig::IndicatorScene::setBrightness(int id, int brightness)
+{
+    Settings &settings = _settings[id];
+    settings.mask |= kBrightness;
+    settings.brightness = brightness;
+    return *this;
+}
+
+FrontPanelConfig::IndicatorScene &FrontPanelConfig::IndicatorScene::setBlink(int id, const FrontPanelIndicator::Blink &blink)
+{
+    Settings &settings = _settings[id];
+    settings.mask |= kBlink;
+    settings.blink = blink;
+    return *this;
+}
+
+/**
+ * @fn FrontPanelConfig::applyIndicatorScene(const IndicatorScene &scene, bool toPersist)
+ * @brief This API applies the settings of several indicators with one call to dsMgr.
+ *
+ * @param[in] scene Settings of the indicators to change.
+ * @param[in] toPersist If true, the power indicator brightness and color are persisted.
+ *
+ * @return None
+ */
+void FrontPanelConfig::applyIndicatorScene(const IndicatorScene &scene, bool toPersist)
+{
+    dsFPDIndicatorScene_t indicators[dsFPD_INDICATOR_MAX];
+    memset(indicators, 0, sizeof(indicators));
+
+    std::map<int, IndicatorScene::Settings>::const_iterator it;
+    for (it = scene._settings.begin(); it != scene._settings.end(); ++it) {
+        if ((it->first < 0) || (it->first >= dsFPD_INDICATOR_MAX)) {
+            throw IllegalArgumentException("Bad indicator id");
+        }
+        const IndicatorScene::Settings &settings = it->second;
+        dsFPDIndicatorScene_t &indicator = indicators[it->first];
+        if (settings.mask & IndicatorScene::kState) {
+            indicator.mask |= DS_FPD_SCENE_STATE;
+            indicator.state = settings.state ? dsFPD_STATE_ON : dsFPD_STATE_OFF;
+        }
+        if (settings.mask & IndicatorScene::kColor) {
+            indicator.mask |= DS_FPD_SCENE_COLOR;
+            indicator.color = (dsFPDColor_t)settings.color;
+        }
+        if (settings.mask & IndicatorScene::kBrightness) {
+            if (settings.brightness < 0) {
+                throw IllegalArgumentException("Bad brightness");
+            }
+            indicator.mask |= DS_FPD_SCENE_BRIGHTNESS;
+            indicator.brightness = (dsFPDBrightness_t)settings.brightness;
+        }
+        if (settings.mask & IndicatorScene::kBlink) {
+            /* In the order FrontPanelIndicator::setBlink() passes them */
+            indicator.mask |= DS_FPD_SCENE_BLINK;
+            indicator.blinkDuration = settings.blink.getIteration();
+            indicator.blinkIterations = settings.blink.getInterval();
+        }
+    }
+
+    dsError_t ret = dsSetFPIndicatorScene(indicators, toPersist);
+    if (ret != dsERR_NONE) {
+        throw Exception(ret);
+    }
+}
+
 }
 
 /** @} */
@@ -36,6 +36,7 @@
 
 #include <iostream>
 #include <sstream>
+#include <string.h>
 
 #include "frontPanelTextDisplay.hpp"
 #include "frontPanelConfig.hpp"
@@ -45,6 +46,7 @@
 #include "dslogger.h"
 #include "dsError.h"
 #include "dsTypes.h"
+#include "dsInternal.h"
 
 using namespace std;
 
@@ -413,6 +415,140 @@ void FrontPanelTextDisplay::setMode(int mode)
 }
 
 
+
+static void copyFrame(char *frame, const std::string &text)
+{
+    if (text.size() >= DS_FPD_ANIM_TEXT_MAX) {
+        throw IllegalArgumentException();
+    }
+    text.copy(frame, text.size());
+    frame[text.size()] = '\0';
+}
+
+static unsigned int startAnimation(const dsFPDAnimation_t &animation)
+{
+    unsigned int handle = 0;
+    dsError_t ret = dsFPStartAnimation(&animation, &handle);
+    if (ret != dsERR_NONE) {
+        throw Exception(ret);
+    }
+    return handle;
+}
+
+/**
+ * @fn FrontPanelTextDisplay::startScroll(const std::string &text, int width, int stepMs, int iterations)
+ * @brief This API scrolls text through a width character window, one character every stepMs.
+ *
+ * @return Handle of the animation
+ */
+unsigned int FrontPanelTextDisplay::startScroll(const std::string &text, int width, int stepMs, int iterations)
+{
+    if (text.empty() || (width <= 0) || (stepMs <= 0) || (iterations < 0)) {
+        throw IllegalArgumentException();
+    }
+    dsFPDAnimation_t animation;
+    memset(&animation, 0, sizeof(animation));
+    animation.type = dsFPD_ANIM_SCROLL;
+    animation.stepMs = stepMs;
+    animation.iterations = iterations;
+    animation.width = width;
+    animation.nFrames = 1;
+    copyFrame(animation.frames[0], text);
+    return startAnimation(animation);
+}
+
+/**
+ * @fn FrontPanelTextDisplay::startBlink(const std::string &text, unsigned int pattern, int steps, int stepMs, int iterations)
+ * @brief This API blinks text: on step i of steps (at most 32) the text is shown if bit i of pattern is set.
+ *
+ * @return Handle of the animation
+ */
+unsigned int FrontPanelTextDisplay::startBlink(const std::string &text, unsigned int pattern, int steps, int stepMs, int iterations)
+{
+    if ((steps <= 0) || (steps > 32) || (stepMs <= 0) || (iterations < 0)) {
+        throw IllegalArgumentException();
+    }
+    dsFPDAnimation_t animation;
+    memset(&animation, 0, sizeof(animation));
+    animation.type = dsFPD_ANIM_BLINK;
+    animation.stepMs = stepMs;
+    animation.iterations = iterations;
+    animation.blinkPattern = pattern;
+    animation.blinkSteps = steps;
+    animation.nFrames = 1;
+    copyFrame(animation.frames[0], text);
+    return startAnimation(animation);
+}
+
+/**
+ * @fn FrontPanelTextDisplay::startCountdown(int seconds)
+ * @brief This API counts down from seconds to 0, shown as "SS" or "MM:SS".
+ *
+ * @return Handle of the animation
+ */
+unsigned int FrontPanelTextDisplay::startCountdown(int seconds)
+{
+    if (seconds <= 0) {
+        throw IllegalArgumentException();
+    }
+    dsFPDAnimation_t animation;
+    memset(&animation, 0, sizeof(animation));
+    animation.type = dsFPD_ANIM_COUNTDOWN;
+    animation.countdownSec = seconds;
+    return startAnimation(animation);
+}
+
+/**
+ * @fn FrontPanelTextDisplay::startFrames(const std::vector<std::string> &frames, int stepMs, int iterations)
+ * @brief This API shows up to DS_FPD_ANIM_FRAMES_MAX frames in turn, each for stepMs.
+ *
+ * @return Handle of the animation
+ */
+unsigned int FrontPanelTextDisplay::startFrames(const std::vector<std::string> &frames, int stepMs, int iterations)
+{
+    if (frames.empty() || (frames.size() > DS_FPD_ANIM_FRAMES_MAX) || (stepMs <= 0) || (iterations < 0)) {
+        throw IllegalArgumentException();
+    }
+    dsFPDAnimation_t animation;
+    memset(&animation, 0, sizeof(animation));
+    animation.type = dsFPD_ANIM_FRAMES;
+    animation.stepMs = stepMs;
+    animation.iterations = iterations;
+    animation.nFrames = frames.size();
+    for (size_t i = 0; i < frames.size(); i++) {
+        copyFrame(animation.frames[i], frames[i]);
+    }
+    return startAnimation(animation);
+}
+
+/**
+ * @fn FrontPanelTextDisplay::cancelAnimation(unsigned int handle)
+ * @brief This API stops the animation handle, or all animations for 0.
+ *
+ * @return None
+ */
+void FrontPanelTextDisplay::cancelAnimation(unsigned int handle)
+{
+    dsError_t ret = dsFPCancelAnimation(handle);
+    if (ret != dsERR_NONE) {
+        throw Exception(ret);
+    }
+}
+
+/**
+ * @fn FrontPanelTextDisplay::setAutoClock(bool enable)
+ * @brief This API enables or disables the clock updates done by dsMgr itself.
+ *
+ * @return None
+ */
+void FrontPanelTextDisplay::setAutoClock(bool enable)
+{
+    dsError_t ret = dsFPSetAutoClock(enable);
+    if (ret != dsERR_NONE) {
+        throw Exception(ret);
+    }
+}
+
 }
 
 /** @} */
@@ -484,7 +484,7 @@ void HdmiInput::getCurrentVideoModeObj (dsVideoPortResolution_t& resolution)
 void HdmiInput::getEDIDBytesInfo (int iHdmiPort, std::vector<uint8_t> &edidArg) const
 {
 
-    INT_INFO("HdmiInput::getEDIDBytesInfo");
+    INT_INFO_RL("HdmiInput::getEDIDBytesInfo");
 
     dsError_t ret = dsERR_NONE;
     int length = 0;
@@ -493,10 +493,10 @@ void HdmiInput::getEDIDBytesInfo (int iHdmiPort, std::vector<uint8_t> &edidArg)
     const char* exceptionstr = "";
     ret = dsGetEDIDBytesInfo (static_cast<dsHdmiInPort_t>(iHdmiPort), edid, &length);
 
-    INT_INFO("HdmiInput::getEDIDBytesInfo has ret %d", ret);
+    INT_INFO_RL("HdmiInput::getEDIDBytesInfo has ret %d", ret);
     if (ret == dsERR_NONE) {
         if (length <= MAX_EDID_BYTES_LEN) {
-            INT_INFO("HdmiInput::getEDIDBytesInfo has %d bytes", length);
+            INT_INFO_RL("HdmiInput::getEDIDBytesInfo has %d bytes", length);
             if (edid_parser::EDID_STATUS_OK == edid_parser::EDID_Verify(edid, length)) {
                 edidArg.clear();
                 edidArg.insert(edidArg.begin(), edid, edid + length);
@@ -678,6 +678,48 @@ void HdmiInput::getHdmiVersion (int iHdmiPort, dsHdmiMaxCapabilityVersion_t *cap
     INT_INFO("HDMI Compatibility Version = %d", *capversion);
 }
 
+/**
+ * @fn  HdmiInput::getAllPortsStatus(AllPortsStatus &status)
+ * @brief This API gets the status of every HDMI Input port with a single
+ *        call to dsMgr, which serves it without calling the HAL. Use it
+ *        instead of the per port getters to refresh an input switcher.
+ *
+ * @param[out] status Active port, AV latency and the status of each port
+ *
+ * @return None
+ */
+void HdmiInput::getAllPortsStatus (AllPortsStatus &status) const
+{
+    dsHdmiInAllPortsStatus_t allPorts;
+    dsError_t ret = dsHdmiInGetAllPortsStatus (&allPorts);
+    if (ret != dsERR_NONE)
+    {
+        throw Exception(ret);
+    }
+
+    status.activePort = allPorts.activePort;
+    status.isPresented = allPorts.isPresented;
+    status.audioLatency = allPorts.audioLatency;
+    status.videoLatency = allPorts.videoLatency;
+    status.ports.clear();
+    for (int i = 0; (i < allPorts.numPorts) && (i < dsHDMI_IN_PORT_MAX); i++) {
+        const dsHdmiInPortStatus_t &src = allPorts.ports[i];
+        PortStatus port;
+        port.isConnected = src.isConnected;
+        port.isArcCapable = src.isArcCapable;
+        port.signalStatus = src.signalStatus;
+        port.resolution = src.resolution;
+        port.allmMode = src.allmMode;
+        port.vrrType = src.vrrType;
+        port.aviContentType = src.aviContentType;
+        port.edidVersion = static_cast<int>(src.edidVersion);
+        port.edidAllmSupport = src.edidAllmSupport;
+        port.vrrSupport = src.vrrSupport;
+        port.hdmiVersion = src.hdmiVersion;
+        status.ports.push_back(port);
+    }
+}
+
 dsError_t HdmiInput::getHDMIARCPortId(int &portId) {
     dsError_t error = dsERR_GENERAL;
     error = dsGetHDMIARCPortId(&portId);
@@ -5,10 +5,12 @@
 
 #include "IarmImpl.hpp"
 
+#include "dsEventTrace.h"
 #include "dsMgr.h"
 #include "dslogger.h"
 
 #include "libIBus.h"
+#include "videoOutputPortConfig.hpp"
 
 namespace device {
 
@@ -57,6 +59,32 @@ static bool registerIarmEvents(const EventHandlerMapping (&handlers)[N])
     return registered;
 }
 
+// IARM event currently being dispatched on this thread, used to tag per listener trace records
+static thread_local int s_traceEventId = -1;
+
+// Records IARM handler entry on construction and dispatch completion on destruction
+class EventTraceScope {
+public:
+    explicit EventTraceScope(IARM_EventId_t eventId)
+        : m_prevEventId(s_traceEventId)
+    {
+        dsEventTraceRecord(dsEVENT_TRACE_IARM_HANDLER, eventId, 0);
+        s_traceEventId = eventId;
+    }
+
+    ~EventTraceScope()
+    {
+        dsEventTraceRecord(dsEVENT_TRACE_DISPATCH_DONE, s_traceEventId, 0);
+        s_traceEventId = m_prevEventId;
+    }
+
+    EventTraceScope(const EventTraceScope&)            = delete;
+    EventTraceScope& operator=(const EventTraceScope&) = delete;
+
+private:
+    int m_prevEventId;
+};
+
 inline bool isValidOwner(const char* owner)
 {
     if (std::string(IARM_BUS_DSMGR_NAME) != std::string(owner)) {
@@ -84,7 +112,8 @@ public:
 private:
     static void iarmDisplayFrameratePreChangeHandler(const char* owner, IARM_EventId_t eventId, void* data, size_t)
     {
-        INT_INFO("IARM_BUS_DSMGR_EVENT_DISPLAY_FRAMRATE_PRECHANGE received owner = %s, eventId = %d", owner, eventId);
+        EventTraceScope traceScope(eventId);
+        INT_INFO_RL("IARM_BUS_DSMGR_EVENT_DISPLAY_FRAMRATE_PRECHANGE received owner = %s, eventId = %d", owner, eventId);
 
         if (!isValidOwner(owner)) {
             return;
@@ -105,7 +134,8 @@ private:
 
     static void iarmDisplayFrameratePostChangeHandler(const char* owner, IARM_EventId_t eventId, void* data, size_t)
     {
-        INT_INFO("IARM_BUS_DSMGR_EVENT_DISPLAY_FRAMRATE_POSTCHANGE received owner = %s, eventId = %d", owner, eventId);
+        EventTraceScope traceScope(eventId);
+        INT_INFO_RL("IARM_BUS_DSMGR_EVENT_DISPLAY_FRAMRATE_POSTCHANGE received owner = %s, eventId = %d", owner, eventId);
 
         if (!isValidOwner(owner)) {
             return;
@@ -126,7 +156,8 @@ private:
 
     static void iarmZoomSettingsChangedHandler(const char* owner, IARM_EventId_t eventId, void* data, size_t)
     {
-        INT_INFO("IARM_BUS_DSMGR_EVENT_ZOOM_SETTINGS received owner = %s, eventId = %d", owner, eventId);
+        EventTraceScope traceScope(eventId);
+        INT_INFO_RL("IARM_BUS_DSMGR_EVENT_ZOOM_SETTINGS received owner = %s, eventId = %d", owner, eventId);
 
         if (!isValidOwner(owner)) {
             return;
@@ -167,7 +198,8 @@ public:
 private:
     static void iarmResolutionPreChangeHandler(const char* owner, IARM_EventId_t eventId, void* data, size_t)
     {
-        INT_INFO("IARM_BUS_DSMGR_EVENT_RES_PRECHANGE received owner = %s, eventId = %d", owner, eventId);
+        EventTraceScope traceScope(eventId);
+        INT_INFO_RL("IARM_BUS_DSMGR_EVENT_RES_PRECHANGE received owner = %s, eventId = %d", owner, eventId);
 
         if (!isValidOwner(owner)) {
             return;
@@ -189,7 +221,8 @@ private:
 
     static void iarmResolutionPostChangeHandler(const char* owner, IARM_EventId_t eventId, void* data, size_t)
     {
-        INT_INFO("IARM_BUS_DSMGR_EVENT_RES_POSTCHANGE received owner = %s, eventId = %d", owner, eventId);
+        EventTraceScope traceScope(eventId);
+        INT_INFO_RL("IARM_BUS_DSMGR_EVENT_RES_POSTCHANGE received owner = %s, eventId = %d", owner, eventId);
 
         if (!isValidOwner(owner)) {
             return;
@@ -211,7 +244,8 @@ private:
 
     static void iarmHDCPStatusChangeHandler(const char* owner, IARM_EventId_t eventId, void* data, size_t)
     {
-        INT_INFO("IARM_BUS_DSMGR_EVENT_HDCP_STATUS received owner = %s, eventId = %d", owner, eventId);
+        EventTraceScope traceScope(eventId);
+        INT_INFO_RL("IARM_BUS_DSMGR_EVENT_HDCP_STATUS received owner = %s, eventId = %d", owner, eventId);
 
         if (!isValidOwner(owner)) {
             return;
@@ -231,7 +265,8 @@ private:
 
     static void iarmVideoFormatUpdateHandler(const char* owner, IARM_EventId_t eventId, void* data, size_t)
     {
-        INT_INFO("IARM_BUS_DSMGR_EVENT_VIDEO_FORMAT_UPDATE received owner = %s, eventId = %d", owner, eventId);
+        EventTraceScope traceScope(eventId);
+        INT_INFO_RL("IARM_BUS_DSMGR_EVENT_VIDEO_FORMAT_UPDATE received owner = %s, eventId = %d", owner, eventId);
 
         if (!isValidOwner(owner)) {
             return;
@@ -273,7 +308,8 @@ public:
 private:
     static void iarmAssociatedAudioMixingChangedHandler(const char* owner, IARM_EventId_t eventId, void* data, size_t)
     {
-        INT_INFO("IARM_BUS_DSMGR_EVENT_AUDIO_ASSOCIATED_AUDIO_MIXING_CHANGED received owner = %s, eventId = %d", owner, eventId);
+        EventTraceScope traceScope(eventId);
+        INT_INFO_RL("IARM_BUS_DSMGR_EVENT_AUDIO_ASSOCIATED_AUDIO_MIXING_CHANGED received owner = %s, eventId = %d", owner, eventId);
 
         if (!isValidOwner(owner)) {
             return;
@@ -294,7 +330,8 @@ private:
 
     static void iarmAudioFaderControlChangedHandler(const char* owner, IARM_EventId_t eventId, void* data, size_t)
     {
-        INT_INFO("IARM_BUS_DSMGR_EVENT_AUDIO_FADER_CONTROL_CHANGED received owner = %s, eventId = %d", owner, eventId);
+        EventTraceScope traceScope(eventId);
+        INT_INFO_RL("IARM_BUS_DSMGR_EVENT_AUDIO_FADER_CONTROL_CHANGED received owner = %s, eventId = %d", owner, eventId);
 
         if (!isValidOwner(owner)) {
             return;
@@ -315,7 +352,8 @@ private:
 
     static void iarmAudioPrimaryLanguageChangedHandler(const char* owner, IARM_EventId_t eventId, void* data, size_t)
     {
-        INT_INFO("IARM_BUS_DSMGR_EVENT_AUDIO_PRIMARY_LANGUAGE_CHANGED received owner = %s, eventId = %d", owner, eventId);
+        EventTraceScope traceScope(eventId);
+        INT_INFO_RL("IARM_BUS_DSMGR_EVENT_AUDIO_PRIMARY_LANGUAGE_CHANGED received owner = %s, eventId = %d", owner, eventId);
 
         if (!isValidOwner(owner)) {
             return;
@@ -336,7 +374,8 @@ private:
 
     static void iarmAudioSecondaryLanguageChangedHandler(const char* owner, IARM_EventId_t eventId, void* data, size_t)
     {
-        INT_INFO("IARM_BUS_DSMGR_EVENT_AUDIO_SECONDARY_LANGUAGE_CHANGED received owner = %s, eventId = %d", owner, eventId);
+        EventTraceScope traceScope(eventId);
+        INT_INFO_RL("IARM_BUS_DSMGR_EVENT_AUDIO_SECONDARY_LANGUAGE_CHANGED received owner = %s, eventId = %d", owner, eventId);
 
         if (!isValidOwner(owner)) {
             return;
@@ -357,7 +396,8 @@ private:
 
     static void iarmAudioOutHotPlugHandler(const char* owner, IARM_EventId_t eventId, void* data, size_t)
     {
-        INT_INFO("IARM_BUS_DSMGR_EVENT_AUDIO_OUT_HOTPLUG received owner = %s, eventId = %d", owner, eventId);
+        EventTraceScope traceScope(eventId);
+        INT_INFO_RL("IARM_BUS_DSMGR_EVENT_AUDIO_OUT_HOTPLUG received owner = %s, eventId = %d", owner, eventId);
 
         if (!isValidOwner(owner)) {
             return;
@@ -380,7 +420,8 @@ private:
 
     static void iarmDolbyAtmosCapabilitiesChangedHandler(const char* owner, IARM_EventId_t eventId, void* data, size_t)
     {
-        INT_INFO("IARM_BUS_DSMGR_EVENT_ATMOS_CAPS_CHANGED received owner = %s, eventId = %d", owner, eventId);
+        EventTraceScope traceScope(eventId);
+        INT_INFO_RL("IARM_BUS_DSMGR_EVENT_ATMOS_CAPS_CHANGED received owner = %s, eventId = %d", owner, eventId);
 
         if (!isValidOwner(owner)) {
             return;
@@ -403,7 +444,8 @@ private:
 
     static void iarmAudioPortStateChangedHandler(const char* owner, IARM_EventId_t eventId, void* data, size_t)
     {
-        INT_INFO("IARM_BUS_DSMGR_EVENT_AUDIO_PORT_STATE received owner = %s, eventId = %d", owner, eventId);
+        EventTraceScope traceScope(eventId);
+        INT_INFO_RL("IARM_BUS_DSMGR_EVENT_AUDIO_PORT_STATE received owner = %s, eventId = %d", owner, eventId);
 
         if (!isValidOwner(owner)) {
             return;
@@ -424,7 +466,8 @@ private:
 
     static void iarmAudioModeEventHandler(const char* owner, IARM_EventId_t eventId, void* data, size_t)
     {
-        INT_INFO("IARM_BUS_DSMGR_EVENT_AUDIO_MODE received owner = %s, eventId = %d", owner, eventId);
+        EventTraceScope traceScope(eventId);
+        INT_INFO_RL("IARM_BUS_DSMGR_EVENT_AUDIO_MODE received owner = %s, eventId = %d", owner, eventId);
 
         if (!isValidOwner(owner)) {
             return;
@@ -446,7 +489,8 @@ private:
 
     static void iarmAudioLevelChangedEventHandler(const char* owner, IARM_EventId_t eventId, void* data, size_t)
     {
-        INT_INFO("IARM_BUS_DSMGR_EVENT_AUDIO_LEVEL_CHANGED received owner = %s, eventId = %d", owner, eventId);
+        EventTraceScope traceScope(eventId);
+        INT_INFO_RL("IARM_BUS_DSMGR_EVENT_AUDIO_LEVEL_CHANGED received owner = %s, eventId = %d", owner, eventId);
 
         if (!isValidOwner(owner)) {
             return;
@@ -467,7 +511,8 @@ private:
 
     static void iarmAudioFormatUpdateHandler(const char* owner, IARM_EventId_t eventId, void* data, size_t)
     {
-        INT_INFO("IARM_BUS_DSMGR_EVENT_AUDIO_FORMAT_UPDATE received owner = %s, eventId = %d", owner, eventId);
+        EventTraceScope traceScope(eventId);
+        INT_INFO_RL("IARM_BUS_DSMGR_EVENT_AUDIO_FORMAT_UPDATE received owner = %s, eventId = %d", owner, eventId);
 
         if (!isValidOwner(owner)) {
             return;
@@ -516,7 +561,8 @@ public:
 private:
     static void iarmCompositeInHotPlugHandler(const char* owner, IARM_EventId_t eventId, void* data, size_t)
     {
-        INT_INFO("IARM_BUS_DSMGR_EVENT_COMPOSITE_IN_HOTPLUG received owner = %s, eventId = %d", owner, eventId);
+        EventTraceScope traceScope(eventId);
+        INT_INFO_RL("IARM_BUS_DSMGR_EVENT_COMPOSITE_IN_HOTPLUG received owner = %s, eventId = %d", owner, eventId);
 
         if (!isValidOwner(owner)) {
             return;
@@ -537,7 +583,8 @@ private:
 
     static void iarmCompositeInSignalStatusHandler(const char* owner, IARM_EventId_t eventId, void* data, size_t)
     {
-        INT_INFO("IARM_BUS_DSMGR_EVENT_COMPOSITE_IN_SIGNAL_STATUS received owner = %s, eventId = %d", owner, eventId);
+        EventTraceScope traceScope(eventId);
+        INT_INFO_RL("IARM_BUS_DSMGR_EVENT_COMPOSITE_IN_SIGNAL_STATUS received owner = %s, eventId = %d", owner, eventId);
 
         if (!isValidOwner(owner)) {
             return;
@@ -559,7 +606,8 @@ private:
 
     static void iarmCompositeInStatusHandler(const char* owner, IARM_EventId_t eventId, void* data, size_t)
     {
-        INT_INFO("IARM_BUS_DSMGR_EVENT_COMPOSITE_IN_STATUS received owner = %s, eventId = %d", owner, eventId);
+        EventTraceScope traceScope(eventId);
+        INT_INFO_RL("IARM_BUS_DSMGR_EVENT_COMPOSITE_IN_STATUS received owner = %s, eventId = %d", owner, eventId);
 
         if (!isValidOwner(owner)) {
             return;
@@ -580,7 +628,8 @@ private:
 
     static void iarmCompositeInVideoModeUpdateHandler(const char* owner, IARM_EventId_t eventId, void* data, size_t)
     {
-        INT_INFO("IARM_BUS_DSMGR_EVENT_COMPOSITE_IN_VIDEO_MODE_UPDATE received owner = %s, eventId = %d", owner, eventId);
+        EventTraceScope traceScope(eventId);
+        INT_INFO_RL("IARM_BUS_DSMGR_EVENT_COMPOSITE_IN_VIDEO_MODE_UPDATE received owner = %s, eventId = %d", owner, eventId);
         if (!isValidOwner(owner)) {
             return;
         }
@@ -631,7 +680,8 @@ public:
 private:
     static void iarmDisplayDisplayRxSense(const char* owner, IARM_EventId_t eventId, void* data, size_t)
     {
-        INT_INFO("IARM_BUS_DSMGR_EVENT_RX_SENSE received owner = %s, eventId = %d", owner, eventId);
+        EventTraceScope traceScope(eventId);
+        INT_INFO_RL("IARM_BUS_DSMGR_EVENT_RX_SENSE received owner = %s, eventId = %d", owner, eventId);
 
         if (!isValidOwner(owner)) {
             return;
@@ -659,28 +709,19 @@ class IARMGroupDisplayDevice {
 public:
     static bool RegisterIarmEvents()
     {
-        IARM_Result_t result = IARM_Bus_RegisterEventHandler(IARM_BUS_DSMGR_NAME, IARM_BUS_DSMGR_EVENT_HDMI_HOTPLUG,
-            &IARMGroupDisplayDevice::iarmDisplayHDMIHotPlugHandler);
-
-        if (IARM_RESULT_SUCCESS != result) {
-            INT_ERROR("Failed to register IARM event handler for IARM_BUS_DSMGR_EVENT_HDMI_HOTPLUG");
-        }
-        return (IARM_RESULT_SUCCESS == result);
+        return registerIarmEvents(handlers);
     }
 
     static bool UnRegisterIarmEvents()
     {
-        IARM_Result_t result = IARM_Bus_UnRegisterEventHandler(IARM_BUS_DSMGR_NAME, IARM_BUS_DSMGR_EVENT_HDMI_HOTPLUG);
-        if (IARM_RESULT_SUCCESS != result) {
-            INT_ERROR("Failed to unregister IARM event handler for IARM_BUS_DSMGR_EVENT_HDMI_HOTPLUG");
-        }
-        return (IARM_RESULT_SUCCESS == result);
+        return unregisterIarmEvents(handlers);
     }
 
 private:
     static void iarmDisplayHDMIHotPlugHandler(const char* owner, IARM_EventId_t eventId, void* data, size_t)
     {
-        INT_INFO("IARM_BUS_DSMGR_EVENT_HDMI_HOTPLUG received owner = %s, eventId = %d", owner, eventId);
+        EventTraceScope traceScope(eventId);
+        INT_INFO_RL("IARM_BUS_DSMGR_EVENT_HDMI_HOTPLUG received owner = %s, eventId = %d", owner, eventId);
 
         if (!isValidOwner(owner)) {
             return;
@@ -698,6 +739,33 @@ private:
             INT_ERROR("Invalid data received for HDMI (out) hot plug change");
         }
     }
+
+    static void iarmDisplayEdidReadyHandler(const char* owner, IARM_EventId_t eventId, void* data, size_t)
+    {
+        EventTraceScope traceScope(eventId);
+        INT_INFO_RL("IARM_BUS_DSMGR_EVENT_EDID_READY received owner = %s, eventId = %d", owner, eventId);
+
+        if (!isValidOwner(owner)) {
+            return;
+        }
+
+        auto* eventData = static_cast<IARM_Bus_DSMgr_EventData_t*>(data);
+
+        if (eventData) {
+            unsigned int generation = eventData->data.edid_ready.generation;
+
+            // Internal to libds, kept out of IDisplayDeviceEvents so its vtable is unchanged
+            VideoOutputPortConfig::edidReady(generation);
+        } else {
+            INT_ERROR("Invalid data received for EDID ready");
+        }
+    }
+
+private:
+    static constexpr EventHandlerMapping handlers[] = {
+        { IARM_BUS_DSMGR_EVENT_HDMI_HOTPLUG, &IARMGroupDisplayDevice::iarmDisplayHDMIHotPlugHandler },
+        { IARM_BUS_DSMGR_EVENT_EDID_READY,   &IARMGroupDisplayDevice::iarmDisplayEdidReadyHandler   },
+    };
 }; /* IARMGroupDisplayDevice */
 
 class IARMGroupHdmiIn {
@@ -715,7 +783,8 @@ public:
 private:
     static void iarmHdmiInEventHotPlugHandler(const char* owner, IARM_EventId_t eventId, void* data, size_t)
     {
-        INT_INFO("IARM_BUS_DSMGR_EVENT_HDMI_IN_HOTPLUG received owner = %s, eventId = %d", owner, eventId);
+        EventTraceScope traceScope(eventId);
+        INT_INFO_RL("IARM_BUS_DSMGR_EVENT_HDMI_IN_HOTPLUG received owner = %s, eventId = %d", owner, eventId);
 
         if (!isValidOwner(owner)) {
             return;
@@ -737,7 +806,8 @@ private:
 
     static void iarmHdmiInEventSignalStatusHandler(const char* owner, IARM_EventId_t eventId, void* data, size_t)
     {
-        INT_INFO("IARM_BUS_DSMGR_EVENT_HDMI_IN_SIGNAL_STATUS received owner = %s, eventId = %d", owner, eventId);
+        EventTraceScope traceScope(eventId);
+        INT_INFO_RL("IARM_BUS_DSMGR_EVENT_HDMI_IN_SIGNAL_STATUS received owner = %s, eventId = %d", owner, eventId);
 
         if (!isValidOwner(owner)) {
             return;
@@ -759,7 +829,8 @@ private:
 
     static void iarmHdmiInEventStatusHandler(const char* owner, IARM_EventId_t eventId, void* data, size_t)
     {
-        INT_INFO("IARM_BUS_DSMGR_EVENT_HDMI_IN_STATUS received owner = %s, eventId = %d", owner, eventId);
+        EventTraceScope traceScope(eventId);
+        INT_INFO_RL("IARM_BUS_DSMGR_EVENT_HDMI_IN_STATUS received owner = %s, eventId = %d", owner, eventId);
 
         if (!isValidOwner(owner)) {
             return;
@@ -781,7 +852,8 @@ private:
 
     static void iarmHdmiInVideoModeUpdateHandler(const char* owner, IARM_EventId_t eventId, void* data, size_t)
     {
-        INT_INFO("IARM_BUS_DSMGR_EVENT_HDMI_IN_VIDEO_MODE_UPDATE received owner = %s, eventId = %d", owner, eventId);
+        EventTraceScope traceScope(eventId);
+        INT_INFO_RL("IARM_BUS_DSMGR_EVENT_HDMI_IN_VIDEO_MODE_UPDATE received owner = %s, eventId = %d", owner, eventId);
 
         if (!isValidOwner(owner)) {
             return;
@@ -810,7 +882,8 @@ private:
 
     static void iarmHdmiInAllmStatusHandler(const char* owner, IARM_EventId_t eventId, void* data, size_t)
     {
-        INT_INFO("IARM_BUS_DSMGR_EVENT_HDMI_IN_ALLM_STATUS received owner = %s, eventId = %d", owner, eventId);
+        EventTraceScope traceScope(eventId);
+        INT_INFO_RL("IARM_BUS_DSMGR_EVENT_HDMI_IN_ALLM_STATUS received owner = %s, eventId = %d", owner, eventId);
 
         if (!isValidOwner(owner)) {
             return;
@@ -832,7 +905,8 @@ private:
 
     static void iarmHdmiInVRRStatusHandler(const char* owner, IARM_EventId_t eventId, void* data, size_t)
     {
-        INT_INFO("IARM_BUS_DSMGR_EVENT_HDMI_IN_VRR_STATUS received owner = %s, eventId = %d", owner, eventId);
+        EventTraceScope traceScope(eventId);
+        INT_INFO_RL("IARM_BUS_DSMGR_EVENT_HDMI_IN_VRR_STATUS received owner = %s, eventId = %d", owner, eventId);
 
         if (!isValidOwner(owner)) {
             return;
@@ -855,7 +929,8 @@ private:
 
     static void iarmHdmiInAVIContentTypeHandler(const char* owner, IARM_EventId_t eventId, void* data, size_t)
     {
-        INT_INFO("IARM_BUS_DSMGR_EVENT_HDMI_IN_AVI_CONTENT_TYPE received owner = %s, eventId = %d", owner, eventId);
+        EventTraceScope traceScope(eventId);
+        INT_INFO_RL("IARM_BUS_DSMGR_EVENT_HDMI_IN_AVI_CONTENT_TYPE received owner = %s, eventId = %d", owner, eventId);
 
         if (!isValidOwner(owner)) {
             return;
@@ -877,7 +952,8 @@ private:
 
     static void iarmHdmiInAVLatencyHandler(const char* owner, IARM_EventId_t eventId, void* data, size_t)
     {
-        INT_INFO("IARM_BUS_DSMGR_EVENT_HDMI_IN_AV_LATENCY received owner = %s, eventId = %d", owner, eventId);
+        EventTraceScope traceScope(eventId);
+        INT_INFO_RL("IARM_BUS_DSMGR_EVENT_HDMI_IN_AV_LATENCY received owner = %s, eventId = %d", owner, eventId);
 
         if (!isValidOwner(owner)) {
             return;
@@ -917,6 +993,7 @@ constexpr EventHandlerMapping IARMGroupVideoOutputPort::handlers[];
 constexpr EventHandlerMapping IARMGroupAudioOutputPort::handlers[];
 constexpr EventHandlerMapping IARMGroupComposite::handlers[];
 constexpr EventHandlerMapping IARMGroupDisplay::handlers[];
+constexpr EventHandlerMapping IARMGroupDisplayDevice::handlers[];
 
 IarmImpl::CallbackList<IHdmiInEvents*, IARMGroupHdmiIn> IarmImpl::s_hdmiInListeners;
 IarmImpl::CallbackList<IVideoDeviceEvents*, IARMGroupVideoDevice> IarmImpl::s_videoDeviceListeners;
@@ -941,6 +1018,7 @@ template <typename T, typename F>
 /* static */ void IarmImpl::Dispatch(const std::list<std::pair<T*, std::string>>& listeners, F&& fn)
 {
     std::stringstream ss;
+    int index = 0;
 
     for (auto& pair : listeners) {
         // pair.first is the listener
@@ -950,12 +1028,14 @@ template <typename T, typename F>
 
         fn(pair.first);
 
+        dsEventTraceRecord(dsEVENT_TRACE_LISTENER_RETURN, s_traceEventId, index++);
+
         auto end     = std::chrono::steady_clock::now();
         auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
         ss << "\t client= " << pair.second << " @ " << pair.first << ", elapsed = " << elapsed.count() << " ms\n";
     }
 
-    INT_INFO("%s Dispatch done to %zu listeners\n%s", typeid(T).name(), listeners.size(), ss.str().c_str());
+    INT_INFO_RL("%s Dispatch done to %zu listeners\n%s", typeid(T).name(), listeners.size(), ss.str().c_str());
 }
 
 dsError_t IarmImpl::Register(IHdmiInEvents* listener, const std::string& clientName)
@@ -84,6 +84,15 @@ class AudioOutputPort  : public Enumerable {
 
 public:
 
+	/**
+	 * @brief Shape of a level ramp, see rampLevel()
+	 */
+	enum RampCurve {
+		kRampLinear = 0,    //!< Equal steps in level
+		kRampEaseInOut,     //!< Slow at both ends
+		kRampExponential    //!< Equal steps in dB, down to -40 dB
+	};
+
 	static AudioOutputPort & getInstance(int id);
 	static AudioOutputPort & getInstance(const std::string &name);
 
@@ -193,9 +202,11 @@ public:
 	void setDB(const float db);
         void setGain(const float newGain);
 	void setLevel(const float level);
+	void rampLevel(const float level, const unsigned int durationMs, const RampCurve curve = kRampLinear);
 	void setLoopThru(const bool loopThru);
 	void setMuted(const bool mute);
 	void setAudioDucking(dsAudioDuckingAction_t action, dsAudioDuckingType_t, const unsigned char level);
+	void setAudioDucking(unsigned int source, int priority, dsAudioDuckingAction_t action, dsAudioDuckingType_t type, const unsigned char level);
         void getAudioCapabilities(int *capabilities);
         void getMS12Capabilities(int *capabilities);
         void resetDialogEnhancement();
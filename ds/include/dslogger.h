@@ -29,14 +29,24 @@
 #ifndef _DS_LOGGER_H_
 #define _DS_LOGGER_H_
 
+#include <atomic>
 #include <cstring>
 
 #include "dsregisterlog.h"
+#include "dsLogRateLimit.h"
 
 enum LogLevel {INFO_LEVEL = 0, WARN_LEVEL, ERROR_LEVEL, DEBUG_LEVEL, TRACE_LEVEL};
 
 int ds_log(LogLevel level, const char* fileName, int lineNum, const char *func, const char *format, ...);
 
+// Bit per LogLevel, set when that level is enabled. Updated by DS_SetLogLevel()
+extern std::atomic<unsigned int> dsLogLevelMask;
+
+// Runtime level check, done before any argument evaluation or formatting
+static inline bool ds_log_enabled(LogLevel level) {
+    return (dsLogLevelMask.load(std::memory_order_relaxed) >> level) & 1u;
+}
+
 // Helper to extract filename from full path
 // E.g. "/path/to/file.cpp" -> "file.cpp"
 // IMPORTANT: This will work for Unix style paths only
@@ -49,13 +59,21 @@ static inline const char* fileName(const char* path) {
 #define DS_LOG_LEVEL ERROR_LEVEL
 #endif
 
-#define INT_INFO(FORMAT, ...)       ds_log(INFO_LEVEL, fileName(__FILE__), __LINE__, __FUNCTION__, FORMAT,  ##__VA_ARGS__ )
-#define INT_WARN(FORMAT, ...)       ds_log(WARN_LEVEL, fileName(__FILE__), __LINE__, __FUNCTION__, FORMAT,  ##__VA_ARGS__ )
-#define INT_ERROR(FORMAT, ...)      ds_log(ERROR_LEVEL, fileName(__FILE__), __LINE__, __FUNCTION__, FORMAT,  ##__VA_ARGS__ )
+#define DS_LOG_AT(LEVEL, FORMAT, ...) \
+    (ds_log_enabled(LEVEL) ? ds_log(LEVEL, fileName(__FILE__), __LINE__, __FUNCTION__, FORMAT,  ##__VA_ARGS__ ) : 0)
+
+#define INT_INFO(FORMAT, ...)       DS_LOG_AT(INFO_LEVEL, FORMAT,  ##__VA_ARGS__ )
+#define INT_WARN(FORMAT, ...)       DS_LOG_AT(WARN_LEVEL, FORMAT,  ##__VA_ARGS__ )
+#define INT_ERROR(FORMAT, ...)      DS_LOG_AT(ERROR_LEVEL, FORMAT,  ##__VA_ARGS__ )
+
+// Rate limited variants for hot paths, see dsLogRateLimit.h
+#define INT_INFO_RL(FORMAT, ...)    DS_LOG_RATELIMITED(ds_log_enabled(INFO_LEVEL), INT_INFO, "", FORMAT,  ##__VA_ARGS__ )
+#define INT_WARN_RL(FORMAT, ...)    DS_LOG_RATELIMITED(ds_log_enabled(WARN_LEVEL), INT_WARN, "", FORMAT,  ##__VA_ARGS__ )
+#define INT_ERROR_RL(FORMAT, ...)   DS_LOG_RATELIMITED(ds_log_enabled(ERROR_LEVEL), INT_ERROR, "", FORMAT,  ##__VA_ARGS__ )
 
 // conditionally enable debug logs, based on DS_LOG_LEVEL
 #if DS_LOG_LEVEL >= DEBUG_LEVEL
-#define INT_DEBUG(FORMAT, ...)      ds_log(DEBUG_LEVEL, fileName(__FILE__), __LINE__, __FUNCTION__, FORMAT,  ##__VA_ARGS__ )
+#define INT_DEBUG(FORMAT, ...)      DS_LOG_AT(DEBUG_LEVEL, FORMAT,  ##__VA_ARGS__ )
 #else
 #define INT_DEBUG(FORMAT, ...)      ((void)0)
 #endif
@@ -35,6 +35,31 @@ extern "C"
 {
 #endif
 void DS_RegisterForLog(DS_LogCb cb);
+
+/*
+ * Runtime log threshold. Messages less severe than level are dropped before
+ * being formatted. Severity order is ERROR > WARN > INFO > DEBUG > TRACE and
+ * level takes the LogLevel values of dslogger.h. The initial threshold can be
+ * set with the DS_LOG_THRESHOLD environment variable (ERROR, WARN, INFO, DEBUG
+ * or TRACE), it defaults to INFO, or to DEBUG/TRACE in builds compiled with
+ * a DS_LOG_LEVEL that includes them.
+ */
+void DS_SetLogLevel(int level);
+
+/*
+ * Enable or disable the asynchronous stderr backend, disabled by default unless
+ * DS_LOG_ASYNC=1 is set. Messages are formatted by the caller into a per-thread
+ * ring and written by a single background thread; a caller that finds its ring
+ * full writes it out itself, so no message is dropped. A registered DS_LogCb is
+ * always called synchronously.
+ */
+void DS_SetLogAsync(int enable);
+
+/*
+ * Write out all queued messages. libds installs no signal handlers of its own;
+ * this is async-signal-safe so an application crash handler may call it.
+ */
+void DS_LogFlush(void);
 #ifdef __cplusplus
 };
 #endif
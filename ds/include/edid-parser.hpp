@@ -73,6 +73,61 @@ enum colorimetry_info_t {
     COLORIMETRY_INFO_DCI_P3 = 0x100
 };
 
+enum hdr_dynamic_metadata_t {
+    HDR_DYNAMIC_METADATA_NONE = 0x0,
+    HDR_DYNAMIC_METADATA_ST2094_10 = 0x01, // type 1, SMPTE ST 2094-10
+    HDR_DYNAMIC_METADATA_TS103433 = 0x02, // type 2, ETSI TS 103 433 (SL-HDR)
+    HDR_DYNAMIC_METADATA_H265_CRI = 0x04, // type 3, ITU-T H.265 colour remapping
+    HDR_DYNAMIC_METADATA_ST2094_40 = 0x08 // type 4, SMPTE ST 2094-40 (HDR10+)
+};
+
+/* Read-only view of EDID bytes. The parser neither copies nor keeps it. */
+struct edid_span_t {
+    const uint8_t* data;
+    size_t size;
+};
+
+#define EDID_MAX_SVD 64
+#define EDID_VIC_BITMAP_BYTES 32
+
+/* HDMI Forum Vendor Specific Data Block (or HF-SCDB), HDMI 2.1 section 10.3.2 */
+struct edid_hf_vsdb_t {
+    bool present;
+    uint8_t version;
+    uint16_t max_tmds_char_rate;    /* MHz, 0 when the sink is limited to 340 MHz */
+    uint8_t max_frl_rate;           /* 0: no FRL, 1..6: 3G3L up to 12G4L */
+    bool scdc_present;
+    bool rr_capable;
+    bool lte_340mcsc_scramble;
+    bool dc_30bit_420;
+    bool dc_36bit_420;
+    bool dc_48bit_420;
+    bool allm;
+    bool fva;
+    bool cnmvrr;
+    bool cinema_vrr;
+    bool m_delta;
+    uint8_t vrr_min;                /* Hz */
+    uint16_t vrr_max;               /* Hz */
+    bool dsc_1p2;
+};
+
+/* Room Configuration Data Block, CTA-861-G section 7.5.15 */
+struct edid_room_config_t {
+    bool present;
+    bool display;                   /* display coordinates are valid */
+    bool sld;                       /* Speaker Location Descriptors follow */
+    uint8_t speaker_count;          /* 0 when not given */
+    uint32_t speaker_mask;          /* Speaker Presence Mask, byte 0 in bits 7..0 */
+};
+
+/*
+ * Layout version of edid_data_t. Version 2 appended the fields from
+ * established_timings on; the earlier fields keep their offsets but the
+ * struct is larger, so code allocating it must be rebuilt against this header.
+ */
+#define EDID_DATA_VERSION 2
+
 struct edid_data_t {
     edid_res_t res;
     // bitmask of HDR_standard_t values
@@ -89,8 +144,31 @@ struct edid_data_t {
     uint8_t physical_address_d;     /* Physical Address for HDMI node D */
     char monitor_name[14];          /* Connected display monitor name. */
     uint32_t colorimetry_info;      /* bitmask of enum colorimetry_info_t */
+    uint32_t established_timings;   /* base block bytes 35..37, byte 35 in bits 23..16 */
+    uint8_t svd_count;              /* number of entries in svd */
+    uint8_t svd[EDID_MAX_SVD];      /* VICs of the Video Data Blocks in order, native flag stripped, 0 for reserved codes */
+    uint8_t ycbcr420_only[EDID_VIC_BITMAP_BYTES];    /* bit per VIC, YCbCr 4:2:0 only formats */
+    uint8_t ycbcr420_capable[EDID_VIC_BITMAP_BYTES]; /* bit per VIC, formats also supporting YCbCr 4:2:0 */
+    uint16_t audio_formats;         /* bitmask of 1 << CTA audio format code */
+    uint8_t audio_max_channels;
+    uint32_t speaker_allocation;    /* Speaker Allocation Data Block, byte 0 in bits 7..0 */
+    uint8_t video_capability;       /* Video Capability Data Block flags */
+    uint8_t hdr_static_metadata;    /* supported static metadata descriptor types */
+    uint8_t hdr_max_luminance;      /* CTA coded values, 0 when not given */
+    uint8_t hdr_max_frame_avg_luminance;
+    uint8_t hdr_min_luminance;
+    uint8_t hdr_dynamic_metadata;   /* bitmask of hdr_dynamic_metadata_t */
+    edid_hf_vsdb_t hf_vsdb;
+    edid_room_config_t room_config;
 };
 
+static inline bool EDID_VicInBitmap(const uint8_t* bitmap, uint8_t vic) {
+    return (bitmap[vic >> 3] >> (vic & 7)) & 1;
+}
+
+/* Single pass, allocation free parse; data_ptr holds no references to bytes and can be cached. */
+edid_status_e EDID_Parse(edid_span_t edid, edid_data_t* data_ptr);
+edid_status_e EDID_Verify(edid_span_t edid);
 edid_status_e EDID_Parse(unsigned char* bytes, size_t count, edid_data_t* data_ptr);
 edid_status_e EDID_Verify(unsigned char* bytes, size_t count);
 }
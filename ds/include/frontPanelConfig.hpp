@@ -35,6 +35,7 @@
 #include "frontPanelTextDisplay.hpp"
 
 #include <string>
+#include <map>
 
 
 /**
@@ -77,6 +78,34 @@ private:
 	virtual ~FrontPanelConfig();
 
 public:
+
+/**
+ * @class FrontPanelConfig::IndicatorScene
+ * @brief Desired state, color, brightness and blink of any number of
+ * indicators, applied together by applyIndicatorScene(). Indicators are
+ * identified by their FrontPanelIndicator id; what is not set is left as is.
+ */
+    class IndicatorScene {
+    public:
+        IndicatorScene &setState(int id, bool enable);
+        IndicatorScene &setColor(int id, uint32_t color);
+        IndicatorScene &setBrightness(int id, int brightness);
+        IndicatorScene &setBlink(int id, const FrontPanelIndicator::Blink &blink);
+
+    private:
+        friend class FrontPanelConfig;
+        enum { kState = 0x1, kColor = 0x2, kBrightness = 0x4, kBlink = 0x8 };
+        struct Settings {
+            unsigned int mask;
+            bool state;
+            uint32_t color;
+            int brightness;
+            FrontPanelIndicator::Blink blink;
+            Settings() : mask(0), state(false), color(0), brightness(0) {}
+        };
+        std::map<int, Settings> _settings;
+    };
+
 	static FrontPanelConfig & getInstance();
 
 	FrontPanelIndicator::Color &getColor(int id);
@@ -97,6 +126,19 @@ public:
     void fPTerm();
 
     void load(fpdConfigs_t* dynamicFPDConfigs);
+
+/**
+ * @fn applyIndicatorScene(const IndicatorScene &scene, bool toPersist)
+ * @brief Applies all the settings of scene with a single call to dsMgr, which
+ * only changes what differs from the current settings and persists the power
+ * indicator brightness and color once.
+ *
+ * @param[in] scene Settings of the indicators to change.
+ * @param[in] toPersist If true, the power indicator brightness and color are persisted.
+ *
+ * @return None
+ */
+    void applyIndicatorScene(const IndicatorScene &scene, bool toPersist = true);
 };
 
 }
@@ -31,6 +31,8 @@
 
 #include "dsConstant.hpp"
 #include "list"
+#include <string>
+#include <vector>
 #include "frontPanelIndicator.hpp"
 
 
@@ -185,6 +187,49 @@ public:
     void setMode(int mode);
 
 
+/**
+ * @fn startScroll(const std::string &text, int width, int stepMs, int iterations)
+ * @brief These APIs start a text animation that dsMgr runs on its own, so no
+ * setText() call per frame is needed. startScroll() slides text through a
+ * width character window, startBlink() shows text on the steps whose bit is
+ * set in pattern, startCountdown() counts seconds down to 0 and
+ * startFrames() shows the given frames in turn. Animations run for
+ * iterations passes, or until cancelled for 0. The latest animation owns the
+ * display; frames are not shown in clock mode, and setText() cancels all
+ * animations.
+ *
+ * @return Handle of the animation, for cancelAnimation()
+ */
+    unsigned int startScroll(const std::string &text, int width, int stepMs, int iterations = 0);
+    unsigned int startBlink(const std::string &text, unsigned int pattern, int steps, int stepMs, int iterations = 0);
+    unsigned int startCountdown(int seconds);
+    unsigned int startFrames(const std::vector<std::string> &frames, int stepMs, int iterations = 0);
+
+/**
+ * @fn cancelAnimation(unsigned int handle)
+ * @brief This API stops an animation; the display keeps its last frame
+ * unless an earlier animation is still running.
+ *
+ * @param[in] handle Handle returned when the animation was started, 0 for all animations.
+ *
+ * @return None
+ */
+    void cancelAnimation(unsigned int handle = 0);
+
+
+/**
+ * @fn setAutoClock(bool enable)
+ * @brief This API lets dsMgr update the clock every minute by itself, which it
+ * does by default until setTime() is called. Enabling it shows the clock
+ * again in place of any text.
+ *
+ * @param[in] enable true to update the clock automatically.
+ *
+ * @return None
+ */
+    void setAutoClock(bool enable);
+
+
     FrontPanelTextDisplay(int id, int maxBrightness, int maxCycleRate, int levels,
                           int maxHorizontalIterations, int maxVerticalIterations,
                           const std::string &supportedCharacters,int colorMode);
@@ -74,6 +74,34 @@ class HdmiInput
 {
 
 public:
+/**
+ * @brief Status of one HDMI input port, see getAllPortsStatus()
+ */
+    struct PortStatus {
+        bool isConnected;
+        bool isArcCapable;
+        dsHdmiInSignalStatus_t signalStatus;
+        dsVideoPortResolution_t resolution;
+        bool allmMode;
+        dsVRRType_t vrrType;
+        dsAviContentType_t aviContentType;
+        int edidVersion;
+        bool edidAllmSupport;
+        bool vrrSupport;
+        dsHdmiMaxCapabilityVersion_t hdmiVersion;
+    };
+
+/**
+ * @brief Status of all HDMI input ports, see getAllPortsStatus()
+ */
+    struct AllPortsStatus {
+        int8_t activePort;
+        bool isPresented;
+        int audioLatency;
+        int videoLatency;
+        std::vector<PortStatus> ports;  /* Indexed by port */
+    };
+
     static HdmiInput & getInstance();
 
     uint8_t getNumberOfInputs        () const;
@@ -102,6 +130,7 @@ public:
     void getVRRStatus (int iHdmiPort, dsHdmiInVrrStatus_t *vrrStatus);
     void getHdmiVersion (int iHdmiPort, dsHdmiMaxCapabilityVersion_t *capversion);
     dsError_t getHDMIARCPortId(int &portId);
+    void getAllPortsStatus (AllPortsStatus &status) const;
 private:
     HdmiInput ();           /* default constructor */
     virtual ~HdmiInput ();  /* destructor */
@@ -35,6 +35,7 @@
 #include "aspectRatio.hpp"
 #include <string>
 #include <vector>
+#include <memory>
 #include <stdint.h>
 
 #include "dsTypes.h"
@@ -50,6 +51,16 @@ class VideoOutputPortType;
 class AudioOutputPort;
 class VideoResolution;
 
+/**
+ * @struct EdidInfo
+ * @brief Immutable snapshot of the EDID reported by dsMgr for a display.
+ * Snapshots are shared by all callers until dsMgr reports a different EDID generation (a hotplug).
+ */
+struct EdidInfo {
+    dsDisplayEDID_t edid;       //!< EDID as filtered by dsMgr
+    unsigned int generation;    //!< dsMgr EDID generation the snapshot belongs to
+};
+
 
 /**
  * @class VideoOutputPort
@@ -155,6 +166,9 @@ public:
         int getConnectedDeviceType() const {return _hdmiDeviceType;};
         bool isConnectedDeviceRepeater() const {return _isDeviceRepeater;};
         void getEDIDBytes(std::vector<uint8_t> &edid) const;
+        std::shared_ptr<const EdidInfo> getEdidInfo() const {return getEdidInfo(_handle);};
+        static std::shared_ptr<const EdidInfo> getEdidInfo(intptr_t handle);
+        bool waitForValidEdid(std::vector<uint8_t> &edid, int timeoutMs) const;
 	void setAllmEnabled(bool enable) const;
 	void setAVIContentType(dsAviContentType_t contentType) const;
 	void setAVIScanInformation(dsAVIScanInformation_t scanInfo) const;
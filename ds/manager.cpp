@@ -43,10 +43,14 @@
 #include "exception.hpp"
 #include <pthread.h>
 #include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
 #include <functional>
 #include <dlfcn.h>
 #include "dsHALConfig.h"
 #include "frontPanelConfig.hpp"
+#include "dsEventTrace.h"
+#include "dsLogModule.h"
 
 /**
  * @file manager.cpp
@@ -300,6 +304,19 @@ void Manager::Initialize()
                                     device::DEVICE_CAPABILITY_AUDIO_PORT |
                                     device::DEVICE_CAPABILITY_VIDEO_DEVICE |
                                     device::DEVICE_CAPABILITY_FRONT_PANEL);
+
+            if (dsEventTraceInstallFromEnv() > 0) {
+                INT_INFO("Event trace dump signal installed");
+            }
+
+            // Runtime per-module levels of the RPC client logger, read once unless
+            // the process opts in to an inotify watcher with DS_LOG_LEVEL_WATCH=1
+            const char *watchLevels = getenv("DS_LOG_LEVEL_WATCH");
+            if (watchLevels && 0 == strcmp(watchLevels, "1")) {
+                dsLogModuleWatchConfig(DS_LOG_LEVEL_CONFIG_FILE);
+            } else {
+                dsLogModuleLoadConfig(DS_LOG_LEVEL_CONFIG_FILE);
+            }
         }
     }
     catch(const Exception &e) {
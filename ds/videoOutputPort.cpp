@@ -48,8 +48,10 @@
 #include <stdlib.h>
 #include <string.h>
 #include <sstream>
-#include <thread>
 #include <chrono>
+#include <mutex>
+#include <thread>
+#include <map>
 #include "dsInternal.h"
 using namespace std;
 
@@ -67,10 +69,55 @@ namespace device {
 const char * VideoOutputPort::kPropertyResolution = ".resolution";
 
 enum {
-    READ_EDID_RETRY_MS = 500,
     READ_EDID_RETRY_TOTAL_MS = 2000
 };
 
+namespace {
+
+/* Last EDID snapshot per display handle, reused while its generation is current */
+std::mutex edidInfoMutex;
+std::map<intptr_t, std::shared_ptr<const EdidInfo> > edidInfoCache;
+
+/* Handed out while dsMgr has no valid EDID, all fields zero */
+std::shared_ptr<const EdidInfo> makeInvalidEdidInfo()
+{
+    std::shared_ptr<EdidInfo> info = std::make_shared<EdidInfo>();
+    memset(&info->edid, 0, sizeof(info->edid));
+    info->generation = 0;
+    return info;
+}
+
+/* Single read of the EDID bytes, verified before they are handed out. unverified tells a
+ * verification failure apart from a failed read, both are dsERR_GENERAL. */
+dsError_t readVerifiedEDID(intptr_t handle, std::vector<uint8_t> &edid, const char* &exceptionstr, bool &unverified)
+{
+    unverified = false;
+    unsigned char edidBytes[1024] = {0};
+    int length = sizeof(edidBytes);
+
+    dsError_t ret = dsGetEDIDBytes(handle, edidBytes, &length);
+    INT_INFO_RL("VideoOutputPort::Display::getEDIDBytes has ret %d", ret);
+    if (ret != dsERR_NONE) {
+        exceptionstr = "dsGetEDIDBytes failed";
+        return ret;
+    }
+    if (length > 1024) {
+        exceptionstr = "EDID length > 1024";
+        return dsERR_OPERATION_NOT_SUPPORTED;
+    }
+    INT_INFO_RL("VideoOutputPort::Display::getEDIDBytes has %d bytes", length);
+    if (edid_parser::EDID_STATUS_OK != edid_parser::EDID_Verify(edidBytes, length)) {
+        exceptionstr = "EDID verification failed";
+        unverified = true;
+        return dsERR_GENERAL;
+    }
+    edid.clear();
+    edid.insert(edid.begin(), edidBytes, edidBytes + length);
+    return dsERR_NONE;
+}
+
+}
+
 /**
  * @addtogroup dssettingsvidoutportapi
  * @{
@@ -330,18 +377,13 @@ const VideoOutputPort::Display &VideoOutputPort::getDisplay()
 {
 	if (isDisplayConnected()) {
 		dsVideoAspectRatio_t aspect;
-		dsDisplayEDID_t *edid = (dsDisplayEDID_t*)malloc(sizeof(dsDisplayEDID_t));
-          	if (edid == NULL) {
-                  	throw Exception(dsERR_RESOURCE_NOT_AVAILABLE);
-    		}
-        	memset(edid, 0, sizeof(*edid));
-		dsError_t dsError = dsERR_NONE;
 		if (_display._handle != 0) {
 			dsGetDisplayAspectRatio(_display._handle, &aspect);
 			_display._aspectRatio = aspect;
-			dsError = dsGetEDID(_display._handle, edid);
-			if(dsError == dsERR_NONE)
+			std::shared_ptr<const EdidInfo> info = _display.getEdidInfo();
+			if (info)
 			{
+			 const dsDisplayEDID_t *edid = &info->edid;
 			 _display._productCode = edid->productCode;
 			 _display._serialNumber = edid->serialNumber;
 			 _display._manufacturerYear = edid->manufactureYear;
@@ -353,21 +395,10 @@ const VideoOutputPort::Display &VideoOutputPort::getDisplay()
 			_display._physicalAddressC = edid->physicalAddressC;
 			_display._physicalAddressD = edid->physicalAddressD;
 			_display._isDeviceRepeater = edid->isRepeater;
-
-
 			}
-			else
-			{
-				printf("VideoOutputPort::Display::dsGetEDID has dsError: %d\r\n", dsError);
-			}
-            free(edid);
 			return _display;
 		}
 		else {
-            if(edid)
-            {
-                free(edid);
-            }
 			throw Exception(dsERR_INVALID_PARAM);
 		}
 	}
@@ -663,11 +694,12 @@ int VideoOutputPort::Display::getSurroundMode(void) const
  * @fn void VideoOutputPort::Display::getEDIDBytes(std::vector<uint8_t> &edid) const
  * @brief This function is used to get the EDID information of the connected video display.
  * After it gets the EDID information , it clears the old edid information and inserts it.
- * The EDID bytes are verified before returning them. If invalid EDID bytes are detected, the
- * EDID bytes are read again after READ_EDID_RETRY_MS millis. This repeats for a maximum
- * of READ_EDID_RETRY_TOTAL_MS millis.
+ * The EDID bytes are verified before returning them. If the bytes fail verification, typically
+ * because the display is still settling after a hot plug, it waits up to READ_EDID_RETRY_TOTAL_MS
+ * millis for dsMgr to report a valid EDID (see waitForValidEdid()) and reads it once more.
+ * A failed read, e.g. an IARM error, is reported right away.
  * If ret is not equal to dsERR_NONE, it will throw the ret to exception handler and it will pass message as "dsGetEDIDBytes failed".
- * If invalid EDID is read, even after retries, it throws exception with message "EDID verification failed"
+ * If invalid EDID is read, even after waiting, it throws exception with message "EDID verification failed"
  * If EDID bytes length > 1024 it throws exception with message "EDID length > 1024"
  *
  * @param edid The EDID raw buffer of the display. The HAL implementation should
@@ -679,51 +711,108 @@ int VideoOutputPort::Display::getSurroundMode(void) const
  */
 void VideoOutputPort::Display::getEDIDBytes(std::vector<uint8_t> &edid) const
 {
-    using namespace std::chrono;
+    INT_INFO_RL("VideoOutputPort::Display::getEDIDBytes");
 
-    printf("VideoOutputPort::Display::getEDIDBytes \r\n");
+    const char* exceptionstr = "";
+    bool unverified = false;
+    dsError_t ret = readVerifiedEDID(_handle, edid, exceptionstr, unverified);
 
-    dsError_t ret = dsERR_NONE;
-    int length = 0;
+    if (unverified && waitForValidEdid(edid, READ_EDID_RETRY_TOTAL_MS)) {
+        ret = dsERR_NONE;
+    }
+
+    if (ret != dsERR_NONE) {
+        throw Exception(ret, exceptionstr);
+    }
+}
 
-    unsigned char edidBytes[512] = {0};
 
-    const auto reading_edid_start = system_clock::now();
-    const char* exceptionstr = "";
-    bool retry_get_edid;
-    do {
-        retry_get_edid = false;
-        const auto get_edid_bytes_start = system_clock::now();
-        ret = dsGetEDIDBytes(_handle, edidBytes, &length);
-
-        printf("VideoOutputPort::Display::getEDIDBytes has ret %d\r\n", ret);
-        if (ret == dsERR_NONE) {
-            if (length <= 1024) {
-                printf("VideoOutputPort::Display::getEDIDBytes has %d bytes\r\n", length);
-                if (edid_parser::EDID_STATUS_OK == edid_parser::EDID_Verify(edidBytes, length)) {
-                    edid.clear();
-                    edid.insert(edid.begin(), edidBytes, edidBytes + length);
-                } else {
-                    ret = dsERR_GENERAL;
-                    exceptionstr = "EDID verification failed";
-                    auto now = system_clock::now();
-                    if (now + milliseconds(READ_EDID_RETRY_MS) < reading_edid_start + milliseconds(READ_EDID_RETRY_TOTAL_MS)) {
-                        std::this_thread::sleep_for(milliseconds(READ_EDID_RETRY_MS) - (now - get_edid_bytes_start));
-                        retry_get_edid = true;
-                    }
-                }
-            } else {
-                ret = dsERR_OPERATION_NOT_SUPPORTED;
-                exceptionstr = "EDID length > 1024";
-            }
-        } else {
-            exceptionstr = "dsGetEDIDBytes failed";
+/**
+ * @fn std::shared_ptr<const EdidInfo> VideoOutputPort::Display::getEdidInfo(intptr_t handle)
+ * @brief This function returns the EDID of the display behind handle as reported by dsGetEDID().
+ * The snapshot is kept per display and handed out again, without copying or allocating, for as
+ * long as the EDID generation pushed by dsMgr events stays the same. It is fetched again after a
+ * hotplug. While dsMgr has no valid EDID, one shared snapshot with all fields zero is returned.
+ *
+ * @return Shared EDID snapshot, or an empty pointer if dsGetEDID() failed.
+ */
+std::shared_ptr<const EdidInfo> VideoOutputPort::Display::getEdidInfo(intptr_t handle)
+{
+    static const std::shared_ptr<const EdidInfo> invalidEdidInfo = makeInvalidEdidInfo();
+    bool valid = false;
+    unsigned int generation = 0;
+    const bool known = VideoOutputPortConfig::getInstance().getEdidState(handle, valid, generation);
+
+    if (known && !valid) {
+        return invalidEdidInfo;
+    }
+    if (known) {
+        std::lock_guard<std::mutex> lock(edidInfoMutex);
+        std::map<intptr_t, std::shared_ptr<const EdidInfo> >::const_iterator it = edidInfoCache.find(handle);
+        if ((it != edidInfoCache.end()) && (it->second->generation == generation)) {
+            return it->second;
         }
-    } while (retry_get_edid);
+    }
 
+    std::shared_ptr<EdidInfo> info = std::make_shared<EdidInfo>();
+    memset(&info->edid, 0, sizeof(info->edid));
+    info->generation = generation;
+    dsError_t ret = dsGetEDID(handle, &info->edid);
     if (ret != dsERR_NONE) {
-        throw Exception(ret, exceptionstr);
+        INT_ERROR("VideoOutputPort::Display::getEdidInfo dsGetEDID has dsError: %d", ret);
+        return std::shared_ptr<const EdidInfo>();
+    }
+
+    if (known) {
+        std::lock_guard<std::mutex> lock(edidInfoMutex);
+        edidInfoCache[handle] = info;
     }
+    return info;
+}
+
+
+/**
+ * @fn bool VideoOutputPort::Display::waitForValidEdid(std::vector<uint8_t> &edid, int timeoutMs) const
+ * @brief This function waits until dsMgr has read a valid EDID from the connected display and returns it.
+ * It blocks on the EDID state kept by VideoOutputPortConfig, which is woken up by the EDID ready
+ * event of dsMgr, and reads the bytes once per event. If the bytes fail verification or a hot plug
+ * happened while reading, they are discarded and it waits for the next EDID ready event. No listener
+ * is registered, so it is safe to call from an IARM event handler.
+ *
+ * @param[out] edid The verified EDID bytes of the display.
+ * @param[in] timeoutMs Maximum time to wait for the EDID, in milliseconds.
+ *
+ * @return true if a valid EDID was returned, false on timeout or error.
+ */
+bool VideoOutputPort::Display::waitForValidEdid(std::vector<uint8_t> &edid, int timeoutMs) const
+{
+    const std::chrono::steady_clock::time_point deadline =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    VideoOutputPortConfig &config = VideoOutputPortConfig::getInstance();
+    unsigned int generation = 0;
+    bool newer = false;
+
+    while (config.waitForEdid(_handle, deadline, newer, generation)) {
+        const char* exceptionstr = "";
+        bool unverified = false;
+        bool valid = false;
+        unsigned int readGeneration = 0;
+        std::vector<uint8_t> bytes;
+        dsError_t ret = readVerifiedEDID(_handle, bytes, exceptionstr, unverified);
+        if ((ret != dsERR_NONE) && !unverified) {
+            INT_WARN_RL("VideoOutputPort::Display::waitForValidEdid read ret %d", ret);
+            return false;
+        }
+        if ((ret == dsERR_NONE) && config.getEdidState(_handle, valid, readGeneration) &&
+            valid && (readGeneration == generation)) {
+            edid.swap(bytes);
+            return true;
+        }
+        newer = true;
+    }
+
+    INT_WARN_RL("VideoOutputPort::Display::waitForValidEdid no valid EDID within %d ms", timeoutMs);
+    return false;
 }
 
 
@@ -43,10 +43,13 @@
 #include "dslogger.h"
 #include "host.hpp"
 #include "manager.hpp"
+#include "dsInternal.h"
 
 
 #include <thread>
 #include <mutex>
+#include <condition_variable>
+#include <chrono>
 #include <iostream>
 #include <string.h>
 using namespace std;
@@ -55,6 +58,114 @@ namespace device {
 
 static VideoResolution* defaultVideoResolution;
 static std::mutex gSupportedResolutionsMutex;
+
+namespace {
+
+/*
+ * dsMgr EDID state as pushed by the hotplug and EDID ready events, so EDID
+ * snapshots are validated without an IPC per call. It is registered once in
+ * load(): listeners must not be registered from a caller's path, which may be
+ * an event handler. Until the first event dsGetEDIDState() is asked once.
+ * EDID ready is fed by the IARM layer through VideoOutputPortConfig::edidReady(),
+ * it is not part of the public IDisplayDeviceEvents interface.
+ */
+class EdidStateTracker : public Host::IDisplayDeviceEvents {
+public:
+    EdidStateTracker() : _registered(false), _known(false), _valid(false), _generation(0), _events(0) {}
+
+    void OnDisplayHDMIHotPlug(dsDisplayEvent_t displayEvent)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _known = false;
+        _events++;
+    }
+
+    void edidReady(unsigned int generation)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _known = true;
+            _valid = true;
+            _generation = generation;
+            _events++;
+        }
+        _cond.notify_all();
+    }
+
+    // Returns whether it was registered before
+    bool setRegistered(bool registered)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        bool was = _registered;
+        _registered = registered;
+        _known = false;
+        return was;
+    }
+
+    bool get(intptr_t handle, bool &valid, unsigned int &generation)
+    {
+        unsigned int events;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_registered && _known) {
+                valid = _valid;
+                generation = _generation;
+                return true;
+            }
+            events = _events;
+        }
+
+        if (dsERR_NONE != dsGetEDIDState(handle, &valid, &generation)) {
+            return false;
+        }
+
+        // Keep the answer only if no event arrived while asking
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_registered && (_events == events)) {
+            _known = true;
+            _valid = valid;
+            _generation = generation;
+        }
+        return true;
+    }
+
+    // Blocks until an EDID ready event, of another generation than the one passed in if newer is set
+    bool wait(intptr_t handle, const std::chrono::steady_clock::time_point &deadline, bool newer, unsigned int &generation)
+    {
+        const unsigned int previous = generation;
+        if (!newer) {
+            bool valid = false;
+            if (get(handle, valid, generation) && valid) {
+                return true;
+            }
+        }
+
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (!_registered) {
+            return false;
+        }
+        if (!_cond.wait_until(lock, deadline, [&] { return _known && _valid && (!newer || (_generation != previous)); })) {
+            return false;
+        }
+        generation = _generation;
+        return true;
+    }
+
+private:
+    std::mutex _mutex;
+    std::condition_variable _cond;
+    bool _registered;
+    bool _known;
+    bool _valid;
+    unsigned int _generation;
+    unsigned int _events;
+};
+
+// Never destroyed, Host may still hold it when static objects are torn down
+EdidStateTracker &edidStateTracker = *new EdidStateTracker();
+
+}
+
 VideoOutputPortConfig::VideoOutputPortConfig() {
 	// TODO Auto-generated constructor stub
 	defaultVideoResolution = new   VideoResolution(
@@ -161,7 +272,6 @@ List<VideoResolution>  VideoOutputPortConfig::getSupportedResolutions(bool isIgn
 	List<VideoResolution> supportedResolutions;
 	std::vector<VideoResolution> tmpsupportedResolutions;
 	int isDynamicList = 0;
-	dsError_t dsError = dsERR_NONE;
 	intptr_t _handle = 0;  //CID:98922 - Uninit
 	bool force_disable_4K = true;
 	
@@ -172,27 +282,20 @@ List<VideoResolution>  VideoOutputPortConfig::getSupportedResolutions(bool isIgn
 		device::VideoOutputPort vPort = VideoOutputPortConfig::getInstance().getPort(strVideoPort.c_str());
 		if (vPort.isDisplayConnected())
 		{
-			dsDisplayEDID_t *edid = (dsDisplayEDID_t*)malloc(sizeof(dsDisplayEDID_t));
-                  	if (edid == NULL) {
-       		 		throw Exception(dsERR_RESOURCE_NOT_AVAILABLE);
-    			}
-			
-			/*Initialize the struct*/
-			memset(edid, 0, sizeof(*edid));
-
-			edid->numOfSupportedResolution = 0;
 			dsGetDisplay((dsVideoPortType_t)vPort.getType().getId(), vPort.getIndex(), &_handle);
-			dsError = dsGetEDID(_handle, edid);
-			if(dsError != dsERR_NONE)
-			{
-				INT_ERROR("dsGetEDID failed with error %d, setting edid->numOfSupportedResolution to 0", dsError);
-				edid->numOfSupportedResolution = 0;
+			std::shared_ptr<const EdidInfo> info = VideoOutputPort::Display::getEdidInfo(_handle);
+			size_t numOfSupportedResolution = 0;
+			if (info) {
+				numOfSupportedResolution = info->edid.numOfSupportedResolution;
 			}
-	
-			INT_INFO("EDID reports %d supported resolutions", edid->numOfSupportedResolution);	
-			for (size_t i = 0; i < edid->numOfSupportedResolution; i++)
+			else {
+				INT_ERROR("dsGetEDID failed, using 0 supported resolutions");
+			}
+
+			INT_INFO("EDID reports %zu supported resolutions", numOfSupportedResolution);
+			for (size_t i = 0; i < numOfSupportedResolution; i++)
 			{
-				dsVideoPortResolution_t *resolution = &edid->suppResolutionList[i];
+				const dsVideoPortResolution_t *resolution = &info->edid.suppResolutionList[i];
 				isDynamicList = 1;
 
 				tmpsupportedResolutions.push_back(
@@ -205,8 +308,6 @@ List<VideoResolution>  VideoOutputPortConfig::getSupportedResolutions(bool isIgn
 							resolution->frameRate,
 							resolution->interlaced));
 			}
-
-			free(edid);
 		}
 	    }catch (...)
 		{
@@ -452,10 +553,15 @@ void VideoOutputPortConfig::load(videoPortConfigs_t* dynamicVideoPortConfigs)
         INT_ERROR("Exception thrown while loading video output port config");
         throw Exception("Failed to load video outport config");
     }
+
+    edidStateTracker.setRegistered(dsERR_NONE == Host::getInstance().Register(&edidStateTracker, "EdidStateTracker"));
 }
 
 void VideoOutputPortConfig::release()
   {
+	if (edidStateTracker.setRegistered(false)) {
+		Host::getInstance().UnRegister(&edidStateTracker);
+	}
 	try {
               _vPixelResolutions.clear();
               _vAspectRatios.clear();
@@ -471,6 +577,38 @@ void VideoOutputPortConfig::release()
 		throw e;
 	}
   }
+
+/**
+ * @brief Returns the EDID state of dsMgr: whether a verified EDID is available and its generation.
+ * The state follows the hotplug and EDID ready events, dsGetEDIDState() is only called when no
+ * event has been seen since the last hotplug.
+ *
+ * @return false if the state could not be read.
+ */
+bool VideoOutputPortConfig::getEdidState(intptr_t handle, bool &valid, unsigned int &generation)
+{
+    return edidStateTracker.get(handle, valid, generation);
+}
+
+/**
+ * @brief Waits, without polling, for dsMgr to report a valid EDID through the EDID ready event.
+ * With newer set it waits for an EDID of another generation than the one passed in, e.g. after
+ * the bytes of that generation failed verification. It never registers a listener.
+ *
+ * @return false on timeout or if no events are received; generation is updated on success.
+ */
+bool VideoOutputPortConfig::waitForEdid(intptr_t handle, const std::chrono::steady_clock::time_point &deadline, bool newer, unsigned int &generation)
+{
+    return edidStateTracker.wait(handle, deadline, newer, generation);
+}
+
+/**
+ * @brief Called by the IARM layer on IARM_BUS_DSMGR_EVENT_EDID_READY.
+ */
+void VideoOutputPortConfig::edidReady(unsigned int generation)
+{
+    edidStateTracker.edidReady(generation);
+}
 }
 /** @} */
 /** @} */
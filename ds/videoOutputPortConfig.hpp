@@ -35,6 +35,7 @@
 #include "videoResolution.hpp"
 #include <vector>
 #include <string>
+#include <chrono>
 
 typedef struct videoPortConfigs
 {
@@ -84,6 +85,10 @@ public:
 	void load(videoPortConfigs_t* dynamicVideoPortConfigs);
 	void release();
 
+	bool getEdidState(intptr_t handle, bool &valid, unsigned int &generation);
+	bool waitForEdid(intptr_t handle, const std::chrono::steady_clock::time_point &deadline, bool newer, unsigned int &generation);
+	static void edidReady(unsigned int generation);
+
 };
 
 }
@@ -27,6 +27,8 @@
 **/
 
 
+#define DS_LOG_MODULE dsLOG_MODULE_AUDIO
+
 #include "dsAudio.h"
 #include "dsInternal.h"
 
@@ -515,6 +517,55 @@ dsError_t dsSetAudioLevel(intptr_t handle, float level)
     return ret;
 }
 
+dsError_t dsSetAudioDuckingSource(intptr_t handle, unsigned int source, int priority,
+                                  dsAudioDuckingAction_t action, dsAudioDuckingType_t type, const unsigned char level)
+{
+    _DEBUG_ENTER();
+
+    dsAudioSetDuckingSourceParam_t param;
+    memset(&param, 0, sizeof(param));
+    param.handle = handle;
+    param.source = source;
+    param.priority = priority;
+    param.action = action;
+    param.type = type;
+    param.level = level;
+
+    IARM_Result_t rpcRet = IARM_Bus_Call(IARM_BUS_DSMGR_NAME,
+                        (char *)IARM_BUS_DSMGR_API_dsSetAudioDuckingSource,
+                        (void *)&param,
+                        sizeof(param));
+
+    if (IARM_RESULT_SUCCESS != rpcRet)
+    {
+        return dsERR_GENERAL;
+    }
+    return param.result;
+}
+
+dsError_t dsAudioRampLevel(intptr_t handle, float target, unsigned int durationMs, dsAudioRampCurve_t curve)
+{
+    _DEBUG_ENTER();
+
+    dsAudioRampLevelParam_t param;
+    memset(&param, 0, sizeof(param));
+    param.handle = handle;
+    param.target = target;
+    param.durationMs = durationMs;
+    param.curve = curve;
+
+    IARM_Result_t rpcRet = IARM_Bus_Call(IARM_BUS_DSMGR_NAME,
+                        (char *)IARM_BUS_DSMGR_API_dsAudioRampLevel,
+                        (void *)&param,
+                        sizeof(param));
+
+    if (IARM_RESULT_SUCCESS != rpcRet)
+    {
+        return dsERR_GENERAL;
+    }
+    return param.result;
+}
+
 dsError_t dsSetAudioDucking(intptr_t handle,dsAudioDuckingAction_t action, dsAudioDuckingType_t type, const unsigned char  level)
 {
     dsError_t ret = dsERR_GENERAL;
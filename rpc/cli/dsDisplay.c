@@ -27,6 +27,8 @@
 **/
 
 
+#define DS_LOG_MODULE dsLOG_MODULE_DISPLAY
+
 #include "dsDisplay.h"
 #include "dsclientlogger.h"
 #include <sys/types.h>
@@ -40,6 +42,7 @@
 #include "libIARM.h"
 #include "libIBus.h"
 #include "dsTypes.h"
+#include "dsInternal.h"
 #include "stdlib.h"
 
 #include "safec_lib.h" 
@@ -149,8 +152,9 @@ dsError_t dsGetEDID(intptr_t handle, dsDisplayEDID_t *edid)
         }
 	if (IARM_RESULT_SUCCESS == rpcRet)
 	{
+		 dsError_t result = param->result;
           	 free(param);
-		 return dsERR_NONE;
+		 return result;
 	}
 
 	free(param);
@@ -167,18 +171,32 @@ dsError_t dsGetEDIDBytes(intptr_t handle, unsigned char *edid, int *length)
 
     dsDisplayGetEDIDBytesParam_t param;
     param.handle = handle;
+    param.capacity = DS_RPC_EDID_CAPACITY;
     
-    printf("dsCLI::getEDIDBytes \r\n");
+    INT_INFO_RL("dsCLI::getEDIDBytes \r\n");
 	
    rpcRet = IARM_Bus_Call(IARM_BUS_DSMGR_NAME,
 							(char *)IARM_BUS_DSMGR_API_dsGetEDIDBytes,
 							(void *)&param,
-							sizeof(param));
+							DS_RPC_VAR_PARAM_SIZE(dsDisplayGetEDIDBytesParam_t, bytes, param.capacity));
+
+    /* Larger than the first guess, e.g. HDMI 2.1 EDIDs with several extensions */
+    if ((IARM_RESULT_SUCCESS == rpcRet) && (param.result == dsERR_NONE) &&
+        (param.length > param.capacity) && (param.length <= (int)sizeof(param.bytes))) {
+        param.capacity = param.length;
+        rpcRet = IARM_Bus_Call(IARM_BUS_DSMGR_NAME,
+                               (char *)IARM_BUS_DSMGR_API_dsGetEDIDBytes,
+                               (void *)&param,
+                               DS_RPC_VAR_PARAM_SIZE(dsDisplayGetEDIDBytesParam_t, bytes, param.capacity));
+    }
 
 	if (IARM_RESULT_SUCCESS == rpcRet)
 	{
+        if ((param.result == dsERR_NONE) && (param.length > param.capacity)) {
+            return dsERR_GENERAL;
+        }
         if (param.result == dsERR_NONE) {
-            printf("dsCLI ::getEDIDBytes returns %d bytes\r\n", param.length);
+            INT_INFO_RL("dsCLI ::getEDIDBytes returns %d bytes\r\n", param.length);
             if (edid) {
                 rc = memcpy_s(edid, *length, param.bytes, param.length);
                 if(rc!=EOK)
@@ -201,6 +219,33 @@ dsError_t dsGetEDIDBytes(intptr_t handle, unsigned char *edid, int *length)
     }
 }
 
+dsError_t dsGetEDIDState(intptr_t handle, bool *valid, unsigned int *generation)
+{
+	_DEBUG_ENTER();
+
+	if (NULL == valid || NULL == generation) {
+		return dsERR_INVALID_PARAM;
+	}
+
+	dsDisplayGetEDIDStateParam_t param;
+	memset(&param, 0, sizeof(param));
+	param.handle = handle;
+
+	IARM_Result_t rpcRet = IARM_Bus_Call(IARM_BUS_DSMGR_NAME,
+							(char *)IARM_BUS_DSMGR_API_dsGetEDIDState,
+							(void *)&param,
+							sizeof(param));
+
+	if (IARM_RESULT_SUCCESS != rpcRet) {
+		return dsERR_GENERAL;
+	}
+	if (dsERR_NONE == param.result) {
+		*valid = param.valid;
+		*generation = param.generation;
+	}
+	return param.result;
+}
+
 dsError_t dsSetAllmEnabled (intptr_t  handle, bool enabled)
 {
 	_DEBUG_ENTER();
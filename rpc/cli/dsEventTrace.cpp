@@ -0,0 +1,205 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2025 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+
+/**
+* @defgroup devicesettings
+* @{
+* @defgroup rpc
+* @{
+**/
+
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "dsEventTrace.h"
+
+/* Zero initialised, hence usable before any constructor has run */
+static dsEventTraceRing_t eventTraceRing;
+static unsigned int eventTraceDumps = 0;
+
+dsEventTraceRing_t *dsEventTraceRing(void)
+{
+    return &eventTraceRing;
+}
+
+static const char *_dsEventTraceStageName(uint32_t stage)
+{
+    static const char *names[dsEVENT_TRACE_STAGE_MAX] = {
+        "HAL_CALLBACK", "BROADCAST_BEGIN", "BROADCAST_END",
+        "IARM_HANDLER", "LISTENER_RETURN", "DISPATCH_DONE"
+    };
+    return (stage < dsEVENT_TRACE_STAGE_MAX) ? names[stage] : "UNKNOWN";
+}
+
+static char *_dsEventTraceFmtU64(char *p, uint64_t v)
+{
+    char tmp[24];
+    int n = 0;
+    do {
+        tmp[n++] = (char)('0' + (v % 10));
+        v /= 10;
+    } while (v != 0);
+    while (n > 0) {
+        *p++ = tmp[--n];
+    }
+    return p;
+}
+
+static char *_dsEventTraceFmtI32(char *p, int32_t v)
+{
+    if (v < 0) {
+        *p++ = '-';
+        return _dsEventTraceFmtU64(p, (uint64_t)(-(int64_t)v));
+    }
+    return _dsEventTraceFmtU64(p, (uint64_t)v);
+}
+
+static char *_dsEventTraceFmtStr(char *p, const char *s)
+{
+    while (*s) {
+        *p++ = *s++;
+    }
+    return p;
+}
+
+int dsEventTraceDump(int fd)
+{
+    dsEventTraceRing_t *ring = dsEventTraceRing();
+    uint64_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    uint64_t first = (head > DS_EVENT_TRACE_RING_SIZE) ? (head - DS_EVENT_TRACE_RING_SIZE) : 0;
+    char line[128];
+    char *p = line;
+    int written = 0;
+
+    p = _dsEventTraceFmtStr(p, "# ds event trace pid=");
+    p = _dsEventTraceFmtU64(p, (uint64_t)getpid());
+    p = _dsEventTraceFmtStr(p, " records=");
+    p = _dsEventTraceFmtU64(p, head - first);
+    *p++ = '\n';
+    if (write(fd, line, p - line) < 0) {
+        return 0;
+    }
+
+    for (uint64_t seq = first; seq < head; seq++) {
+        dsEventTraceRecord_t *rec = &ring->records[seq & (DS_EVENT_TRACE_RING_SIZE - 1)];
+        uint64_t before = __atomic_load_n(&rec->seq, __ATOMIC_ACQUIRE);
+        uint64_t timestampNs = __atomic_load_n(&rec->timestampNs, __ATOMIC_RELAXED);
+        int32_t eventId = __atomic_load_n(&rec->eventId, __ATOMIC_RELAXED);
+        int32_t arg = __atomic_load_n(&rec->arg, __ATOMIC_RELAXED);
+        uint32_t tid = __atomic_load_n(&rec->tid, __ATOMIC_RELAXED);
+        uint32_t stage = __atomic_load_n(&rec->stage, __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        uint64_t after = __atomic_load_n(&rec->seq, __ATOMIC_RELAXED);
+
+        if ((before != seq + 1) || (after != before)) {
+            continue;
+        }
+
+        p = line;
+        p = _dsEventTraceFmtU64(p, timestampNs);
+        *p++ = ' ';
+        p = _dsEventTraceFmtStr(p, _dsEventTraceStageName(stage));
+        p = _dsEventTraceFmtStr(p, " event=");
+        p = _dsEventTraceFmtI32(p, eventId);
+        p = _dsEventTraceFmtStr(p, " arg=");
+        p = _dsEventTraceFmtI32(p, arg);
+        p = _dsEventTraceFmtStr(p, " tid=");
+        p = _dsEventTraceFmtU64(p, tid);
+        *p++ = '\n';
+        if (write(fd, line, p - line) < 0) {
+            break;
+        }
+        written++;
+    }
+    return written;
+}
+
+
+int dsEventTraceDumpToFile(char *path, size_t size)
+{
+    char name[64];
+    int fd = -1;
+
+    /* A new file each time: nothing is truncated, and a planted link or file is skipped */
+    for (int attempt = 0; (fd < 0) && (attempt < 16); attempt++) {
+        unsigned int n = __atomic_fetch_add(&eventTraceDumps, 1, __ATOMIC_RELAXED);
+        char *p = _dsEventTraceFmtStr(name, DS_EVENT_TRACE_DEFAULT_DIR);
+        p = _dsEventTraceFmtU64(p, (uint64_t)getpid());
+        *p++ = '.';
+        p = _dsEventTraceFmtU64(p, n);
+        *p = '\0';
+        fd = open(name, O_WRONLY | O_CREAT | O_EXCL | O_NOFOLLOW | O_CLOEXEC, 0600);
+        if ((fd < 0) && (EEXIST != errno)) {
+            break;
+        }
+    }
+    if (fd < 0) {
+        return -1;
+    }
+
+    int written = dsEventTraceDump(fd);
+    close(fd);
+    if ((NULL != path) && (size > 0)) {
+        size_t i = 0;
+        for (; (i + 1 < size) && ('\0' != name[i]); i++) {
+            path[i] = name[i];
+        }
+        path[i] = '\0';
+    }
+    return written;
+}
+
+static void _dsEventTraceSignalHandler(int)
+{
+    int savedErrno = errno;
+    dsEventTraceDumpToFile(NULL, 0);
+    errno = savedErrno;
+}
+
+int dsEventTraceInstallSignalHandler(int signum)
+{
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = _dsEventTraceSignalHandler;
+    sa.sa_flags = SA_RESTART;
+    sigemptyset(&sa.sa_mask);
+    return sigaction(signum, &sa, NULL);
+}
+
+int dsEventTraceInstallFromEnv(void)
+{
+    const char *env = getenv("DS_EVENT_TRACE_SIGNAL");
+    if (NULL == env) {
+        return 0;
+    }
+    int signum = atoi(env);
+    if ((signum <= 0) || (signum >= NSIG) || (0 != dsEventTraceInstallSignalHandler(signum))) {
+        return 0;
+    }
+    return signum;
+}
+
+
+/** @} */
+/** @} */
@@ -27,6 +27,8 @@
 **/
 
 
+#define DS_LOG_MODULE dsLOG_MODULE_FPD
+
 #include <stdio.h>
 #include <string.h>
 #include "dsFPD.h"
@@ -546,5 +548,87 @@ dsError_t dsSetFPDMode (dsFPDMode_t eMode)
         return dsERR_GENERAL ;
 }
 
+dsError_t dsFPStartAnimation(const dsFPDAnimation_t *animation, unsigned int *handle)
+{
+    _DEBUG_ENTER();
+    _RETURN_IF_ERROR((animation != NULL) && (handle != NULL), dsERR_INVALID_PARAM);
+
+    dsFPDAnimParam_t param;
+    memset(&param, 0, sizeof(param));
+    param.animation = *animation;
+
+    IARM_Result_t rpcRet = IARM_Bus_Call(IARM_BUS_DSMGR_NAME,
+                            (char *)IARM_BUS_DSMGR_API_dsFPStartAnimation,
+                            (void *)&param,
+                            sizeof(param));
+
+    if (IARM_RESULT_SUCCESS != rpcRet) {
+        return dsERR_GENERAL;
+    }
+    if (dsERR_NONE == param.result) {
+        *handle = param.handle;
+    }
+    return param.result;
+}
+
+dsError_t dsFPCancelAnimation(unsigned int handle)
+{
+    _DEBUG_ENTER();
+
+    dsFPDAnimCancelParam_t param;
+    memset(&param, 0, sizeof(param));
+    param.handle = handle;
+
+    IARM_Result_t rpcRet = IARM_Bus_Call(IARM_BUS_DSMGR_NAME,
+                            (char *)IARM_BUS_DSMGR_API_dsFPCancelAnimation,
+                            (void *)&param,
+                            sizeof(param));
+
+    if (IARM_RESULT_SUCCESS != rpcRet) {
+        return dsERR_GENERAL;
+    }
+    return param.result;
+}
+
+dsError_t dsSetFPIndicatorScene(const dsFPDIndicatorScene_t *indicators, bool toPersist)
+{
+    _DEBUG_ENTER();
+    _RETURN_IF_ERROR(indicators != NULL, dsERR_INVALID_PARAM);
+
+    dsFPDSceneParam_t param;
+    memset(&param, 0, sizeof(param));
+    param.toPersist = toPersist;
+    memcpy(param.indicators, indicators, sizeof(param.indicators));
+
+    IARM_Result_t rpcRet = IARM_Bus_Call(IARM_BUS_DSMGR_NAME,
+                            (char *)IARM_BUS_DSMGR_API_dsSetFPIndicatorScene,
+                            (void *)&param,
+                            sizeof(param));
+
+    if (IARM_RESULT_SUCCESS != rpcRet) {
+        return dsERR_GENERAL;
+    }
+    return param.result;
+}
+
+dsError_t dsFPSetAutoClock(bool enable)
+{
+    _DEBUG_ENTER();
+
+    dsFPDAutoClockParam_t param;
+    memset(&param, 0, sizeof(param));
+    param.enable = enable;
+
+    IARM_Result_t rpcRet = IARM_Bus_Call(IARM_BUS_DSMGR_NAME,
+                            (char *)IARM_BUS_DSMGR_API_dsFPSetAutoClock,
+                            (void *)&param,
+                            sizeof(param));
+
+    if (IARM_RESULT_SUCCESS != rpcRet) {
+        return dsERR_GENERAL;
+    }
+    return param.result;
+}
+
 /** @} */
 /** @} */
@@ -44,6 +44,8 @@
 **/
 
 
+#define DS_LOG_MODULE dsLOG_MODULE_HDMIIN
+
 #include <stdio.h>
 #include <string.h>
 #include "dsHdmiIn.h"
@@ -264,12 +266,23 @@ dsError_t dsGetEDIDBytesInfo (dsHdmiInPort_t iHdmiPort, unsigned char *edid, int
     dsGetEDIDBytesInfoParam_t param;
     IARM_Result_t rpcRet = IARM_RESULT_SUCCESS;
     param.iHdmiPort = iHdmiPort;
+    param.capacity = DS_RPC_EDID_CAPACITY;
     rpcRet = IARM_Bus_Call(IARM_BUS_DSMGR_NAME,
                             (char *)IARM_BUS_DSMGR_API_dsGetEDIDBytesInfo,
                             (void *)&param,
-                            sizeof(param));
+                            DS_RPC_VAR_PARAM_SIZE(dsGetEDIDBytesInfoParam_t, edid, param.capacity));
+
+    if (IARM_RESULT_SUCCESS == rpcRet && param.result == dsERR_NONE &&
+        param.length > param.capacity && param.length <= (int)sizeof(param.edid))
+    {
+        param.capacity = param.length;
+        rpcRet = IARM_Bus_Call(IARM_BUS_DSMGR_NAME,
+                                (char *)IARM_BUS_DSMGR_API_dsGetEDIDBytesInfo,
+                                (void *)&param,
+                                DS_RPC_VAR_PARAM_SIZE(dsGetEDIDBytesInfoParam_t, edid, param.capacity));
+    }
 
-    if (IARM_RESULT_SUCCESS == rpcRet && param.result == dsERR_NONE && param.length > 0 && param.length <= MAX_EDID_BYTES_LEN)
+    if (IARM_RESULT_SUCCESS == rpcRet && param.result == dsERR_NONE && param.length > 0 && param.length <= param.capacity)
     {
         *length = param.length;
         memcpy_s(edid, *length, param.edid, param.length);
@@ -290,14 +303,18 @@ dsError_t dsGetHDMISPDInfo (dsHdmiInPort_t iHdmiPort, unsigned char *spdInfo)
     dsGetHDMISPDInfoParam_t param;
     IARM_Result_t rpcRet = IARM_RESULT_SUCCESS;
     param.iHdmiPort = iHdmiPort;
+    param.capacity = sizeof(struct dsSpd_infoframe_st);
     rpcRet = IARM_Bus_Call(IARM_BUS_DSMGR_NAME,
                             (char *)IARM_BUS_DSMGR_API_dsGetHDMISPDInfo,
                             (void *)&param,
-                            sizeof(param));
+                            DS_RPC_VAR_PARAM_SIZE(dsGetHDMISPDInfoParam_t, spdInfo, param.capacity));
 
     if (IARM_RESULT_SUCCESS == rpcRet)
     {
-        memcpy_s(spdInfo,sizeof(sizeof(spdInfo)), param.spdInfo, sizeof(sizeof(param.spdInfo)));
+        /* The caller's buffer holds one struct dsSpd_infoframe_st */
+        if (param.result == dsERR_NONE && param.length <= param.capacity) {
+            memcpy_s(spdInfo, sizeof(struct dsSpd_infoframe_st), param.spdInfo, param.length);
+        }
         printf("[cli] %s: dsGetHDMISPDInfo eRet: %d \r\n", __FUNCTION__, param.result);
         return param.result;
     }
@@ -546,5 +563,26 @@ dsError_t dsGetHdmiVersion (dsHdmiInPort_t iHdmiPort, dsHdmiMaxCapabilityVersion
     printf("%s:%d - dsERR_GENERAL\n", __PRETTY_FUNCTION__,__LINE__);
     return dsERR_GENERAL;
 }
+
+dsError_t dsHdmiInGetAllPortsStatus (dsHdmiInAllPortsStatus_t *pStatus)
+{
+    _DEBUG_ENTER();
+    _RETURN_IF_ERROR(pStatus != NULL, dsERR_INVALID_PARAM);
+
+    dsHdmiInAllPortsStatusParam_t param;
+    memset (&param, 0, sizeof(param));
+
+    IARM_Result_t rpcRet = IARM_Bus_Call(IARM_BUS_DSMGR_NAME,
+                            (char *)IARM_BUS_DSMGR_API_dsHdmiInGetAllPortsStatus,
+                            (void *)&param,
+                            sizeof(param));
+    if (IARM_RESULT_SUCCESS == rpcRet)
+    {
+        *pStatus = param.status;
+        return param.result;
+    }
+    printf("%s:%d - dsERR_GENERAL\n", __PRETTY_FUNCTION__,__LINE__);
+    return dsERR_GENERAL;
+}
 /** @} */
 /** @} */
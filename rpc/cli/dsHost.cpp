@@ -144,19 +144,41 @@ dsError_t dsGetSocIDFromSDK(char *socID)
     dsGetSocIDFromSDKParam_t param;
 
     param.result = dsERR_NONE;
+    param.capacity = DS_RPC_SOCID_CAPACITY;
 
     IARM_Result_t rpcRet = IARM_RESULT_SUCCESS;
 
     rpcRet = IARM_Bus_Call(IARM_BUS_DSMGR_NAME,
                 (char *)IARM_BUS_DSMGR_API_dsGetSocIDFromSDK,
                 (void *)&param,
-                sizeof(param));
+                DS_RPC_VAR_PARAM_SIZE(dsGetSocIDFromSDKParam_t, socID, param.capacity));
+
+   if ((IARM_RESULT_SUCCESS == rpcRet) && (param.length > param.capacity) &&
+       (param.length <= DS_DEVICEID_LEN_MAX))
+   {
+      param.capacity = param.length;
+      rpcRet = IARM_Bus_Call(IARM_BUS_DSMGR_NAME,
+                  (char *)IARM_BUS_DSMGR_API_dsGetSocIDFromSDK,
+                  (void *)&param,
+                  DS_RPC_VAR_PARAM_SIZE(dsGetSocIDFromSDKParam_t, socID, param.capacity));
+   }
 
    if (IARM_RESULT_SUCCESS != rpcRet)
    {
       return dsERR_GENERAL ;
    }
-   strncpy(socID, param.socID, DS_DEVICEID_LEN_MAX);
+   if (param.result != dsERR_NONE)
+   {
+      socID[0] = '\0';
+      return param.result;
+   }
+   if ((param.length <= 0) || (param.length > param.capacity))
+   {
+      socID[0] = '\0';
+      return dsERR_GENERAL;
+   }
+   strncpy(socID, param.socID, param.length);
+   socID[param.length - 1] = '\0';
    return dsERR_NONE;
 
 }
@@ -169,15 +191,29 @@ dsError_t dsGetHostEDID( unsigned char *edid, int *length)
    _DEBUG_ENTER();
 
    dsDisplayGetEDIDBytesParam_t param;
+   param.capacity = DS_RPC_EDID_CAPACITY;
    printf("dsCLI::getHostEDID \r\n");
 
    rpcRet = IARM_Bus_Call(IARM_BUS_DSMGR_NAME,
                                                         (char *)IARM_BUS_DSMGR_API_dsGetHostEDID,
                                                         (void *)&param,
-                                                        sizeof(param));
+                                                        DS_RPC_VAR_PARAM_SIZE(dsDisplayGetEDIDBytesParam_t, bytes, param.capacity));
+
+   if ((IARM_RESULT_SUCCESS == rpcRet) && (param.result == dsERR_NONE) &&
+       (param.length > param.capacity) && (param.length <= (int)sizeof(param.bytes)))
+   {
+        param.capacity = param.length;
+        rpcRet = IARM_Bus_Call(IARM_BUS_DSMGR_NAME,
+                               (char *)IARM_BUS_DSMGR_API_dsGetHostEDID,
+                               (void *)&param,
+                               DS_RPC_VAR_PARAM_SIZE(dsDisplayGetEDIDBytesParam_t, bytes, param.capacity));
+   }
 
    if (IARM_RESULT_SUCCESS == rpcRet)
    {
+        if ((param.result == dsERR_NONE) && (param.length > param.capacity)) {
+            return dsERR_GENERAL;
+        }
         if (param.result == dsERR_NONE) {
             printf("dsCLI ::getHostEDID returns %d bytes\r\n", param.length);
                 rc = memcpy_s((void *)edid,param.length, param.bytes, param.length);
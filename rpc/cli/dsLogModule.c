@@ -0,0 +1,208 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2016 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+
+/**
+* @defgroup devicesettings
+* @{
+* @defgroup rpc
+* @{
+**/
+
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/inotify.h>
+
+#include "dsLogModule.h"
+
+int dsLogModuleLevels[dsLOG_MODULE_MAX] = {
+    dsLOG_LEVEL_DEFAULT, dsLOG_LEVEL_DEFAULT, dsLOG_LEVEL_DEFAULT, dsLOG_LEVEL_DEFAULT,
+    dsLOG_LEVEL_DEFAULT, dsLOG_LEVEL_DEFAULT, dsLOG_LEVEL_DEFAULT
+};
+
+static const char *dsLogModuleNames[dsLOG_MODULE_MAX] = {
+    "general", "audio", "videoport", "display", "hdmiin", "fpd", "persistence"
+};
+
+static const char *dsLogLevelNames[dsLOG_LEVEL_MAX] = {
+    "off", "error", "warn", "info", "debug", "trace"
+};
+
+static char dsLogConfigPath[256];
+static int dsLogWatcherStarted = 0;
+
+int dsLogModuleSetLevel(int module, int level)
+{
+    if ((level < dsLOG_LEVEL_OFF) || (level >= dsLOG_LEVEL_MAX)) {
+        return -1;
+    }
+    if (-1 == module) {
+        for (int i = 0; i < dsLOG_MODULE_MAX; i++) {
+            __atomic_store_n(&dsLogModuleLevels[i], level, __ATOMIC_RELAXED);
+        }
+        return 0;
+    }
+    if ((module < 0) || (module >= dsLOG_MODULE_MAX)) {
+        return -1;
+    }
+    __atomic_store_n(&dsLogModuleLevels[module], level, __ATOMIC_RELAXED);
+    return 0;
+}
+
+int dsLogModuleGetLevel(int module)
+{
+    if ((module < 0) || (module >= dsLOG_MODULE_MAX)) {
+        return -1;
+    }
+    return __atomic_load_n(&dsLogModuleLevels[module], __ATOMIC_RELAXED);
+}
+
+const char *dsLogModuleName(int module)
+{
+    return ((module >= 0) && (module < dsLOG_MODULE_MAX)) ? dsLogModuleNames[module] : "unknown";
+}
+
+static char *dsLogTrim(char *s)
+{
+    while (isspace((unsigned char)*s)) {
+        s++;
+    }
+    char *end = s + strlen(s);
+    while ((end > s) && isspace((unsigned char)end[-1])) {
+        *--end = '\0';
+    }
+    return s;
+}
+
+int dsLogModuleLoadConfig(const char *path)
+{
+    char line[128];
+    int applied = 0;
+    FILE *file = fopen(path, "r");
+
+    if (NULL == file) {
+        return -1;
+    }
+
+    while (fgets(line, sizeof(line), file)) {
+        char *entry = dsLogTrim(line);
+        char *sep = strchr(entry, '=');
+        int module = -2, level = -1;
+
+        if (('\0' == entry[0]) || ('#' == entry[0]) || (NULL == sep)) {
+            continue;
+        }
+        *sep = '\0';
+        char *name = dsLogTrim(entry);
+        char *value = dsLogTrim(sep + 1);
+
+        if (0 == strcasecmp(name, "all")) {
+            module = -1;
+        }
+        for (int i = 0; (i < dsLOG_MODULE_MAX) && (-2 == module); i++) {
+            if (0 == strcasecmp(name, dsLogModuleNames[i])) {
+                module = i;
+            }
+        }
+        for (int i = 0; i < dsLOG_LEVEL_MAX; i++) {
+            if (0 == strcasecmp(value, dsLogLevelNames[i])) {
+                level = i;
+                break;
+            }
+        }
+        if ((-2 != module) && (0 == dsLogModuleSetLevel(module, level))) {
+            applied++;
+        }
+    }
+
+    fclose(file);
+    return applied;
+}
+
+static void *dsLogConfigWatcher(void *arg)
+{
+    int fd = (int)(intptr_t)arg;
+    const char *base = strrchr(dsLogConfigPath, '/');
+    char buf[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+
+    base = base ? base + 1 : dsLogConfigPath;
+    for (;;) {
+        ssize_t len = read(fd, buf, sizeof(buf));
+        if (len <= 0) {
+            break;
+        }
+        for (char *p = buf; p < buf + len; ) {
+            struct inotify_event *event = (struct inotify_event *)p;
+            if ((event->len > 0) && (0 == strcmp(event->name, base))) {
+                dsLogModuleLoadConfig(dsLogConfigPath);
+            }
+            p += sizeof(struct inotify_event) + event->len;
+        }
+    }
+    close(fd);
+    return NULL;
+}
+
+int dsLogModuleWatchConfig(const char *path)
+{
+    char dir[256];
+    pthread_t thread;
+
+    if (__atomic_exchange_n(&dsLogWatcherStarted, 1, __ATOMIC_ACQ_REL)) {
+        return 0;
+    }
+
+    snprintf(dsLogConfigPath, sizeof(dsLogConfigPath), "%s", path);
+    dsLogModuleLoadConfig(dsLogConfigPath);
+
+    snprintf(dir, sizeof(dir), "%s", dsLogConfigPath);
+    char *slash = strrchr(dir, '/');
+    if (NULL == slash) {
+        snprintf(dir, sizeof(dir), ".");
+    } else if (slash == dir) {
+        dir[1] = '\0';
+    } else {
+        *slash = '\0';
+    }
+
+    int fd = inotify_init1(IN_CLOEXEC);
+    if (fd < 0) {
+        __atomic_store_n(&dsLogWatcherStarted, 0, __ATOMIC_RELEASE);
+        return -1;
+    }
+    if ((inotify_add_watch(fd, dir, IN_CLOSE_WRITE | IN_MOVED_TO) < 0) ||
+        (0 != pthread_create(&thread, NULL, dsLogConfigWatcher, (void *)(intptr_t)fd))) {
+        close(fd);
+        __atomic_store_n(&dsLogWatcherStarted, 0, __ATOMIC_RELEASE);
+        return -1;
+    }
+    pthread_detach(thread);
+    return 0;
+}
+
+
+/** @} */
+/** @} */
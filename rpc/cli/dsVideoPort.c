@@ -26,6 +26,8 @@
 **/
 
 
+#define DS_LOG_MODULE dsLOG_MODULE_VIDEOPORT
+
 #include "dsVideoPort.h"
 #include <sys/types.h>
 #include <stdint.h>
@@ -0,0 +1,101 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2025 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+
+/**
+* @defgroup devicesettings
+* @{
+* @defgroup rpc
+* @{
+**/
+
+
+/**
+ * @file dsAVLatencyFilter.h
+ * @brief Filter between the HAL AV latency updates and their broadcast.
+ *
+ * A source switching modes makes the HAL report a burst of latencies, and
+ * every listener re-tunes its audio delay for each. Raw updates go through
+ * three stages before they are published:
+ *
+ *   minChangeMs    a value closer than this to the published one (audio and
+ *                  video alike) is ignored, and drops a pending change
+ *   settleMs       a change is published only once it has held this long;
+ *                  a newer value restarts the wait, but a change is never
+ *                  held back longer than the larger of settleMs and
+ *                  minIntervalMs after it first came in
+ *   minIntervalMs  at most one publication per interval; the last value of
+ *                  a burst is still published when the interval ends
+ *
+ * A stage set to 0 is skipped, so all three at 0 publish every update. The
+ * first update is published right away. The publish callback is called
+ * from the filter thread without any lock of this module held. The raw and
+ * published counts also go out as the HDMI_INFO_avlatency_raw and
+ * HDMI_INFO_avlatency_published telemetry counters.
+ */
+
+#ifndef _DS_AVLATENCY_FILTER_H_
+#define _DS_AVLATENCY_FILTER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DS_AVLATENCY_MIN_CHANGE_MS      10
+#define DS_AVLATENCY_SETTLE_MS          200
+#define DS_AVLATENCY_MIN_INTERVAL_MS    1000
+
+typedef struct _dsAVLatencyFilterConfig_t {
+    unsigned int minChangeMs;
+    unsigned int settleMs;
+    unsigned int minIntervalMs;
+} dsAVLatencyFilterConfig_t;
+
+typedef struct _dsAVLatencyFilterStats_t {
+    unsigned long raw;          /* updates received from the HAL */
+    unsigned long published;    /* updates broadcast */
+} dsAVLatencyFilterStats_t;
+
+/** @brief Broadcast a latency that passed the filter. */
+typedef void (*dsAVLatencyPublishFn)(int audioLatency, int videoLatency);
+
+/**
+ * @brief Start the filter thread, or apply a new config if it runs.
+ * @return 0 on success, -1 if the thread could not be started.
+ */
+int dsAVLatencyFilterStart(const dsAVLatencyFilterConfig_t *config, dsAVLatencyPublishFn publish);
+
+/** @brief Stop the filter thread; a pending change is dropped. */
+void dsAVLatencyFilterStop(void);
+
+/** @brief Feed a HAL update; it is published right away while the filter is stopped. */
+void dsAVLatencyFilterUpdate(int audioLatency, int videoLatency);
+
+/** @brief Counters since the filter was first started. */
+void dsAVLatencyFilterGetStats(dsAVLatencyFilterStats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _DS_AVLATENCY_FILTER_H_ */
+
+
+/** @} */
+/** @} */
@@ -0,0 +1,80 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2025 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+
+/**
+* @defgroup devicesettings
+* @{
+* @defgroup rpc
+* @{
+**/
+
+
+/**
+ * @file dsAudioDucking.h
+ * @brief Arbiter of the ducking requests of several sources.
+ *
+ * Each source (voice assistant, notification, accessibility, ...) keeps at
+ * most one active request per port in a small stack of that port. The
+ * request of highest priority decides the ducked level of the port, the
+ * latest one among equal priorities; starting or stopping a request below
+ * it leaves the level as is. A port ducks while any of its requests is
+ * active.
+ *
+ * The stack has no lock of its own; dsMgr calls it under its audio lock.
+ */
+
+#ifndef _DS_AUDIO_DUCKING_H_
+#define _DS_AUDIO_DUCKING_H_
+
+#include "dsRpc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DS_AUDIO_DUCKING_SOURCES_MAX    8       /* per port */
+#define DS_AUDIO_DUCKING_REQUESTS_MAX   16      /* over all ports */
+
+/**
+ * @brief Start or update the request of source on port handle.
+ * @return dsERR_INVALID_PARAM for a level above 100,
+ *         dsERR_RESOURCE_NOT_AVAILABLE when DS_AUDIO_DUCKING_SOURCES_MAX sources duck the port
+ *         or DS_AUDIO_DUCKING_REQUESTS_MAX requests are active.
+ */
+dsError_t dsAudioDuckingPush(intptr_t handle, unsigned int source, int priority, dsAudioDuckingType_t type, unsigned char level);
+
+/** @brief Stop the request of source on port handle; returns false if it had none. */
+bool dsAudioDuckingPop(intptr_t handle, unsigned int source);
+
+/** @brief Whether any source ducks port handle. */
+bool dsAudioDuckingActive(intptr_t handle);
+
+/** @brief Level to apply to port handle for the user volume, which is volume itself when no source ducks it. */
+int dsAudioDuckingLevel(intptr_t handle, float volume);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _DS_AUDIO_DUCKING_H_ */
+
+
+/** @} */
+/** @} */
@@ -0,0 +1,95 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2025 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+
+/**
+* @defgroup devicesettings
+* @{
+* @defgroup rpc
+* @{
+**/
+
+
+/**
+ * @file dsAudioRamp.h
+ * @brief Audio level ramps run by a dsMgr timer thread.
+ *
+ * A ramp moves a level from one value to another over a duration, one step
+ * every DS_AUDIO_RAMP_TICK_MS, along a dsAudioRampCurve_t. Each audio port
+ * handle has one ramp per channel (e.g. the user volume and the ducking
+ * fade); starting a ramp replaces the one running on the same handle and
+ * channel.
+ *
+ * Steps are delivered through the apply callback, called from the ramp
+ * thread without any lock of this module held, so the callback may take
+ * the caller's own lock. As a step may race with a cancel or a newer ramp
+ * made under that lock, the callback must drop steps for which
+ * dsAudioRampIsCurrent() is false. The last step has last set and the
+ * exact target level; the callback reports it applied with
+ * dsAudioRampDone(), still under its lock, so that a later cancel does not
+ * return the target again.
+ */
+
+#ifndef _DS_AUDIO_RAMP_H_
+#define _DS_AUDIO_RAMP_H_
+
+#include <stdint.h>
+#include "dsRpc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DS_AUDIO_RAMP_MAX           8
+#define DS_AUDIO_RAMP_TICK_MS       20
+
+typedef void (*dsAudioRampApplyFn)(intptr_t handle, int channel, unsigned int id, float level, bool last);
+
+/**
+ * @brief Start a ramp, replacing the one of handle and channel.
+ * @return dsERR_INVALID_PARAM for a bad curve or duration,
+ *         dsERR_RESOURCE_NOT_AVAILABLE when DS_AUDIO_RAMP_MAX ramps run.
+ */
+dsError_t dsAudioRampStart(intptr_t handle, int channel, float from, float to, unsigned int durationMs,
+                           dsAudioRampCurve_t curve, dsAudioRampApplyFn apply, unsigned int *id);
+
+/** @brief Cancel the ramp of handle and channel; returns true and its target if one was running. */
+bool dsAudioRampCancel(intptr_t handle, int channel, float *target);
+
+/** @brief Whether id is still the ramp of handle and channel, i.e. its steps may be applied. */
+bool dsAudioRampIsCurrent(intptr_t handle, int channel, unsigned int id);
+
+/** @brief The last step of id was applied. */
+void dsAudioRampDone(intptr_t handle, int channel, unsigned int id);
+
+/** @brief Level of curve at t in [0, 1] between from and to. */
+float dsAudioRampLevelAt(dsAudioRampCurve_t curve, float from, float to, float t);
+
+/** @brief Cancel every ramp and stop the ramp thread. */
+void dsAudioRampTerm(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _DS_AUDIO_RAMP_H_ */
+
+
+/** @} */
+/** @} */
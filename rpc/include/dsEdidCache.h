@@ -0,0 +1,196 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2025 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+
+/**
+* @defgroup devicesettings
+* @{
+* @defgroup rpc
+* @{
+**/
+
+
+/**
+ * @file dsEdidCache.h
+ * @brief Small LRU of EDID derived results keyed by the raw EDID bytes.
+ *
+ * Used by dsMgr to keep the filtered dsDisplayEDID_t of recently seen
+ * displays. dsMgr lives across hotplugs, so replugging a known display skips
+ * the HAL parse and the filtering. Entries are found by a 64-bit
+ * hash of the bytes and confirmed with a full compare, so a hash collision
+ * can never return the wrong display. T must be trivially copyable.
+ */
+
+#ifndef _DS_EDID_CACHE_H_
+#define _DS_EDID_CACHE_H_
+
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+
+#ifndef DS_EDID_CACHE_ENTRIES
+#define DS_EDID_CACHE_ENTRIES       8
+#endif
+
+#define DS_EDID_CACHE_MAX_BYTES     1024
+
+/**
+ * @brief 64-bit hash of the EDID bytes, processed a word at a time.
+ */
+inline uint64_t dsEdidHash(const unsigned char *bytes, size_t length)
+{
+    const uint64_t k = 0x9FB21C651E98DF25ULL;
+    uint64_t h = 0x9E3779B97F4A7C15ULL ^ (length * k);
+    size_t i = 0;
+
+    for (; i + 8 <= length; i += 8) {
+        uint64_t w;
+        memcpy(&w, bytes + i, sizeof(w));
+        h = (h ^ w) * k;
+        h ^= h >> 29;
+    }
+    if (i < length) {
+        uint64_t w = 0;
+        memcpy(&w, bytes + i, length - i);
+        h = (h ^ w) * k;
+        h ^= h >> 29;
+    }
+    h ^= h >> 32;
+    h *= k;
+    h ^= h >> 29;
+    return h;
+}
+
+template <typename T, unsigned int N = DS_EDID_CACHE_ENTRIES>
+class dsEdidCache {
+public:
+    dsEdidCache() : m_clock(0), m_hits(0), m_misses(0)
+    {
+        pthread_mutex_init(&m_lock, NULL);
+        clear();
+    }
+
+    ~dsEdidCache()
+    {
+        pthread_mutex_destroy(&m_lock);
+    }
+
+    /**
+     * @brief Copy the result cached for these EDID bytes into value.
+     * @return true on a hit.
+     */
+    bool lookup(const unsigned char *bytes, size_t length, T *value)
+    {
+        if ((NULL == bytes) || (0 == length) || (length > DS_EDID_CACHE_MAX_BYTES)) {
+            return false;
+        }
+        const uint64_t hash = dsEdidHash(bytes, length);
+        bool found = false;
+
+        pthread_mutex_lock(&m_lock);
+        Entry *entry = find(hash, bytes, length);
+        if (entry) {
+            entry->lastUse = ++m_clock;
+            memcpy(value, &entry->value, sizeof(T));
+            found = true;
+            __atomic_fetch_add(&m_hits, 1, __ATOMIC_RELAXED);
+        } else {
+            __atomic_fetch_add(&m_misses, 1, __ATOMIC_RELAXED);
+        }
+        pthread_mutex_unlock(&m_lock);
+        return found;
+    }
+
+    /**
+     * @brief Cache value for these EDID bytes, evicting the least recently used entry.
+     */
+    void insert(const unsigned char *bytes, size_t length, const T &value)
+    {
+        if ((NULL == bytes) || (0 == length) || (length > DS_EDID_CACHE_MAX_BYTES)) {
+            return;
+        }
+        const uint64_t hash = dsEdidHash(bytes, length);
+
+        pthread_mutex_lock(&m_lock);
+        Entry *entry = find(hash, bytes, length);
+        if (NULL == entry) {
+            entry = &m_entries[0];
+            for (unsigned int i = 1; i < N; i++) {
+                if (m_entries[i].lastUse < entry->lastUse) {
+                    entry = &m_entries[i];
+                }
+            }
+            entry->hash = hash;
+            entry->length = length;
+            memcpy(entry->bytes, bytes, length);
+        }
+        entry->lastUse = ++m_clock;
+        memcpy(&entry->value, &value, sizeof(T));
+        pthread_mutex_unlock(&m_lock);
+    }
+
+    void clear()
+    {
+        pthread_mutex_lock(&m_lock);
+        for (unsigned int i = 0; i < N; i++) {
+            m_entries[i].lastUse = 0;
+            m_entries[i].length = 0;
+        }
+        pthread_mutex_unlock(&m_lock);
+    }
+
+    unsigned long hits() const { return __atomic_load_n(&m_hits, __ATOMIC_RELAXED); }
+    unsigned long misses() const { return __atomic_load_n(&m_misses, __ATOMIC_RELAXED); }
+
+private:
+    struct Entry {
+        uint64_t hash;
+        uint64_t lastUse;       /* 0 while the slot is empty */
+        size_t length;
+        unsigned char bytes[DS_EDID_CACHE_MAX_BYTES];
+        T value;
+    };
+
+    Entry *find(uint64_t hash, const unsigned char *bytes, size_t length)
+    {
+        for (unsigned int i = 0; i < N; i++) {
+            Entry *entry = &m_entries[i];
+            if (entry->lastUse && (entry->hash == hash) && (entry->length == length) &&
+                (0 == memcmp(entry->bytes, bytes, length))) {
+                return entry;
+            }
+        }
+        return NULL;
+    }
+
+    dsEdidCache(const dsEdidCache &);
+    dsEdidCache &operator=(const dsEdidCache &);
+
+    pthread_mutex_t m_lock;
+    uint64_t m_clock;
+    unsigned long m_hits;
+    unsigned long m_misses;
+    Entry m_entries[N];
+};
+
+#endif /* _DS_EDID_CACHE_H_ */
+
+
+/** @} */
+/** @} */
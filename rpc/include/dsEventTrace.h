@@ -0,0 +1,204 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2025 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+
+/**
+* @defgroup devicesettings
+* @{
+* @defgroup rpc
+* @{
+**/
+
+
+/**
+ * @file dsEventTrace.h
+ * @brief Lock-free ring buffer recording timestamps of DS event delivery.
+ *
+ * Every event that travels HAL callback -> dsMgr broadcast -> IarmImpl handler
+ * -> listener return leaves one record per stage. Records carry a
+ * CLOCK_MONOTONIC timestamp, which is system wide, so rings dumped from dsMgr
+ * and from a client process can be merged on (eventId, timestamp) to obtain
+ * the end-to-end latency of each hop.
+ *
+ * Recording is a relaxed fetch-add plus a handful of stores; it never blocks,
+ * never allocates and is safe from any thread. Dumping only uses write(2) and
+ * is async-signal-safe, so it may be done from a signal handler.
+ *
+ * Define DS_EVENT_TRACE_DISABLED to compile the recording points out.
+ */
+
+#ifndef _DS_EVENT_TRACE_H_
+#define _DS_EVENT_TRACE_H_
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+
+/** Number of records kept per process. Must be a power of two. */
+#ifndef DS_EVENT_TRACE_RING_SIZE
+#define DS_EVENT_TRACE_RING_SIZE 1024
+#endif
+
+#if (DS_EVENT_TRACE_RING_SIZE & (DS_EVENT_TRACE_RING_SIZE - 1)) != 0
+#error "DS_EVENT_TRACE_RING_SIZE must be a power of two"
+#endif
+
+/** Prefix of the dump files, followed by "<pid>.<n>". */
+#define DS_EVENT_TRACE_DEFAULT_DIR "/tmp/ds_event_trace."
+
+/**
+ * @brief Stages of event delivery recorded in the ring.
+ */
+typedef enum _dsEventTraceStage_t {
+    dsEVENT_TRACE_HAL_CALLBACK = 0,    /**< HAL callback entered in dsMgr          */
+    dsEVENT_TRACE_BROADCAST_BEGIN,     /**< dsMgr about to call IARM broadcast      */
+    dsEVENT_TRACE_BROADCAST_END,       /**< IARM broadcast returned in dsMgr        */
+    dsEVENT_TRACE_IARM_HANDLER,        /**< Client IARM event handler entered       */
+    dsEVENT_TRACE_LISTENER_RETURN,     /**< One client listener returned            */
+    dsEVENT_TRACE_DISPATCH_DONE,       /**< All client listeners notified           */
+    dsEVENT_TRACE_STAGE_MAX
+} dsEventTraceStage_t;
+
+/**
+ * @brief One trace record. Fields are accessed atomically so that a reader
+ * racing with a writer sees either the old or the new value, never a torn one.
+ */
+typedef struct _dsEventTraceRecord_t {
+    uint64_t seq;          /**< Write sequence + 1, zero while the slot is being written */
+    uint64_t timestampNs;  /**< CLOCK_MONOTONIC in nanoseconds                          */
+    int32_t  eventId;      /**< IARM_Bus_DSMgr_EventId_t of the event                    */
+    int32_t  arg;          /**< Stage specific argument (port, HAL event, listener index) */
+    uint32_t tid;          /**< Kernel thread id of the recorder                          */
+    uint32_t stage;        /**< dsEventTraceStage_t                                       */
+} dsEventTraceRecord_t;
+
+typedef struct _dsEventTraceRing_t {
+    uint64_t head;
+    dsEventTraceRecord_t records[DS_EVENT_TRACE_RING_SIZE];
+} dsEventTraceRing_t;
+
+/**
+ * @brief The ring of the process. It is defined once, in libdshalcli, which
+ * libdshalsrv and libds both link, so every recorder of a process shares it.
+ */
+dsEventTraceRing_t *dsEventTraceRing(void);
+
+inline uint64_t dsEventTraceNow()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+inline uint32_t dsEventTraceTid()
+{
+    static __thread uint32_t tid = 0;
+    if (0 == tid) {
+        tid = (uint32_t)syscall(SYS_gettid);
+    }
+    return tid;
+}
+
+/**
+ * @brief Record a stage with a timestamp captured earlier by dsEventTraceNow().
+ */
+inline void dsEventTraceRecordAt(uint64_t timestampNs, dsEventTraceStage_t stage, int eventId, int arg)
+{
+#ifndef DS_EVENT_TRACE_DISABLED
+    dsEventTraceRing_t *ring = dsEventTraceRing();
+    uint64_t seq = __atomic_fetch_add(&ring->head, 1, __ATOMIC_RELAXED);
+    dsEventTraceRecord_t *rec = &ring->records[seq & (DS_EVENT_TRACE_RING_SIZE - 1)];
+
+    __atomic_store_n(&rec->seq, 0, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_store_n(&rec->timestampNs, timestampNs, __ATOMIC_RELAXED);
+    __atomic_store_n(&rec->eventId, (int32_t)eventId, __ATOMIC_RELAXED);
+    __atomic_store_n(&rec->arg, (int32_t)arg, __ATOMIC_RELAXED);
+    __atomic_store_n(&rec->tid, dsEventTraceTid(), __ATOMIC_RELAXED);
+    __atomic_store_n(&rec->stage, (uint32_t)stage, __ATOMIC_RELAXED);
+    __atomic_store_n(&rec->seq, seq + 1, __ATOMIC_RELEASE);
+#else
+    (void)timestampNs; (void)stage; (void)eventId; (void)arg;
+#endif
+}
+
+/**
+ * @brief Record a stage of event delivery, timestamped now.
+ */
+inline void dsEventTraceRecord(dsEventTraceStage_t stage, int eventId, int arg)
+{
+#ifndef DS_EVENT_TRACE_DISABLED
+    dsEventTraceRecordAt(dsEventTraceNow(), stage, eventId, arg);
+#else
+    (void)stage; (void)eventId; (void)arg;
+#endif
+}
+
+/**
+ * @brief Write the ring, oldest record first, to an open file descriptor.
+ *
+ * One line per record: "<timestamp_ns> <stage> event=<id> arg=<arg> tid=<tid>".
+ * Slots being overwritten while dumping are skipped. Async-signal-safe.
+ *
+ * @return Number of records written.
+ */
+int dsEventTraceDump(int fd);
+
+/**
+ * @brief Dump the ring to a new file DS_EVENT_TRACE_DEFAULT_DIR<pid>.<n>.
+ *
+ * The name is generated and the file created exclusively, never following
+ * a symbolic link, so an existing file is never overwritten. Async-signal-safe.
+ *
+ * @param[out] path  Name of the file written, may be NULL
+ * @param[in]  size  Size of path
+ *
+ * @return Number of records written, or -1 if no file could be created.
+ */
+int dsEventTraceDumpToFile(char *path, size_t size);
+
+/**
+ * @brief Dump the ring whenever signum is delivered.
+ *
+ * Opt-in: a process calls this with the signal number of its choice, e.g.
+ * taken from the DS_EVENT_TRACE_SIGNAL environment variable.
+ *
+ * @return 0 on success, -1 if the handler could not be installed.
+ */
+int dsEventTraceInstallSignalHandler(int signum);
+
+/**
+ * @brief Install the dump signal handler if DS_EVENT_TRACE_SIGNAL is set in
+ * the environment to a valid signal number.
+ *
+ * @return The installed signal number, or 0 when tracing dumps are not requested.
+ */
+int dsEventTraceInstallFromEnv(void);
+
+#endif /* _DS_EVENT_TRACE_H_ */
+
+
+/** @} */
+/** @} */
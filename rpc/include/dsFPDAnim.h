@@ -0,0 +1,95 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2025 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+
+/**
+* @defgroup devicesettings
+* @{
+* @defgroup rpc
+* @{
+**/
+
+
+/**
+ * @file dsFPDAnim.h
+ * @brief Front panel text animations run inside dsMgr.
+ *
+ * Apps submit a whole animation (dsFPDAnimation_t) in one call instead of
+ * sending a dsSetFPText RPC per frame. Each animation keeps the time its
+ * next step is due and a single timerfd is armed for the earliest one, so
+ * the timer thread only wakes to change a frame. Running animations
+ * stack: the most recently started one owns the text display, and when it
+ * ends or is cancelled the next one repaints its current frame. Frames are
+ * drawn through the callback given to dsFPDAnimInit(), which applies the
+ * text/clock mode arbitration, and the idle callback hands the display
+ * back once the last animation ended or was cancelled.
+ *
+ * The callbacks are called with the animation lock held, so the functions
+ * below must not be called while holding the lock the callbacks take.
+ */
+
+#ifndef _DS_FPDANIM_H_
+#define _DS_FPDANIM_H_
+
+#include "dsError.h"
+#include "dsRpc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DS_FPD_ANIM_MAX             8
+
+/** @brief Show text on the display; returns false when it was not shown (e.g. clock mode). */
+typedef bool (*dsFPDAnimDrawFn)(const char *text);
+
+/** @brief Called when no animation covers the display any more. */
+typedef void (*dsFPDAnimIdleFn)(void);
+
+/** @brief Set the callbacks. The timer thread starts with the first animation. */
+void dsFPDAnimInit(dsFPDAnimDrawFn draw, dsFPDAnimIdleFn idle);
+
+/** @brief Cancel every animation and stop the timer thread. */
+void dsFPDAnimTerm(void);
+
+/**
+ * @brief Start an animation; its first frame is drawn before this returns.
+ * @return dsERR_INVALID_PARAM for a malformed animation,
+ *         dsERR_RESOURCE_NOT_AVAILABLE when DS_FPD_ANIM_MAX are running.
+ */
+dsError_t dsFPDAnimSubmit(const dsFPDAnimation_t *animation, unsigned int *handle);
+
+/** @brief Cancel the animation handle, or every animation for 0. */
+dsError_t dsFPDAnimCancel(unsigned int handle);
+
+/** @brief Cancel every animation without calling the idle callback, for callers that draw right away. */
+void dsFPDAnimStop(void);
+
+/** @brief Draw the current frame again, e.g. when the display returns to text mode. */
+void dsFPDAnimRedraw(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _DS_FPDANIM_H_ */
+
+
+/** @} */
+/** @} */
@@ -0,0 +1,70 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2025 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+
+/**
+* @defgroup devicesettings
+* @{
+* @defgroup rpc
+* @{
+**/
+
+
+/**
+ * @file dsFPDClock.h
+ * @brief Front panel clock updated by dsMgr itself.
+ *
+ * A thread waits on a CLOCK_REALTIME timerfd that expires on every minute
+ * boundary and calls the draw callback with the local time. Setting the
+ * system time cancels the timer, so the clock is redrawn and realigned
+ * right away. The local time is that of the device time zone, i.e.
+ * /etc/localtime, which is read again on every draw so a zone change shows
+ * at the next minute; a TZ set in dsMgr's environment takes precedence. Whether the clock is shown at all (mode, standby, an app
+ * driving it) is up to the callback, which is called without any lock of
+ * this module held.
+ */
+
+#ifndef _DS_FPDCLOCK_H_
+#define _DS_FPDCLOCK_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Show hours:minutes on the clock display; returns false when it was not shown. */
+typedef bool (*dsFPDClockDrawFn)(unsigned int hours, unsigned int minutes);
+
+/** @brief Start the clock thread; it draws once right away. Returns 0 on success. */
+int dsFPDClockStart(dsFPDClockDrawFn draw);
+
+/** @brief Stop the clock thread. */
+void dsFPDClockStop(void);
+
+/** @brief Draw the current time now, e.g. after the clock was resumed or its format changed. */
+void dsFPDClockRefresh(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _DS_FPDCLOCK_H_ */
+
+
+/** @} */
+/** @} */
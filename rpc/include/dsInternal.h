@@ -470,6 +470,44 @@ dsError_t dsResetVolumeLeveller(intptr_t handle);
  */
 dsError_t  dsSetAudioDucking(intptr_t handle, dsAudioDuckingAction_t action, dsAudioDuckingType_t type, const unsigned char level);
 
+/**
+ * @brief Starts or stops the ducking request of one source
+ *
+ * dsMgr keeps the active request of each source. The one of highest priority
+ * decides the ducked level, the latest among equal priorities, and the HAL
+ * is only called when that level changes. Requests of ::dsSetAudioDucking
+ * come from source DS_AUDIO_DUCKING_SOURCE_DEFAULT at priority 0.
+ *
+ * @param[in] handle    - Handle for the output audio port
+ * @param[in] source    - Id of the source, chosen by the caller; DS_AUDIO_DUCKING_SOURCE_DEFAULT is reserved
+ * @param[in] priority  - Higher priorities take over from lower ones
+ * @param[in] action    - action type to start or stop ducking. Please refer ::dsAudioDuckingAction_t
+ * @param[in] type      - ducking type is absolute or relative to current volume level. Please refer ::dsAudioDuckingType_t
+ * @param[in] level     - The volume level value from 0 to 100 to be used on the audio port
+ *
+ * @return Device Settings error code
+ * @retval    ::dsError_t
+ */
+dsError_t dsSetAudioDuckingSource(intptr_t handle, unsigned int source, int priority,
+                                  dsAudioDuckingAction_t action, dsAudioDuckingType_t type, const unsigned char level);
+
+/**
+ * @brief Moves the audio level of a port to target over durationMs
+ *
+ * dsMgr applies the level in steps from its ramp thread. A later set, ramp or
+ * ducking request on the port takes over from a running ramp. Only the target
+ * level is persisted and broadcast, when it is reached.
+ *
+ * @param[in] handle      - Handle for the output audio port
+ * @param[in] target      - The volume level value from 0 to 100 to reach
+ * @param[in] durationMs  - Length of the ramp, up to DS_AUDIO_RAMP_DURATION_MAX_MS; 0 sets the level at the next step
+ * @param[in] curve       - Shape of the ramp. Please refer ::dsAudioRampCurve_t
+ *
+ * @return Device Settings error code
+ * @retval    ::dsError_t
+ */
+dsError_t dsAudioRampLevel(intptr_t handle, float target, unsigned int durationMs, dsAudioRampCurve_t curve);
+
 /**
  * @brief Gets the audio HDMI ARC port ID for each platform
  *
@@ -482,6 +520,92 @@ dsError_t  dsSetAudioDucking(intptr_t handle, dsAudioDuckingAction_t action, dsA
  */
 dsError_t dsGetHDMIARCPortId(int *portId);
 
+/**
+ * @brief Gets the EDID state of a display
+ *
+ * dsMgr reads the EDID after every HDMI hotplug and broadcasts
+ * IARM_BUS_DSMGR_EVENT_EDID_READY once it verifies; this returns the same
+ * state without transferring the EDID bytes. It never reads the HAL, an
+ * invalid state only asks the dsMgr probe thread to read the EDID again.
+ *
+ * @param[in] handle       - Handle of the display device
+ * @param[out] valid       - true if a verified EDID is available
+ * @param[out] generation  - Hotplug generation, bumped on every connect and disconnect
+ *
+ * @return Device Settings error code
+ * @retval    ::dsError_t
+ */
+dsError_t dsGetEDIDState(intptr_t handle, bool *valid, unsigned int *generation);
+
+/**
+ * @brief Starts a front panel text animation in dsMgr
+ *
+ * dsMgr draws the frames itself until the animation ends or is cancelled;
+ * the most recently started animation owns the display. Frames are not
+ * shown while the display is in clock mode, and dsSetFPText() cancels all
+ * animations.
+ *
+ * @param[in] animation  - The animation, see ::dsFPDAnimation_t
+ * @param[out] handle    - Handle to cancel the animation with
+ *
+ * @return Device Settings error code
+ * @retval    ::dsError_t
+ */
+dsError_t dsFPStartAnimation(const dsFPDAnimation_t *animation, unsigned int *handle);
+
+/**
+ * @brief Cancels a front panel text animation
+ *
+ * @param[in] handle  - Handle returned by dsFPStartAnimation(), 0 for all animations
+ *
+ * @return Device Settings error code
+ * @retval    ::dsError_t
+ */
+dsError_t dsFPCancelAnimation(unsigned int handle);
+
+/**
+ * @brief Lets dsMgr update the front panel clock by itself
+ *
+ * When enabled (the default) dsMgr shows the local time on every minute
+ * boundary, in the current time format, unless the display is in text
+ * mode, shows text, or the clock display is disabled. dsSetFPTime()
+ * disables it, as the app then drives the clock.
+ *
+ * @param[in] enable  - true to update the clock automatically
+ *
+ * @return Device Settings error code
+ * @retval    ::dsError_t
+ */
+dsError_t dsFPSetAutoClock(bool enable);
+
+/**
+ * @brief Applies the settings of all front panel indicators at once
+ *
+ * dsMgr compares every indicator with what it last gave the HAL, makes only
+ * the calls needed for the differences while holding its lock once, and
+ * persists the power indicator brightness and color with one write.
+ *
+ * @param[in] indicators  - dsFPD_INDICATOR_MAX entries, indexed by ::dsFPDIndicator_t
+ * @param[in] toPersist   - Persist the power indicator brightness and color
+ *
+ * @return Device Settings error code
+ * @retval    ::dsError_t
+ */
+dsError_t dsSetFPIndicatorScene(const dsFPDIndicatorScene_t *indicators, bool toPersist);
+
+/**
+ * @brief Gets the status of every HDMI input port in one call
+ *
+ * The status is served from what dsMgr keeps up to date from the HAL
+ * callbacks, so no HAL call is made. Entries past numPorts are unused.
+ *
+ * @param[out] pStatus  - Active port, AV latency and the status of each port
+ *
+ * @return Device Settings error code
+ * @retval    ::dsError_t
+ */
+dsError_t dsHdmiInGetAllPortsStatus(dsHdmiInAllPortsStatus_t *pStatus);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,127 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2025 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+
+/**
+* @defgroup devicesettings
+* @{
+* @defgroup rpc
+* @{
+**/
+
+
+/**
+ * @file dsLogModule.h
+ * @brief Per-module runtime log levels shared by the dsMgr server logger and
+ * the RPC client logger.
+ *
+ * Each source file picks its module by defining DS_LOG_MODULE before including
+ * dsserverlogger.h or dsclientlogger.h; files that do not are logged under
+ * dsLOG_MODULE_GENERAL. Checking whether a message is enabled is a single
+ * relaxed atomic load, done before any formatting.
+ *
+ * Levels can be changed at runtime with dsLogModuleSetLevel(), through the
+ * IARM_BUS_DSMGR_API_dsSetLogLevel call (dsMgr only), or by editing
+ * DS_LOG_LEVEL_CONFIG_FILE, which is watched with inotify once
+ * dsLogModuleWatchConfig() has been called. dsMgr always watches it, client
+ * processes only read it once unless DS_LOG_LEVEL_WATCH=1 is set. The file
+ * holds one "<module>=<level>" entry per line, e.g. "audio=debug" or "all=warn".
+ *
+ * The level table and the functions below are defined once, in libdshalcli
+ * (rpc/cli/dsLogModule.c), which libdshalsrv links against.
+ */
+
+#ifndef _DS_LOG_MODULE_H_
+#define _DS_LOG_MODULE_H_
+
+#define DS_LOG_LEVEL_CONFIG_FILE "/opt/ds_log_levels.conf"
+
+typedef enum _dsLogModule_t {
+    dsLOG_MODULE_GENERAL = 0,
+    dsLOG_MODULE_AUDIO,
+    dsLOG_MODULE_VIDEOPORT,
+    dsLOG_MODULE_DISPLAY,
+    dsLOG_MODULE_HDMIIN,
+    dsLOG_MODULE_FPD,
+    dsLOG_MODULE_PERSISTENCE,
+    dsLOG_MODULE_MAX
+} dsLogModule_t;
+
+/** Module levels, a message is logged when its level is <= the module level. */
+typedef enum _dsLogModuleLevel_t {
+    dsLOG_LEVEL_OFF = 0,
+    dsLOG_LEVEL_ERROR,
+    dsLOG_LEVEL_WARN,
+    dsLOG_LEVEL_INFO,
+    dsLOG_LEVEL_DEBUG,
+    dsLOG_LEVEL_TRACE,
+    dsLOG_LEVEL_MAX
+} dsLogModuleLevel_t;
+
+/** Default level of every module, keeps the historical output unchanged. */
+#define dsLOG_LEVEL_DEFAULT dsLOG_LEVEL_DEBUG
+
+#ifndef DS_LOG_MODULE
+#define DS_LOG_MODULE dsLOG_MODULE_GENERAL
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern int dsLogModuleLevels[dsLOG_MODULE_MAX];
+
+#define DS_LOG_MODULE_ENABLED(MODULE, LEVEL) \
+    ((LEVEL) <= __atomic_load_n(&dsLogModuleLevels[(MODULE)], __ATOMIC_RELAXED))
+
+/**
+ * @brief Set the level of one module, or of all modules when module is -1.
+ * @return 0 on success, -1 on an invalid module or level.
+ */
+int dsLogModuleSetLevel(int module, int level);
+
+int dsLogModuleGetLevel(int module);
+
+/** @brief Lower case name of a module ("audio", "videoport", ...). */
+const char *dsLogModuleName(int module);
+
+/**
+ * @brief Apply the "<module>=<level>" entries of a config file.
+ * @return Number of entries applied, -1 if the file could not be read.
+ */
+int dsLogModuleLoadConfig(const char *path);
+
+/**
+ * @brief Load path now and reload it whenever it is rewritten.
+ * A background thread watches the parent directory with inotify. Subsequent
+ * calls are no-ops.
+ * @return 0 if the watcher is running, -1 otherwise.
+ */
+int dsLogModuleWatchConfig(const char *path);
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* _DS_LOG_MODULE_H_ */
+
+
+/** @} */
+/** @} */
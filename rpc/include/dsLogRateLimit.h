@@ -0,0 +1,148 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2025 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+
+/**
+* @defgroup devicesettings
+* @{
+* @defgroup rpc
+* @{
+**/
+
+
+/**
+ * @file dsLogRateLimit.h
+ * @brief Per call site token bucket used by the *_RL logging macros.
+ *
+ * Every rate limited log statement owns a static bucket holding up to
+ * DS_LOG_RATELIMIT_BURST tokens, refilled at DS_LOG_RATELIMIT_PER_SEC tokens
+ * per second. A message is logged only when a token is available; otherwise
+ * it is counted, and the count is reported as "N similar messages suppressed"
+ * just before the next message that gets through.
+ *
+ * The bucket state is packed in one 64-bit word and updated with a CAS, so
+ * call sites need no lock.
+ */
+
+#ifndef _DS_LOG_RATE_LIMIT_H_
+#define _DS_LOG_RATE_LIMIT_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+
+#ifndef DS_LOG_RATELIMIT_BURST
+#define DS_LOG_RATELIMIT_BURST      5
+#endif
+
+#ifndef DS_LOG_RATELIMIT_PER_SEC
+#define DS_LOG_RATELIMIT_PER_SEC    1
+#endif
+
+typedef struct _dsLogRateLimit_t {
+    uint64_t state;         /* last refill time in ms << 24 | milli-tokens, 0 until first use */
+    uint32_t suppressed;    /* messages dropped since the last one logged */
+} dsLogRateLimit_t;
+
+#define DS_LOG_RATELIMIT_INITIALIZER { 0, 0 }
+
+#define DS_LOG_RATELIMIT_TOKEN_BITS 24
+#define DS_LOG_RATELIMIT_TOKEN_MASK ((1ULL << DS_LOG_RATELIMIT_TOKEN_BITS) - 1)
+#define DS_LOG_RATELIMIT_TIME_MASK  ((1ULL << (64 - DS_LOG_RATELIMIT_TOKEN_BITS)) - 1)
+
+/**
+ * @brief Take a token from the bucket.
+ *
+ * @param[in]  limit       Call site bucket
+ * @param[in]  burst       Bucket capacity, at most 16000
+ * @param[in]  perSec      Refill rate in tokens per second
+ * @param[out] suppressed  When a token is taken, number of messages suppressed since the previous one
+ *
+ * @return true if the message may be logged
+ */
+static inline bool dsLogRateLimitAllow(dsLogRateLimit_t *limit, unsigned int burst, unsigned int perSec, unsigned int *suppressed)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC_COARSE, &ts);
+
+    const uint64_t capacity = (uint64_t)burst * 1000;
+    const uint64_t now = ((uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000) & DS_LOG_RATELIMIT_TIME_MASK;
+    uint64_t old = __atomic_load_n(&limit->state, __ATOMIC_RELAXED);
+    bool allowed;
+
+    for (;;) {
+        uint64_t last = old >> DS_LOG_RATELIMIT_TOKEN_BITS;
+        uint64_t tokens = old & DS_LOG_RATELIMIT_TOKEN_MASK;
+
+        if (0 == old) {
+            last = now;
+            tokens = capacity;
+        }
+
+        tokens += ((now - last) & DS_LOG_RATELIMIT_TIME_MASK) * perSec;
+        if (tokens > capacity) {
+            tokens = capacity;
+        }
+
+        allowed = (tokens >= 1000);
+        if (allowed) {
+            tokens -= 1000;
+        }
+
+        uint64_t next = (now << DS_LOG_RATELIMIT_TOKEN_BITS) | tokens;
+        if (0 == next) {
+            next = 1;
+        }
+        if (__atomic_compare_exchange_n(&limit->state, &old, next, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+            break;
+        }
+    }
+
+    if (allowed) {
+        *suppressed = __atomic_exchange_n(&limit->suppressed, 0, __ATOMIC_RELAXED);
+    } else {
+        __atomic_fetch_add(&limit->suppressed, 1, __ATOMIC_RELAXED);
+    }
+    return allowed;
+}
+
+/*
+ * Generic rate limited log statement, wrapped by the INT_*_RL macros of each
+ * logger. ENABLED is the logger's level check, evaluated first so that
+ * disabled messages do not consume tokens. EOL terminates the suppression
+ * summary the way the logger expects.
+ */
+#define DS_LOG_RATELIMITED(ENABLED, LOGMACRO, EOL, FORMAT, ...)                                   \
+    do {                                                                                          \
+        static dsLogRateLimit_t _dsRateLimit = DS_LOG_RATELIMIT_INITIALIZER;                      \
+        unsigned int _dsSuppressed = 0;                                                           \
+        if ((ENABLED) && dsLogRateLimitAllow(&_dsRateLimit, DS_LOG_RATELIMIT_BURST,               \
+                                             DS_LOG_RATELIMIT_PER_SEC, &_dsSuppressed)) {         \
+            if (_dsSuppressed) {                                                                  \
+                LOGMACRO("%u similar messages suppressed" EOL, _dsSuppressed);                    \
+            }                                                                                     \
+            LOGMACRO(FORMAT, ##__VA_ARGS__);                                                      \
+        }                                                                                         \
+    } while (0)
+
+#endif /* _DS_LOG_RATE_LIMIT_H_ */
+
+
+/** @} */
+/** @} */
@@ -30,6 +30,7 @@
 #ifndef RPDSMGR_H_
 #define RPDSMGR_H_
 #include "libIARM.h"
+#include "libIBus.h"
 #include "dsTypes.h"
 #include "dsRpc.h"
 
@@ -41,6 +42,8 @@ extern "C" {
 
 IARM_Result_t dsMgr_init();
 IARM_Result_t dsMgr_term();
+IARM_Result_t dsMgr_BroadcastEvent(IARM_EventId_t eventId, void *data, size_t len);
+IARM_Result_t dsMgr_RegisterCall(const char *methodName, IARM_BusCall_t handler);
 
 
 /*! Events published from DS Mananger */
@@ -78,6 +81,7 @@ typedef enum _DSMgr_EventId_t {
 	IARM_BUS_DSMGR_EVENT_HDMI_IN_AVI_CONTENT_TYPE,        /*<HDMI IN content type event */
 	IARM_BUS_DSMGR_EVENT_HDMI_IN_AV_LATENCY,          /*!< HDMI IN AVLatency event */
         IARM_BUS_DSMGR_EVENT_ATMOS_CAPS_CHANGED, /*!<Atmos capability changed event*/
+        IARM_BUS_DSMGR_EVENT_EDID_READY,         /*!< Valid EDID available after an HDMI hotplug */
         IARM_BUS_DSMGR_EVENT_MAX,					       /*!< Max Event  */
 } IARM_Bus_DSMgr_EventId_t;
 
@@ -260,6 +264,11 @@ typedef struct _DSMgr_EventData_t {
             char framerate[20];
         }DisplayFrameRateChange;
 
+        struct _EDID_READY_DATA {
+            unsigned int generation;    /*!< Hotplug generation the EDID belongs to */
+            int length;                 /*!< EDID length in bytes */
+        }edid_ready; /*EDID ready*/
+
     } data;
 }IARM_Bus_DSMgr_EventData_t;
 
@@ -0,0 +1,103 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2025 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+
+/**
+* @defgroup devicesettings
+* @{
+* @defgroup rpc
+* @{
+**/
+
+
+/**
+ * @file dsPerfStats.h
+ * @brief Per RPC method performance counters of dsMgr.
+ *
+ * Every handler registered with dsMgr_RegisterCall() runs through a
+ * trampoline that counts calls, IARM level errors, total and maximum
+ * latency. The IARM_BUS_Lock/IARM_BUS_Unlock macros of the server modules
+ * use dsPerfMutexLock()/dsPerfMutexUnlock(), which charge the time spent
+ * waiting for the module lock, and the time it was held, to the call in
+ * progress on the thread. Handlers make their HAL calls with the lock held,
+ * so the held time is the HAL time of the method.
+ *
+ * Counters are updated with relaxed atomics and read with
+ * IARM_BUS_DSMGR_API_dsGetPerfStats (see sample/dumpPerfStats.cpp).
+ */
+
+#ifndef _DS_PERF_STATS_H_
+#define _DS_PERF_STATS_H_
+
+#include <stdint.h>
+#include <time.h>
+#include <pthread.h>
+
+#define DS_PERF_MAX_METHODS     256
+
+/* Accounting of the RPC call running on this thread, slot -1 outside calls */
+typedef struct _dsPerfCall_t {
+    int slot;
+    int lockDepth;              /* module locks held, a handler may call into another module */
+    uint64_t lockWaitUs;
+    uint64_t lockHeldUs;
+    uint64_t lockedAtUs;        /* when the outermost lock was taken */
+} dsPerfCall_t;
+
+extern __thread dsPerfCall_t dsPerfCurrentCall;
+
+static inline uint64_t dsPerfNowUs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+}
+
+static inline void dsPerfMutexLock(pthread_mutex_t *mutex)
+{
+    if (dsPerfCurrentCall.slot < 0) {
+        pthread_mutex_lock(mutex);
+        return;
+    }
+    uint64_t start = dsPerfNowUs();
+    pthread_mutex_lock(mutex);
+    uint64_t now = dsPerfNowUs();
+    dsPerfCurrentCall.lockWaitUs += now - start;
+    if (0 == dsPerfCurrentCall.lockDepth++) {
+        dsPerfCurrentCall.lockedAtUs = now;
+    }
+}
+
+static inline void dsPerfMutexUnlock(pthread_mutex_t *mutex)
+{
+    if ((dsPerfCurrentCall.slot >= 0) && (dsPerfCurrentCall.lockDepth > 0) &&
+        (0 == --dsPerfCurrentCall.lockDepth)) {
+        dsPerfCurrentCall.lockHeldUs += dsPerfNowUs() - dsPerfCurrentCall.lockedAtUs;
+    }
+    pthread_mutex_unlock(mutex);
+}
+
+/** @brief Register the dsGetPerfStats call, done by dsMgr_init(). */
+void dsPerfStatsInit(void);
+
+#endif /* _DS_PERF_STATS_H_ */
+
+
+/** @} */
+/** @} */
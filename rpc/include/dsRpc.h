@@ -31,6 +31,7 @@
 #define _IARM_RPDS_H_
 
 
+#include <stddef.h>
 #include "dsTypes.h"
 #include "dsError.h"
 
@@ -38,6 +39,36 @@
 extern "C" {
 #endif
 
+/*
+ * Variable length payloads
+ *
+ * Params returning a byte payload (EDID, SPD, SoC ID) end with the payload
+ * array, sized for the largest payload and preceded by "length" and
+ * "capacity". The caller sets capacity to the bytes it wants back and passes
+ * DS_RPC_VAR_PARAM_SIZE() as the IARM argument length, so only the header and
+ * capacity payload bytes are copied across the bus, each way. The server
+ * copies the payload only when it fits in DS_RPC_VAR_PARAM_CAPACITY() and
+ * always sets length to the full payload size; a caller seeing
+ * length > capacity calls again with capacity = length.
+ *
+ * This changed the wire layout of dsDisplayGetEDIDBytesParam_t,
+ * dsGetSocIDFromSDKParam_t, dsGetEDIDBytesInfoParam_t and
+ * dsGetHDMISPDInfoParam_t: capacity was added, and in dsGetEDIDBytesInfoParam_t
+ * the edid array moved after length. dsDisplayGetEDIDParam_t, which is not
+ * variable length, gained a leading result. A libdshalcli and a dsMgr built
+ * from different sides of these changes misread these params, so both must
+ * be upgraded together.
+ */
+#define DS_RPC_VAR_PARAM_SIZE(TYPE, MEMBER, CAPACITY) (offsetof(TYPE, MEMBER) + (size_t)(CAPACITY))
+
+#define DS_RPC_VAR_PARAM_CAPACITY(PARAM, MEMBER)                                     \
+    ((((PARAM)->capacity > 0) && ((size_t)(PARAM)->capacity < sizeof((PARAM)->MEMBER))) \
+        ? (PARAM)->capacity : (int)sizeof((PARAM)->MEMBER))
+
+/* First guesses, large enough for the common case so that one call suffices */
+#define DS_RPC_EDID_CAPACITY        256     /* base block and one CTA extension */
+#define DS_RPC_SOCID_CAPACITY       128
+
 
 
 /*
@@ -74,7 +105,9 @@ extern "C" {
 #define  IARM_BUS_DSMGR_API_dsGetSinkDeviceAtmosCapability "dsGetSinkDeviceAtmosCapability"
 #define  IARM_BUS_DSMGR_API_dsSetAudioAtmosOutputMode "dsSetAudioAtmosOutputMode"
 #define  IARM_BUS_DSMGR_API_dsSetAudioDucking    "dsSetAudioDucking"
+#define  IARM_BUS_DSMGR_API_dsSetAudioDuckingSource    "dsSetAudioDuckingSource"
 #define  IARM_BUS_DSMGR_API_dsSetAudioLevel            "dsSetAudioLevel"
+#define  IARM_BUS_DSMGR_API_dsAudioRampLevel           "dsAudioRampLevel"
 #define  IARM_BUS_DSMGR_API_dsGetAudioLevel            "dsGetAudioLevel"
 #define  IARM_BUS_DSMGR_API_dsSetAudioGain            "dsSetAudioGain"
 #define  IARM_BUS_DSMGR_API_dsGetAudioGain            "dsGetAudioGain"
@@ -132,6 +165,7 @@ extern "C" {
 #define IARM_BUS_DSMGR_API_dsGetDisplayAspectRatio		"dsGetDisplayAspectRatio"
 #define IARM_BUS_DSMGR_API_dsGetEDID					"dsGetEDID"
 #define IARM_BUS_DSMGR_API_dsGetEDIDBytes               "dsGetEDIDBytes"
+#define IARM_BUS_DSMGR_API_dsGetEDIDState               "dsGetEDIDState"
 #define IARM_BUS_DSMGR_API_dsSetAllmEnabled "dsSetAllmEnabled"
 #define IARM_BUS_DSMGR_API_dsSetAVIContentType "dsSetAVIContentType"
 #define IARM_BUS_DSMGR_API_dsSetAVIScanInformation "dsSetAVIScanInformation"
@@ -217,6 +251,10 @@ extern "C" {
 #define IARM_BUS_DSMGR_API_dsGetTimeFormat         "dsGetTimeFormat"
 #define IARM_BUS_DSMGR_API_dsSetTimeFormat          "dsSetTimeFormat"
 #define IARM_BUS_DSMGR_API_dsSetFPDMode          "dsSetFPDMode"
+#define IARM_BUS_DSMGR_API_dsFPStartAnimation     "dsFPStartAnimation"
+#define IARM_BUS_DSMGR_API_dsFPCancelAnimation    "dsFPCancelAnimation"
+#define IARM_BUS_DSMGR_API_dsFPSetAutoClock       "dsFPSetAutoClock"
+#define IARM_BUS_DSMGR_API_dsSetFPIndicatorScene  "dsSetFPIndicatorScene"
 
 
 /*
@@ -245,6 +283,7 @@ extern "C" {
 #define IARM_BUS_DSMGR_API_dsGetSupportedGameFeaturesList              "dsGetSupportedGameFeaturesList"
 #define IARM_BUS_DSMGR_API_dsGetAVLatency   		"dsGetAVLatency"
 #define IARM_BUS_DSMGR_API_dsGetHdmiVersion            "dsGetHdmiVersion"
+#define IARM_BUS_DSMGR_API_dsHdmiInGetAllPortsStatus   "dsHdmiInGetAllPortsStatus"
 
 /*
  * Declare RPC COMPOSITE INPUT API names
@@ -269,6 +308,9 @@ extern "C" {
 #define IARM_BUS_DSMGR_API_dsGetSocIDFromSDK               "dsGetSocIDFromSDK"
 #define IARM_BUS_DSMGR_API_dsGetHostEDID               "dsGetHostEDID"
 #define IARM_BUS_DSMGR_API_dsGetMS12ConfigType         "dsGetMS12ConfigType"
+#define IARM_BUS_DSMGR_API_dsDumpEventTrace            "dsDumpEventTrace"
+#define IARM_BUS_DSMGR_API_dsSetLogLevel               "dsSetLogLevel"
+#define IARM_BUS_DSMGR_API_dsGetPerfStats              "dsGetPerfStats"
 
 /*
  * Declare Reset MS12 setting  Interface  API names
@@ -366,6 +408,37 @@ typedef struct _dsAudioSetDuckingParam_t {
         unsigned char level;
 } dsAudioSetDuckingParam_t;
 
+/** Source of dsSetAudioDucking requests, which carry no source of their own; rejected by dsSetAudioDuckingSource */
+#define DS_AUDIO_DUCKING_SOURCE_DEFAULT 0
+
+typedef struct _dsAudioSetDuckingSourceParam_t {
+        dsError_t result;
+        intptr_t handle;
+        unsigned int source;
+        int priority;
+        dsAudioDuckingAction_t action;
+        dsAudioDuckingType_t type;
+        unsigned char level;
+} dsAudioSetDuckingSourceParam_t;
+
+/** Shape of a volume ramp from the current level to the target */
+typedef enum _dsAudioRampCurve_t {
+        dsAUDIO_RAMP_CURVE_LINEAR = 0,      /*!< Equal level steps */
+        dsAUDIO_RAMP_CURVE_EASE_IN_OUT,     /*!< Slow start and end (smoothstep) */
+        dsAUDIO_RAMP_CURVE_EXPONENTIAL,     /*!< Equal steps in dB, down to -40 dB */
+        dsAUDIO_RAMP_CURVE_MAX
+} dsAudioRampCurve_t;
+
+#define DS_AUDIO_RAMP_DURATION_MAX_MS   30000
+
+typedef struct _dsAudioRampLevelParam_t {
+        dsError_t result;
+        intptr_t handle;
+        float target;
+        unsigned int durationMs;
+        dsAudioRampCurve_t curve;
+} dsAudioRampLevelParam_t;
+
 typedef struct _dsAudioGainParam_t {
         intptr_t handle;
         float gain;
@@ -611,6 +684,7 @@ typedef struct _dsDisplayGetAspectRatioParam_t {
 } dsDisplayGetAspectRatioParam_t;
 
 typedef struct _dsDisplayGetEDIDParam_t {
+    dsError_t result;   /*!< Added in front, not wire compatible with an older libdshalcli or dsMgr */
 	intptr_t handle;
     dsDisplayEDID_t edid;
 } dsDisplayGetEDIDParam_t;
@@ -646,9 +720,17 @@ typedef struct _dsDisplayGetEDIDBytesParam_t {
     int result;
 	intptr_t handle;
     int length;
+    int capacity;               /*!< Variable length payload, see DS_RPC_VAR_PARAM_SIZE */
     unsigned char bytes[1024];
 } dsDisplayGetEDIDBytesParam_t;
 
+typedef struct _dsDisplayGetEDIDStateParam_t {
+    dsError_t result;
+    intptr_t handle;
+    bool valid;                 /*!< A verified EDID has been read since the last hotplug */
+    unsigned int generation;    /*!< Bumped on every HDMI hotplug */
+} dsDisplayGetEDIDStateParam_t;
+
 typedef struct _dsMS12ConfigTypeParam_t {
    dsError_t result;
    char configType[MS12_CONFIG_BUF_SIZE]; 
@@ -713,6 +795,76 @@ typedef struct _dsFPDModeParam
     dsFPDMode_t eMode;
 }dsFPDModeParam_t;
 
+#define DS_FPD_ANIM_FRAMES_MAX  16
+#define DS_FPD_ANIM_TEXT_MAX    32
+
+typedef enum _dsFPDAnimType_t
+{
+    dsFPD_ANIM_FRAMES = 0,      /*!< Show frames[0..nFrames-1] in turn */
+    dsFPD_ANIM_SCROLL,          /*!< Slide a width character window over frames[0] */
+    dsFPD_ANIM_BLINK,           /*!< Show frames[0] or blank, following blinkPattern */
+    dsFPD_ANIM_COUNTDOWN,       /*!< Count countdownSec down to 0, as "SS" or "MM:SS" */
+    dsFPD_ANIM_MAX
+}dsFPDAnimType_t;
+
+/* A text display animation run by dsMgr, see dsFPStartAnimation() */
+typedef struct _dsFPDAnimation_t
+{
+    dsFPDAnimType_t type;
+    unsigned int stepMs;            /*!< Time per frame, scroll step or blink step; 1000 for a countdown */
+    unsigned int iterations;        /*!< Passes over the frames, text or pattern, 0 to loop until cancelled */
+    unsigned int width;             /*!< Scroll: characters shown at once */
+    unsigned int blinkPattern;      /*!< Blink: bit i set shows the text on step i */
+    unsigned int blinkSteps;        /*!< Blink: steps in the pattern, at most 32 */
+    unsigned int countdownSec;      /*!< Countdown: start value */
+    unsigned int nFrames;
+    char frames[DS_FPD_ANIM_FRAMES_MAX][DS_FPD_ANIM_TEXT_MAX];
+}dsFPDAnimation_t;
+
+typedef struct _dsFPDAnimParam_t
+{
+    dsError_t result;
+    dsFPDAnimation_t animation;
+    unsigned int handle;            /*!< Out: pass to dsFPCancelAnimation() */
+}dsFPDAnimParam_t;
+
+typedef struct _dsFPDAnimCancelParam_t
+{
+    dsError_t result;
+    unsigned int handle;            /*!< 0 cancels every animation */
+}dsFPDAnimCancelParam_t;
+
+typedef struct _dsFPDAutoClockParam_t
+{
+    dsError_t result;
+    bool enable;                    /*!< dsMgr updates the clock display every minute */
+}dsFPDAutoClockParam_t;
+
+/* Fields of dsFPDIndicatorScene_t to apply */
+#define DS_FPD_SCENE_STATE          0x01
+#define DS_FPD_SCENE_COLOR          0x02
+#define DS_FPD_SCENE_BRIGHTNESS     0x04
+#define DS_FPD_SCENE_BLINK          0x08
+
+/* Desired settings of one indicator; an indicator with mask 0 is left alone */
+typedef struct _dsFPDIndicatorScene_t
+{
+    unsigned int mask;              /*!< DS_FPD_SCENE_* */
+    dsFPDState_t state;
+    dsFPDColor_t color;
+    dsFPDBrightness_t brightness;   /*!< Used while on; with no state in mask, set as is */
+    unsigned int blinkDuration;     /*!< Blink is always started, it has no steady state to compare */
+    unsigned int blinkIterations;
+}dsFPDIndicatorScene_t;
+
+typedef struct _dsFPDSceneParam_t
+{
+    dsError_t result;
+    bool toPersist;                 /*!< Persist the power indicator brightness and color */
+    dsFPDIndicatorScene_t indicators[dsFPD_INDICATOR_MAX];
+    unsigned int halCalls;          /*!< Out: HAL calls needed to apply the differences */
+}dsFPDSceneParam_t;
+
 typedef struct _dsEnableHDCPParam 
 {
     intptr_t handle;
@@ -927,6 +1079,8 @@ typedef struct _dsGetLEConfigParam_t {
 
 typedef struct _dsGetSocIDFromSDKParam_t {
     dsError_t result;
+    int length;                 /*!< Including the terminating NUL */
+    int capacity;               /*!< Variable length payload, see DS_RPC_VAR_PARAM_SIZE */
     char socID[DS_DEVICEID_LEN_MAX];
 } dsGetSocIDFromSDKParam_t;
 
@@ -991,14 +1145,17 @@ typedef struct _dsGetEDIDBytesInfoParam_t
 {
     dsError_t               result;
     dsHdmiInPort_t          iHdmiPort;
-    unsigned char           edid [MAX_EDID_BYTES_LEN];
     int                     length;
+    int                     capacity;   /*!< Variable length payload, see DS_RPC_VAR_PARAM_SIZE */
+    unsigned char           edid [MAX_EDID_BYTES_LEN];  /*!< Was before length, the layout is not wire compatible with older dsMgr */
 }dsGetEDIDBytesInfoParam_t;
 
 typedef struct _dsGetHDMISPDInfoParam_t
 {
     dsError_t               result;
     dsHdmiInPort_t          iHdmiPort;
+    int                     length;
+    int                     capacity;   /*!< Variable length payload, see DS_RPC_VAR_PARAM_SIZE */
     unsigned char           spdInfo [1024];
 }dsGetHDMISPDInfoParam_t;
 
@@ -1082,6 +1239,79 @@ typedef struct _dsHdmiVersionParam_t
     dsHdmiMaxCapabilityVersion_t iCapVersion;
 }dsHdmiVersionParam_t;
 
+/** Status of one HDMI input port as kept by dsMgr from the HAL callbacks */
+typedef struct _dsHdmiInPortStatus_t
+{
+    bool                            isConnected;
+    bool                            isArcCapable;
+    dsHdmiInSignalStatus_t          signalStatus;
+    dsVideoPortResolution_t         resolution;         /*!< Last video mode reported for the port */
+    bool                            allmMode;
+    dsVRRType_t                     vrrType;
+    dsAviContentType_t              aviContentType;
+    tv_hdmi_edid_version_t          edidVersion;
+    bool                            edidAllmSupport;
+    bool                            vrrSupport;
+    dsHdmiMaxCapabilityVersion_t    hdmiVersion;
+}dsHdmiInPortStatus_t;
+
+typedef struct _dsHdmiInAllPortsStatus_t
+{
+    uint8_t                 numPorts;                   /*!< Valid entries of ports */
+    dsHdmiInPort_t          activePort;
+    bool                    isPresented;
+    int32_t                 audioLatency;
+    int32_t                 videoLatency;
+    dsHdmiInPortStatus_t    ports[dsHDMI_IN_PORT_MAX];
+}dsHdmiInAllPortsStatus_t;
+
+typedef struct _dsHdmiInAllPortsStatusParam_t
+{
+    dsError_t                   result;
+    dsHdmiInAllPortsStatus_t    status;
+}dsHdmiInAllPortsStatusParam_t;
+
+#define DS_EVENT_TRACE_PATH_MAX 128
+
+typedef struct _dsEventTraceDumpParam_t
+{
+    dsError_t   result;
+    int         records;                        /*!< Number of records written by dsMgr */
+    char        path[DS_EVENT_TRACE_PATH_MAX];  /*!< Out: file dsMgr created for the dump */
+}dsEventTraceDumpParam_t;
+
+typedef struct _dsLogLevelParam_t
+{
+    dsError_t   result;
+    int         module;     /*!< dsLogModule_t, -1 for all modules */
+    int         level;      /*!< dsLogModuleLevel_t */
+}dsLogLevelParam_t;
+
+#define DS_PERF_METHOD_NAME_MAX 48
+#define DS_PERF_STATS_PAGE      16
+
+/* Counters of one RPC method since dsMgr start or the last reset, times in microseconds */
+typedef struct _dsPerfStat_t
+{
+    char        method[DS_PERF_METHOD_NAME_MAX];
+    uint64_t    calls;
+    uint64_t    errors;         /*!< Handler returned other than IARM_RESULT_SUCCESS */
+    uint64_t    totalUs;
+    uint64_t    maxUs;
+    uint64_t    lockWaitUs;     /*!< Waiting for the module lock */
+    uint64_t    lockHeldUs;     /*!< Holding the module lock, i.e. in the HAL */
+}dsPerfStat_t;
+
+typedef struct _dsPerfStatsParam_t
+{
+    dsError_t       result;
+    int             first;      /*!< In: index of the first method to return */
+    bool            reset;      /*!< In: clear the returned methods after reading them */
+    int             total;      /*!< Out: number of registered methods */
+    int             count;      /*!< Out: entries filled in stats */
+    dsPerfStat_t    stats[DS_PERF_STATS_PAGE];
+}dsPerfStatsParam_t;
+
 #ifdef __cplusplus
 }
 #endif
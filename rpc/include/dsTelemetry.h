@@ -28,6 +28,7 @@
 **/
 
 #include <telemetry_busmessage_sender.h>
+#include "dsTelemetryAgg.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -58,6 +59,22 @@ extern "C" {
         t2_event_d((char*)marker, (int)value); \
     } while(0)
 
+/* Aggregated markers, sent once per flush interval (see dsTelemetryAgg.h) */
+#define TELEMETRY_COUNT(marker) \
+    do { \
+        dsTelemetryAggCount(marker, 1); \
+    } while(0)
+
+#define TELEMETRY_GAUGE(marker, value) \
+    do { \
+        dsTelemetryAggGauge(marker, (double)value); \
+    } while(0)
+
+#define TELEMETRY_LATENCY_MS(marker, ms) \
+    do { \
+        dsTelemetryAggLatencyMs(marker, (unsigned int)(ms)); \
+    } while(0)
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,103 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2025 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+
+/**
+* @defgroup devicesettings
+* @{
+* @defgroup dsTelemetry
+* @{
+**/
+
+
+/**
+ * @file dsTelemetryAgg.h
+ * @brief In-process aggregation of dsMgr telemetry markers.
+ *
+ * Counters, gauges and latency histograms are accumulated per marker and
+ * sent as one telemetry event per marker every flush interval, instead of
+ * one event per occurrence:
+ *
+ *   counter   t2_event_d(marker, occurrences since the last flush)
+ *   gauge     t2_event_f(marker, last value set)
+ *   histogram t2_event_s(marker, "count,min,max,avg,b0,...,b9"), times in ms,
+ *             bucket upper bounds 10,25,50,100,250,500,1000,2500,5000,inf
+ *
+ * Markers that were not touched since the last flush are not sent. Use the
+ * TELEMETRY_COUNT/GAUGE/LATENCY_MS macros of dsTelemetry.h rather than these
+ * functions directly. Before dsTelemetryAggStart() and after
+ * dsTelemetryAggStop(), and when the marker table is full, values are sent
+ * right away as before.
+ */
+
+#ifndef _DS_TELEMETRY_AGG_H_
+#define _DS_TELEMETRY_AGG_H_
+
+#include <stdint.h>
+#include <time.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef DS_TELEMETRY_FLUSH_INTERVAL_SEC
+#define DS_TELEMETRY_FLUSH_INTERVAL_SEC     300
+#endif
+
+#define DS_TELEMETRY_AGG_MAX_MARKERS        32
+#define DS_TELEMETRY_MARKER_LEN_MAX         64
+#define DS_TELEMETRY_HIST_BUCKETS           10
+
+void dsTelemetryAggCount(const char *marker, int delta);
+void dsTelemetryAggGauge(const char *marker, double value);
+void dsTelemetryAggLatencyMs(const char *marker, unsigned int ms);
+
+/**
+ * @brief Start aggregating and flushing every intervalSec seconds.
+ *
+ * An intervalSec of 0 uses DS_TELEMETRY_FLUSH_SEC from the environment when
+ * set, DS_TELEMETRY_FLUSH_INTERVAL_SEC otherwise.
+ *
+ * @return 0 on success, -1 if the flush thread could not be started.
+ */
+int dsTelemetryAggStart(unsigned int intervalSec);
+
+/** @brief Send everything aggregated so far. */
+void dsTelemetryAggFlush(void);
+
+/** @brief Flush and stop the flush thread; later values are sent right away. */
+void dsTelemetryAggStop(void);
+
+/** @brief Monotonic time in ms, for measuring the latencies passed to dsTelemetryAggLatencyMs(). */
+static inline uint64_t dsTelemetryNowMs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000 + (uint64_t)ts.tv_nsec / 1000000;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _DS_TELEMETRY_AGG_H_ */
+
+
+/** @} */
+/** @} */
@@ -29,6 +29,8 @@
 #ifndef _DS_CLIENT_LOGGER_H_
 #define _DS_CLIENT_LOGGER_H_
 #include "dsclientregisterlog.h"
+#include "dsLogModule.h"
+#include "dsLogRateLimit.h"
 #include <stdio.h>
 
 int ds_client_log(int priority,const char *format, ...);
@@ -40,10 +42,15 @@ int ds_client_log(int priority,const char *format, ...);
 
 
 
-#define INT_INFO(FORMAT, ...)           ds_client_log(INFO_LEVEL ,FORMAT,  ##__VA_ARGS__ )
-#define INT_WARN(FORMAT, ...)           ds_client_log(WARN_LEVEL ,FORMAT,  ##__VA_ARGS__ )
-#define INT_ERROR(FORMAT, ...)      ds_client_log(ERROR_LEVEL ,FORMAT, ##__VA_ARGS__ )
-#define INT_DEBUG(FORMAT, ...)      ds_client_log(DEBUG_LEVEL ,FORMAT,  ##__VA_ARGS__ )
+#define INT_INFO(FORMAT, ...)           (DS_LOG_MODULE_ENABLED(DS_LOG_MODULE, dsLOG_LEVEL_INFO) ? ds_client_log(INFO_LEVEL ,FORMAT,  ##__VA_ARGS__ ) : 0)
+#define INT_WARN(FORMAT, ...)           (DS_LOG_MODULE_ENABLED(DS_LOG_MODULE, dsLOG_LEVEL_WARN) ? ds_client_log(WARN_LEVEL ,FORMAT,  ##__VA_ARGS__ ) : 0)
+#define INT_ERROR(FORMAT, ...)      (DS_LOG_MODULE_ENABLED(DS_LOG_MODULE, dsLOG_LEVEL_ERROR) ? ds_client_log(ERROR_LEVEL ,FORMAT, ##__VA_ARGS__ ) : 0)
+#define INT_DEBUG(FORMAT, ...)      (DS_LOG_MODULE_ENABLED(DS_LOG_MODULE, dsLOG_LEVEL_DEBUG) ? ds_client_log(DEBUG_LEVEL ,FORMAT,  ##__VA_ARGS__ ) : 0)
+
+// Rate limited variants for hot paths, see dsLogRateLimit.h
+#define INT_INFO_RL(FORMAT, ...)        DS_LOG_RATELIMITED(DS_LOG_MODULE_ENABLED(DS_LOG_MODULE, dsLOG_LEVEL_INFO), INT_INFO, "\r\n", FORMAT, ##__VA_ARGS__)
+#define INT_WARN_RL(FORMAT, ...)        DS_LOG_RATELIMITED(DS_LOG_MODULE_ENABLED(DS_LOG_MODULE, dsLOG_LEVEL_WARN), INT_WARN, "\r\n", FORMAT, ##__VA_ARGS__)
+#define INT_ERROR_RL(FORMAT, ...)       DS_LOG_RATELIMITED(DS_LOG_MODULE_ENABLED(DS_LOG_MODULE, dsLOG_LEVEL_ERROR), INT_ERROR, "\r\n", FORMAT, ##__VA_ARGS__)
 
 
 #endif
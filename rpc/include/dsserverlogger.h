@@ -32,6 +32,8 @@
 #include <stdio.h>
 #include <string.h>
 #include "dsserverregisterlog.h"
+#include "dsLogModule.h"
+#include "dsLogRateLimit.h"
 
 int ds_server_log(int priority,const char *format, ...);
 // Helper to extract filename from full path
@@ -47,11 +49,11 @@ static inline const char* fileName(const char* path) {
 
 void dsServer_Rdklogger_Init();
 
-#define INT_ERROR(FORMAT, ...)       LOG_ERROR(PREFIX(FORMAT), fileName(__FILE__), __LINE__, __FUNCTION__, ##__VA_ARGS__)
-#define INT_WARNING(FORMAT,  ...)    LOG_WARNING(PREFIX(FORMAT), fileName(__FILE__), __LINE__, __FUNCTION__, ##__VA_ARGS__)
-#define INT_INFO(FORMAT,  ...)       LOG_INFO(PREFIX(FORMAT),  fileName(__FILE__), __LINE__, __FUNCTION__, ##__VA_ARGS__)
-#define INT_DEBUG(FORMAT, ...)       LOG_DEBUG(PREFIX(FORMAT), fileName(__FILE__), __LINE__, __FUNCTION__, ##__VA_ARGS__)
-#define INT_TRACE(FORMAT, ...)       LOG_TRACE(PREFIX(FORMAT), fileName(__FILE__), __LINE__, __FUNCTION__, ##__VA_ARGS__)
+#define INT_ERROR(FORMAT, ...)       do { if (DS_LOG_MODULE_ENABLED(DS_LOG_MODULE, dsLOG_LEVEL_ERROR)) { LOG_ERROR(PREFIX(FORMAT), fileName(__FILE__), __LINE__, __FUNCTION__, ##__VA_ARGS__) } } while (0)
+#define INT_WARNING(FORMAT,  ...)    do { if (DS_LOG_MODULE_ENABLED(DS_LOG_MODULE, dsLOG_LEVEL_WARN)) { LOG_WARNING(PREFIX(FORMAT), fileName(__FILE__), __LINE__, __FUNCTION__, ##__VA_ARGS__) } } while (0)
+#define INT_INFO(FORMAT,  ...)       do { if (DS_LOG_MODULE_ENABLED(DS_LOG_MODULE, dsLOG_LEVEL_INFO)) { LOG_INFO(PREFIX(FORMAT),  fileName(__FILE__), __LINE__, __FUNCTION__, ##__VA_ARGS__) } } while (0)
+#define INT_DEBUG(FORMAT, ...)       do { if (DS_LOG_MODULE_ENABLED(DS_LOG_MODULE, dsLOG_LEVEL_DEBUG)) { LOG_DEBUG(PREFIX(FORMAT), fileName(__FILE__), __LINE__, __FUNCTION__, ##__VA_ARGS__) } } while (0)
+#define INT_TRACE(FORMAT, ...)       do { if (DS_LOG_MODULE_ENABLED(DS_LOG_MODULE, dsLOG_LEVEL_TRACE)) { LOG_TRACE(PREFIX(FORMAT), fileName(__FILE__), __LINE__, __FUNCTION__, ##__VA_ARGS__) } } while (0)
 
 #define PREFIX(FORMAT)  "[%s:%d] %s: " FORMAT
 
@@ -92,13 +94,18 @@ printf(FORMAT, __VA_ARGS__);\
 
 #else
 
-#define INT_DEBUG(FORMAT, ...);        printf(FORMAT, ##__VA_ARGS__)
-#define INT_ERROR(FORMAT, ...);        printf(FORMAT, ##__VA_ARGS__)
-#define INT_INFO(FORMAT, ...);         printf(FORMAT, ##__VA_ARGS__)
-#define INT_WARNING(FORMAT, ...);      printf(FORMAT, ##__VA_ARGS__)
+#define INT_DEBUG(FORMAT, ...)         do { if (DS_LOG_MODULE_ENABLED(DS_LOG_MODULE, dsLOG_LEVEL_DEBUG)) printf(FORMAT, ##__VA_ARGS__); } while (0)
+#define INT_ERROR(FORMAT, ...)         do { if (DS_LOG_MODULE_ENABLED(DS_LOG_MODULE, dsLOG_LEVEL_ERROR)) printf(FORMAT, ##__VA_ARGS__); } while (0)
+#define INT_INFO(FORMAT, ...)          do { if (DS_LOG_MODULE_ENABLED(DS_LOG_MODULE, dsLOG_LEVEL_INFO)) printf(FORMAT, ##__VA_ARGS__); } while (0)
+#define INT_WARNING(FORMAT, ...)       do { if (DS_LOG_MODULE_ENABLED(DS_LOG_MODULE, dsLOG_LEVEL_WARN)) printf(FORMAT, ##__VA_ARGS__); } while (0)
 
 #endif
 
+// Rate limited variants for hot paths, see dsLogRateLimit.h
+#define INT_INFO_RL(FORMAT, ...)       DS_LOG_RATELIMITED(DS_LOG_MODULE_ENABLED(DS_LOG_MODULE, dsLOG_LEVEL_INFO), INT_INFO, "\r\n", FORMAT, ##__VA_ARGS__)
+#define INT_WARNING_RL(FORMAT, ...)    DS_LOG_RATELIMITED(DS_LOG_MODULE_ENABLED(DS_LOG_MODULE, dsLOG_LEVEL_WARN), INT_WARNING, "\r\n", FORMAT, ##__VA_ARGS__)
+#define INT_ERROR_RL(FORMAT, ...)      DS_LOG_RATELIMITED(DS_LOG_MODULE_ENABLED(DS_LOG_MODULE, dsLOG_LEVEL_ERROR), INT_ERROR, "\r\n", FORMAT, ##__VA_ARGS__)
+
 #endif
 
 
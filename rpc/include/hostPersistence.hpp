@@ -54,6 +54,7 @@ public:
 	std::string getProperty(const std::string &key, const std::string &defValue);
 	std::string getDefaultProperty(const std::string &key);
 	void persistHostProperty(const std::string &key, const std::string &value);
+	void persistHostProperties(const std::map<std::string, std::string> &properties);
 };
 
 }
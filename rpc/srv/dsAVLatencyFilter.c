@@ -0,0 +1,230 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2025 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+
+/**
+* @defgroup devicesettings
+* @{
+* @defgroup rpc
+* @{
+**/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <pthread.h>
+#include <time.h>
+#include "dsAVLatencyFilter.h"
+#include "dsserverlogger.h"
+#include "dsTelemetry.h"
+
+static pthread_mutex_t filterLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t filterCond;
+static pthread_t filterThread;
+static bool filterRunning = false;
+static dsAVLatencyFilterConfig_t filterConfig = {
+    DS_AVLATENCY_MIN_CHANGE_MS, DS_AVLATENCY_SETTLE_MS, DS_AVLATENCY_MIN_INTERVAL_MS
+};
+static dsAVLatencyPublishFn filterPublish = NULL;
+static dsAVLatencyFilterStats_t filterStats;
+
+static bool havePublished = false;      /* nothing is compared against until the first publication */
+static int publishedAudio;
+static int publishedVideo;
+static unsigned long long publishedAtMs;
+
+static bool pending = false;            /* a change waits for settleMs and minIntervalMs */
+static int pendingAudio;
+static int pendingVideo;
+static unsigned long long pendingSinceMs;     /* the pending value was first seen */
+static unsigned long long pendingFirstMs;     /* the first of a run of pending values was seen */
+
+static unsigned long long _dsAVLatencyNowMs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+/* When the pending change may be published. Called with filterLock held. */
+static unsigned long long _dsAVLatencyDueMs(void)
+{
+    unsigned long long due = pendingSinceMs + filterConfig.settleMs;
+    /* A source that never settles still gets published now and then */
+    unsigned long long maxDeferMs = (filterConfig.minIntervalMs > filterConfig.settleMs) ?
+                                    filterConfig.minIntervalMs : filterConfig.settleMs;
+    if (due > pendingFirstMs + maxDeferMs) {
+        due = pendingFirstMs + maxDeferMs;
+    }
+    if (havePublished && (publishedAtMs + filterConfig.minIntervalMs > due)) {
+        due = publishedAtMs + filterConfig.minIntervalMs;
+    }
+    return due;
+}
+
+static void *_dsAVLatencyFilterThread(void *arg)
+{
+    (void)arg;
+    pthread_mutex_lock(&filterLock);
+    while (filterRunning) {
+        if (!pending) {
+            pthread_cond_wait(&filterCond, &filterLock);
+            continue;
+        }
+
+        unsigned long long now = _dsAVLatencyNowMs();
+        unsigned long long due = _dsAVLatencyDueMs();
+        if (now < due) {
+            struct timespec deadline;
+            deadline.tv_sec = due / 1000;
+            deadline.tv_nsec = (due % 1000) * 1000000;
+            pthread_cond_timedwait(&filterCond, &filterLock, &deadline);
+            continue;
+        }
+
+        int audio = pendingAudio;
+        int video = pendingVideo;
+        pending = false;
+        havePublished = true;
+        publishedAudio = audio;
+        publishedVideo = video;
+        publishedAtMs = now;
+        filterStats.published++;
+        dsAVLatencyPublishFn publish = filterPublish;
+        unsigned long raw = filterStats.raw;
+        unsigned long published = filterStats.published;
+        pthread_mutex_unlock(&filterLock);
+
+        INT_INFO("[%s]: audio %d video %d, %lu of %lu updates published\r\n", __FUNCTION__, audio, video, published, raw);
+        TELEMETRY_COUNT("HDMI_INFO_avlatency_published");
+        publish(audio, video);
+
+        pthread_mutex_lock(&filterLock);
+    }
+    pthread_mutex_unlock(&filterLock);
+    return NULL;
+}
+
+int dsAVLatencyFilterStart(const dsAVLatencyFilterConfig_t *config, dsAVLatencyPublishFn publish)
+{
+    pthread_mutex_lock(&filterLock);
+    filterConfig = *config;
+    filterPublish = publish;
+    if (filterRunning) {
+        pthread_cond_signal(&filterCond);
+        pthread_mutex_unlock(&filterLock);
+        return 0;
+    }
+
+    /* Deadlines are on the monotonic clock, so setting the time does not stall a publication */
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&filterCond, &attr);
+    pthread_condattr_destroy(&attr);
+
+    filterRunning = true;
+    pending = false;
+    if (0 != pthread_create(&filterThread, NULL, _dsAVLatencyFilterThread, NULL)) {
+        filterRunning = false;
+        pthread_cond_destroy(&filterCond);
+        pthread_mutex_unlock(&filterLock);
+        INT_ERROR("[%s]: cannot start the AV latency filter thread\r\n", __FUNCTION__);
+        return -1;
+    }
+    pthread_mutex_unlock(&filterLock);
+    INT_INFO("[%s]: min change %u ms, settle %u ms, min interval %u ms\r\n", __FUNCTION__,
+             config->minChangeMs, config->settleMs, config->minIntervalMs);
+    return 0;
+}
+
+void dsAVLatencyFilterStop(void)
+{
+    pthread_mutex_lock(&filterLock);
+    if (!filterRunning) {
+        pthread_mutex_unlock(&filterLock);
+        return;
+    }
+    filterRunning = false;
+    pending = false;
+    pthread_cond_signal(&filterCond);
+    pthread_mutex_unlock(&filterLock);
+
+    pthread_join(filterThread, NULL);
+    pthread_cond_destroy(&filterCond);
+}
+
+void dsAVLatencyFilterUpdate(int audioLatency, int videoLatency)
+{
+    TELEMETRY_COUNT("HDMI_INFO_avlatency_raw");
+    pthread_mutex_lock(&filterLock);
+    filterStats.raw++;
+
+    if (!filterRunning || (NULL == filterPublish)) {
+        dsAVLatencyPublishFn publish = filterPublish;
+        filterStats.published++;
+        pthread_mutex_unlock(&filterLock);
+        TELEMETRY_COUNT("HDMI_INFO_avlatency_published");
+        if (publish) {
+            publish(audioLatency, videoLatency);
+        }
+        return;
+    }
+
+    if (havePublished) {
+        int audioDelta = abs(audioLatency - publishedAudio);
+        int videoDelta = abs(videoLatency - publishedVideo);
+        if ((audioDelta < (int)filterConfig.minChangeMs) && (videoDelta < (int)filterConfig.minChangeMs)) {
+            /* Back within the band of what listeners already have */
+            pending = false;
+            pthread_mutex_unlock(&filterLock);
+            return;
+        }
+    }
+
+    unsigned long long now = _dsAVLatencyNowMs();
+    if (!havePublished) {
+        /* The first value is published without waiting to settle */
+        pendingSinceMs = now - filterConfig.settleMs;
+        pendingFirstMs = pendingSinceMs;
+    } else if (!pending) {
+        pendingSinceMs = now;
+        pendingFirstMs = now;
+    } else if ((audioLatency != pendingAudio) || (videoLatency != pendingVideo)) {
+        pendingSinceMs = now;
+    }
+    pending = true;
+    pendingAudio = audioLatency;
+    pendingVideo = videoLatency;
+    pthread_cond_signal(&filterCond);
+    pthread_mutex_unlock(&filterLock);
+}
+
+void dsAVLatencyFilterGetStats(dsAVLatencyFilterStats_t *stats)
+{
+    pthread_mutex_lock(&filterLock);
+    *stats = filterStats;
+    pthread_mutex_unlock(&filterLock);
+}
+
+
+/** @} */
+/** @} */
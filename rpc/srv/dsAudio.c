@@ -27,6 +27,8 @@
 **/
 
 
+#define DS_LOG_MODULE dsLOG_MODULE_AUDIO
+
 #include "dsAudio.h"
 #include "dsTelemetry.h"
 
@@ -48,9 +50,13 @@
 #include "iarmUtil.h"
 #include "dsRpc.h"
 #include "dsMgr.h"
+#include "dsPerfStats.h"
+#include "dsEventTrace.h"
 #include "hostPersistence.hpp"
 #include "dsserverlogger.h"
 #include "dsAudioConfig.h"
+#include "dsAudioRamp.h"
+#include "dsAudioDucking.h"
 
 #include "safec_lib.h"
 
@@ -66,6 +72,17 @@ static int m_MuteStatus = false;
 static int m_isDuckingInProgress = false;
 static bool m_AudioPortEnabled[dsAUDIOPORT_TYPE_MAX] = {false};
 
+/* Fade of the speaker level when ducking starts or stops; 0 applies it at once */
+#ifndef DS_AUDIO_DUCKING_RAMP_MS
+#define DS_AUDIO_DUCKING_RAMP_MS    150
+#endif
+
+/* Ramp channels of a port: the user volume, and the ducking fade which only moves the HAL level */
+enum {
+    DS_AUDIO_RAMP_VOLUME = 0,
+    DS_AUDIO_RAMP_DUCKING
+};
+
 static pthread_mutex_t dsLock = PTHREAD_MUTEX_INITIALIZER;
 static pthread_mutex_t audioLevelMutex = PTHREAD_MUTEX_INITIALIZER;
 static pthread_cond_t      audioLevelTimerCV = PTHREAD_COND_INITIALIZER;
@@ -98,8 +115,8 @@ static std::atomic<bool>  audioLevel_timer_set = ATOMIC_VAR_INIT(false);
 static void* persist_audioLevel_timer_threadFunc(void*arg);
 #endif
 
-#define IARM_BUS_Lock(lock) pthread_mutex_lock(&dsLock)
-#define IARM_BUS_Unlock(lock) pthread_mutex_unlock(&dsLock)
+#define IARM_BUS_Lock(lock) dsPerfMutexLock(&dsLock)
+#define IARM_BUS_Unlock(lock) dsPerfMutexUnlock(&dsLock)
 
 IARM_Result_t _dsAudioPortInit(void *arg);
 IARM_Result_t _dsGetAudioPort(void *arg);
@@ -125,8 +142,10 @@ IARM_Result_t _dsSetEnablePersist(void *arg);
 
 IARM_Result_t _dsEnableAudioPort(void *arg);
 IARM_Result_t _dsSetAudioDucking(void *arg);
+IARM_Result_t _dsSetAudioDuckingSource(void *arg);
 IARM_Result_t _dsGetAudioLevel(void *arg);
 IARM_Result_t _dsSetAudioLevel(void *arg);
+IARM_Result_t _dsAudioRampLevel(void *arg);
 IARM_Result_t _dsGetAudioGain(void *arg);
 IARM_Result_t _dsSetAudioGain(void *arg);
 IARM_Result_t _dsEnableLEConfig(void *arg);
@@ -206,6 +225,10 @@ static IARM_Result_t _setBassEnhancer(intptr_t handle ,int boost);
 static IARM_Result_t _setVolumeLeveller(intptr_t handle, int volLevellerMode, int volLevellerLevel);
 static IARM_Result_t _setSurroundVirtualizer(intptr_t handle , int virtualizerMode , int virtualizerBoost);
 static IARM_Result_t setAudioDuckingAudioLevel(intptr_t handle);
+static void _dsPersistAudioLevel(dsAudioPortType_t _APortType, float level);
+static void _dsBroadcastAudioLevel(intptr_t handle, int volume);
+static void _dsCommitAudioRamp(intptr_t handle);
+static void _dsAudioRampDuckingStep(intptr_t handle, int channel, unsigned int id, float level, bool last);
 
 typedef dsError_t (*dsSetAudioLevel_t)(intptr_t handle, float level);
 static dsSetAudioLevel_t dsSetAudioLevelFunc = 0;
@@ -2102,7 +2125,7 @@ void AudioConfigInit()
 
 IARM_Result_t dsAudioMgr_init()
 {
-   IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsAudioPortInit, _dsAudioPortInit);
+   dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsAudioPortInit, _dsAudioPortInit);
    IARM_BUS_Lock(lock);
    try
 	{
@@ -2342,7 +2365,7 @@ IARM_Result_t dsAudioMgr_init()
            IARM_Bus_DSMgr_EventData_t audio_portstate_event_data;
            audio_portstate_event_data.data.AudioPortStateInfo.audioPortState = dsAUDIOPORT_STATE_INITIALIZED;
            INT_INFO("%s: AudioOutPort PortInitState:%d \r\n", __FUNCTION__, audio_portstate_event_data.data.AudioPortStateInfo.audioPortState);
-           IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,
+           dsMgr_BroadcastEvent(
                            (IARM_EventId_t)IARM_BUS_DSMGR_EVENT_AUDIO_PORT_STATE,
                            (void *)&audio_portstate_event_data,
                            sizeof(audio_portstate_event_data));
@@ -2366,6 +2389,8 @@ IARM_Result_t dsAudioMgr_init()
 
 IARM_Result_t dsAudioMgr_term()
 {
+    /* Not under lock, a ramp step may be waiting for it */
+    dsAudioRampTerm();
     #ifdef DS_AUDIO_SETTINGS_PERSISTENCE
 	bool shouldJoin = false;
 	pthread_t threadId;
@@ -2390,85 +2415,87 @@ IARM_Result_t _dsAudioPortInit(void *arg)
 
     if (!m_isInitialized) {
 
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetAudioPort,_dsGetAudioPort);
-	IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetSupportedARCTypes,_dsGetSupportedARCTypes);
-	IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsAudioSetSAD,_dsAudioSetSAD);
-	IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsAudioEnableARC,_dsAudioEnableARC);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetStereoMode,_dsSetStereoMode);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetStereoMode,_dsGetStereoMode);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetStereoAuto,_dsSetStereoAuto);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetStereoAuto,_dsGetStereoAuto);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetAudioMute,_dsSetAudioMute);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsIsAudioMute,_dsIsAudioMute);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetAudioDucking,_dsSetAudioDucking);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetAudioLevel,_dsSetAudioLevel);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetAudioLevel,_dsGetAudioLevel);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetAudioGain,_dsSetAudioGain);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetAudioGain,_dsGetAudioGain);
-	IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetAudioFormat,_dsGetAudioFormat);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetEncoding,_dsGetEncoding);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsIsAudioMSDecode,_dsIsAudioMSDecode);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsIsAudioMS12Decode,_dsIsAudioMS12Decode);
-
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsIsAudioPortEnabled,_dsIsAudioPortEnabled);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsEnableAudioPort,_dsEnableAudioPort);
-
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetEnablePersist, _dsGetEnablePersist);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetEnablePersist, _dsSetEnablePersist);
-
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsAudioPortTerm,_dsAudioPortTerm);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsEnableLEConfig,_dsEnableLEConfig);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetLEConfig,_dsGetLEConfig);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetAudioDelay, _dsSetAudioDelay);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetAudioDelay, _dsGetAudioDelay);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetSinkDeviceAtmosCapability, _dsGetSinkDeviceAtmosCapability);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetAudioAtmosOutputMode, _dsSetAudioAtmosOutputMode);      
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetAudioAtmosOutputMode, _dsSetAudioAtmosOutputMode);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetAudioCompression, _dsSetAudioCompression);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetAudioCompression, _dsGetAudioCompression);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetDialogEnhancement, _dsSetDialogEnhancement);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetDialogEnhancement, _dsGetDialogEnhancement);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetDolbyVolumeMode, _dsSetDolbyVolumeMode);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetDolbyVolumeMode	, _dsGetDolbyVolumeMode);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetIntelligentEqualizerMode, _dsSetIntelligentEqualizerMode);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetIntelligentEqualizerMode, _dsGetIntelligentEqualizerMode);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetVolumeLeveller, _dsGetVolumeLeveller);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetVolumeLeveller, _dsSetVolumeLeveller);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetBassEnhancer, _dsGetBassEnhancer);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetBassEnhancer, _dsSetBassEnhancer);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsIsSurroundDecoderEnabled, _dsIsSurroundDecoderEnabled);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsEnableSurroundDecoder, _dsEnableSurroundDecoder);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetDRCMode, _dsGetDRCMode);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetDRCMode, _dsSetDRCMode);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetSurroundVirtualizer, _dsGetSurroundVirtualizer);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetSurroundVirtualizer, _dsSetSurroundVirtualizer);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetMISteering, _dsGetMISteering);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetMISteering, _dsSetMISteering);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetGraphicEqualizerMode, _dsGetGraphicEqualizerMode);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetGraphicEqualizerMode, _dsSetGraphicEqualizerMode);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetMS12AudioProfileList, _dsGetMS12AudioProfileList);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetMS12AudioProfile, _dsGetMS12AudioProfile);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetMS12AudioProfile, _dsSetMS12AudioProfile);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetAudioMixerLevels,  _dsSetAudioMixerLevels);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetAssociatedAudioMixing, _dsSetAssociatedAudioMixing);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetAssociatedAudioMixing, _dsGetAssociatedAudioMixing);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetFaderControl, _dsSetFaderControl);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetFaderControl, _dsGetFaderControl);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetPrimaryLanguage, _dsSetPrimaryLanguage);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetPrimaryLanguage, _dsGetPrimaryLanguage);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetSecondaryLanguage, _dsSetSecondaryLanguage);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetSecondaryLanguage, _dsGetSecondaryLanguage);
-
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetAudioCapabilities,_dsGetAudioCapabilities); 
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetMS12Capabilities,_dsGetMS12Capabilities); 
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsAudioOutIsConnected, _dsAudioOutIsConnected); 
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetMS12SetttingsOverride, _dsSetMS12SetttingsOverride);
-
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsResetDialogEnhancement,_dsResetDialogEnhancement);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsResetBassEnhancer,_dsResetBassEnhancer);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsResetSurroundVirtualizer,_dsResetSurroundVirtualizer);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsResetVolumeLeveller,_dsResetVolumeLeveller);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetHDMIARCPortId, _dsGetHDMIARCPortId);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetAudioPort,_dsGetAudioPort);
+	dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetSupportedARCTypes,_dsGetSupportedARCTypes);
+	dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsAudioSetSAD,_dsAudioSetSAD);
+	dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsAudioEnableARC,_dsAudioEnableARC);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetStereoMode,_dsSetStereoMode);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetStereoMode,_dsGetStereoMode);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetStereoAuto,_dsSetStereoAuto);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetStereoAuto,_dsGetStereoAuto);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetAudioMute,_dsSetAudioMute);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsIsAudioMute,_dsIsAudioMute);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetAudioDucking,_dsSetAudioDucking);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetAudioDuckingSource,_dsSetAudioDuckingSource);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetAudioLevel,_dsSetAudioLevel);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsAudioRampLevel,_dsAudioRampLevel);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetAudioLevel,_dsGetAudioLevel);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetAudioGain,_dsSetAudioGain);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetAudioGain,_dsGetAudioGain);
+	dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetAudioFormat,_dsGetAudioFormat);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetEncoding,_dsGetEncoding);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsIsAudioMSDecode,_dsIsAudioMSDecode);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsIsAudioMS12Decode,_dsIsAudioMS12Decode);
+
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsIsAudioPortEnabled,_dsIsAudioPortEnabled);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsEnableAudioPort,_dsEnableAudioPort);
+
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetEnablePersist, _dsGetEnablePersist);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetEnablePersist, _dsSetEnablePersist);
+
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsAudioPortTerm,_dsAudioPortTerm);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsEnableLEConfig,_dsEnableLEConfig);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetLEConfig,_dsGetLEConfig);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetAudioDelay, _dsSetAudioDelay);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetAudioDelay, _dsGetAudioDelay);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetSinkDeviceAtmosCapability, _dsGetSinkDeviceAtmosCapability);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetAudioAtmosOutputMode, _dsSetAudioAtmosOutputMode);      
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetAudioAtmosOutputMode, _dsSetAudioAtmosOutputMode);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetAudioCompression, _dsSetAudioCompression);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetAudioCompression, _dsGetAudioCompression);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetDialogEnhancement, _dsSetDialogEnhancement);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetDialogEnhancement, _dsGetDialogEnhancement);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetDolbyVolumeMode, _dsSetDolbyVolumeMode);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetDolbyVolumeMode	, _dsGetDolbyVolumeMode);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetIntelligentEqualizerMode, _dsSetIntelligentEqualizerMode);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetIntelligentEqualizerMode, _dsGetIntelligentEqualizerMode);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetVolumeLeveller, _dsGetVolumeLeveller);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetVolumeLeveller, _dsSetVolumeLeveller);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetBassEnhancer, _dsGetBassEnhancer);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetBassEnhancer, _dsSetBassEnhancer);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsIsSurroundDecoderEnabled, _dsIsSurroundDecoderEnabled);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsEnableSurroundDecoder, _dsEnableSurroundDecoder);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetDRCMode, _dsGetDRCMode);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetDRCMode, _dsSetDRCMode);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetSurroundVirtualizer, _dsGetSurroundVirtualizer);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetSurroundVirtualizer, _dsSetSurroundVirtualizer);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetMISteering, _dsGetMISteering);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetMISteering, _dsSetMISteering);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetGraphicEqualizerMode, _dsGetGraphicEqualizerMode);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetGraphicEqualizerMode, _dsSetGraphicEqualizerMode);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetMS12AudioProfileList, _dsGetMS12AudioProfileList);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetMS12AudioProfile, _dsGetMS12AudioProfile);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetMS12AudioProfile, _dsSetMS12AudioProfile);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetAudioMixerLevels,  _dsSetAudioMixerLevels);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetAssociatedAudioMixing, _dsSetAssociatedAudioMixing);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetAssociatedAudioMixing, _dsGetAssociatedAudioMixing);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetFaderControl, _dsSetFaderControl);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetFaderControl, _dsGetFaderControl);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetPrimaryLanguage, _dsSetPrimaryLanguage);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetPrimaryLanguage, _dsGetPrimaryLanguage);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetSecondaryLanguage, _dsSetSecondaryLanguage);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetSecondaryLanguage, _dsGetSecondaryLanguage);
+
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetAudioCapabilities,_dsGetAudioCapabilities); 
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetMS12Capabilities,_dsGetMS12Capabilities); 
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsAudioOutIsConnected, _dsAudioOutIsConnected); 
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetMS12SetttingsOverride, _dsSetMS12SetttingsOverride);
+
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsResetDialogEnhancement,_dsResetDialogEnhancement);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsResetBassEnhancer,_dsResetBassEnhancer);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsResetSurroundVirtualizer,_dsResetSurroundVirtualizer);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsResetVolumeLeveller,_dsResetVolumeLeveller);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetHDMIARCPortId, _dsGetHDMIARCPortId);
 
         dsError_t eRet = _dsAudioOutRegisterConnectCB (_dsAudioOutPortConnectCB);
         if (dsERR_NONE != eRet) {
@@ -2516,7 +2543,7 @@ IARM_Result_t _dsGetAudioPort(void *arg)
 
     if (param != NULL)
     {
-        INT_INFO("%s..%d-%d \r\n",__func__,param->type,param->index);
+        INT_INFO_RL("%s..%d-%d \r\n",__func__,param->type,param->index);
         ret = dsGetAudioPort(param->type, param->index, &param->handle);
         if(ret == dsERR_NONE) {
             result = IARM_RESULT_SUCCESS;
@@ -2582,15 +2609,15 @@ IARM_Result_t _dsGetStereoMode(void *arg)
             if (_APortType == dsAUDIOPORT_TYPE_SPDIF)
             {
                 param->mode = _srv_SPDIF_Audiomode;
-                INT_INFO("The SPDIF Port Audio Settings Mode is %d \r\n",param->mode);
+                INT_INFO_RL("The SPDIF Port Audio Settings Mode is %d \r\n",param->mode);
             }
             else if (_APortType == dsAUDIOPORT_TYPE_HDMI) {
                 param->mode = _srv_HDMI_Audiomode;
-                INT_INFO("The HDMI Port Audio Settings Mode is %d \r\n",param->mode);
+                INT_INFO_RL("The HDMI Port Audio Settings Mode is %d \r\n",param->mode);
             }
             else if (_APortType == dsAUDIOPORT_TYPE_HDMI_ARC) {
                 param->mode = _srv_HDMI_ARC_Audiomode;
-                INT_INFO("The HDMI ARC Port Audio Settings Mode is %d \r\n",param->mode);
+                INT_INFO_RL("The HDMI ARC Port Audio Settings Mode is %d \r\n",param->mode);
             }
 
             result = IARM_RESULT_SUCCESS;
@@ -2662,7 +2689,7 @@ IARM_Result_t _dsSetStereoMode(void *arg)
 
                 eventData.data.Audioport.mode = dsAUDIO_STEREO_STEREO;
                 eventData.data.Audioport.type = _APortType;
-                IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,(IARM_EventId_t)IARM_BUS_DSMGR_EVENT_AUDIO_MODE,(void *)&eventData, sizeof(eventData));
+                dsMgr_BroadcastEvent((IARM_EventId_t)IARM_BUS_DSMGR_EVENT_AUDIO_MODE,(void *)&eventData, sizeof(eventData));
 
             }
             else if(param->mode == dsAUDIO_STEREO_SURROUND)
@@ -2700,7 +2727,7 @@ IARM_Result_t _dsSetStereoMode(void *arg)
 
                 eventData.data.Audioport.mode = dsAUDIO_STEREO_SURROUND;
                 eventData.data.Audioport.type = _APortType;
-                IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,(IARM_EventId_t)IARM_BUS_DSMGR_EVENT_AUDIO_MODE,(void *)&eventData, sizeof(eventData));
+                dsMgr_BroadcastEvent((IARM_EventId_t)IARM_BUS_DSMGR_EVENT_AUDIO_MODE,(void *)&eventData, sizeof(eventData));
             }
             else if(param->mode == dsAUDIO_STEREO_DD)
             {
@@ -2723,7 +2750,7 @@ IARM_Result_t _dsSetStereoMode(void *arg)
 
                 eventData.data.Audioport.mode = dsAUDIO_STEREO_DD;
                 eventData.data.Audioport.type = _APortType;
-                IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,(IARM_EventId_t)IARM_BUS_DSMGR_EVENT_AUDIO_MODE,(void *)&eventData, sizeof(eventData));
+                dsMgr_BroadcastEvent((IARM_EventId_t)IARM_BUS_DSMGR_EVENT_AUDIO_MODE,(void *)&eventData, sizeof(eventData));
             }
             else if(param->mode == dsAUDIO_STEREO_DDPLUS)
             {
@@ -2746,7 +2773,7 @@ IARM_Result_t _dsSetStereoMode(void *arg)
 
                 eventData.data.Audioport.mode = dsAUDIO_STEREO_DDPLUS;
                 eventData.data.Audioport.type = _APortType;
-                IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,(IARM_EventId_t)IARM_BUS_DSMGR_EVENT_AUDIO_MODE,(void *)&eventData, sizeof(eventData));
+                dsMgr_BroadcastEvent((IARM_EventId_t)IARM_BUS_DSMGR_EVENT_AUDIO_MODE,(void *)&eventData, sizeof(eventData));
             }
             else if(param->mode == dsAUDIO_STEREO_PASSTHRU)
             {
@@ -2785,7 +2812,7 @@ IARM_Result_t _dsSetStereoMode(void *arg)
 
                 eventData.data.Audioport.mode = dsAUDIO_STEREO_PASSTHRU;
                 eventData.data.Audioport.type = _APortType;
-                IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,(IARM_EventId_t)IARM_BUS_DSMGR_EVENT_AUDIO_MODE,(void *)&eventData, sizeof(eventData));
+                dsMgr_BroadcastEvent((IARM_EventId_t)IARM_BUS_DSMGR_EVENT_AUDIO_MODE,(void *)&eventData, sizeof(eventData));
 
             }
 
@@ -2924,59 +2951,60 @@ IARM_Result_t _dsSetStereoAuto(void *arg)
     return IARM_RESULT_SUCCESS;
 }
 
-IARM_Result_t _dsSetAudioDucking(void *arg)
+/* Apply a ducking request of source and the level it leads to. Called with lock held. */
+static dsError_t _dsApplyAudioDucking(intptr_t handle, unsigned int source, int priority,
+                                      dsAudioDuckingAction_t action, dsAudioDuckingType_t type, unsigned char level)
 {
-    _DEBUG_ENTER();
-
-    IARM_BUS_Lock(lock);
     int volume = 0;
     bool portEnabled = false;
-    dsAudioSetDuckingParam_t *param = (dsAudioSetDuckingParam_t *)arg;
-    IARM_Bus_DSMgr_EventData_t eventData;
-    INT_INFO("%s action : %d type :%d val :%d m_LastVolumeLevel :%f  \n",__FUNCTION__,param->action,param->type,param->level,float(m_LastVolumeLevel));
+    /* Ducking is relative to the level a running volume ramp is heading to */
+    _dsCommitAudioRamp(handle);
+    INT_INFO("%s source :%u priority :%d action : %d type :%d val :%d m_LastVolumeLevel :%f  \n",__FUNCTION__,source,priority,action,type,level,float(m_LastVolumeLevel));
 
-    dsError_t ret = dsIsAudioPortEnabled(param->handle, &portEnabled);
+    dsError_t ret = dsIsAudioPortEnabled(handle, &portEnabled);
     if (ret != dsERR_NONE) {
         INT_ERROR("%s failed dsIsAudioPortEnabled\n",__FUNCTION__);
     }
 
-    if(param->action == dsAUDIO_DUCKINGACTION_START)
+    /* The HAL is at the ducked level of the port while it ducks, else at the user level.
+     * The speaker keeps the level it was ducked to when the volume is set meanwhile. */
+    bool speaker = (_GetAudioPortType(handle) == dsAUDIOPORT_TYPE_SPEAKER);
+    int current = (speaker && m_isDuckingInProgress) ? m_volumeDuckingLevel : dsAudioDuckingLevel(handle, m_LastVolumeLevel);
+    if(action == dsAUDIO_DUCKINGACTION_START)
     {
-        m_isDuckingInProgress = true;
-	if(param->type == dsAUDIO_DUCKINGTYPE_RELATIVE )
-	{
-             volume = (m_LastVolumeLevel* param->level) / 100;
-	}
-	else
-	{
-           if(param->level > m_LastVolumeLevel)
-           {
-		 volume =  m_LastVolumeLevel;
-	   }
-           else
-	   {
-        	 volume = param->level;
-           }
-	}
+        ret = dsAudioDuckingPush(handle, source, priority, type, level);
+        if (ret != dsERR_NONE) {
+            return ret;
+        }
     }
-    else
+    else if (!dsAudioDuckingPop(handle, source))
     {
-	m_isDuckingInProgress = false;
-	volume = (int)m_LastVolumeLevel;
+        INT_INFO("%s source :%u was not ducking\n",__FUNCTION__,source);
+        return dsERR_NONE;
+    }
+    volume = dsAudioDuckingLevel(handle, m_LastVolumeLevel);
+
+    /* The level setters hold only the speaker at its ducked level */
+    if (speaker)
+    {
+        m_isDuckingInProgress = dsAudioDuckingActive(handle);
+        m_volumeDuckingLevel = volume;
     }
 
     if(m_MuteStatus || !portEnabled)
     {
         INT_INFO("%s mute on/port disabled so ignore the duckig request\n",__FUNCTION__);
-        m_volumeDuckingLevel = volume;
-        IARM_BUS_Unlock(lock);
-        return IARM_RESULT_SUCCESS;
+        return dsERR_NONE;
     }
 
-    INT_INFO(":%s adjusted volume volume :%d m_volumeDuckingLevel :%d\n",__FUNCTION__,volume,m_volumeDuckingLevel );
+    INT_INFO(":%s adjusted volume volume :%d current :%d\n",__FUNCTION__,volume,current );
+    if (volume == current)
+    {
+        /* Overlapping requests that leave the level as is, or a fade already heading there */
+        return dsERR_NONE;
+    }
 
     // apply volume to hal layer
-    dsAudioPortType_t _APortType = _GetAudioPortType(param->handle);
     if (dsSetAudioLevelFunc == 0)
     {
         void *dllib = dlopen(RDK_DSHAL_NAME, RTLD_LAZY);
@@ -2994,36 +3022,55 @@ IARM_Result_t _dsSetAudioDucking(void *arg)
             INT_ERROR("Opening RDK_DSHAL_NAME [%s] failed \r\n", RDK_DSHAL_NAME);
 	}
     }
-    if (dsSetAudioLevelFunc != 0 )
+    /* Fade from where the port is, which a cut short fade left between both levels */
+    float from = current;
+    if (dsGetAudioLevelfunc != 0) {
+        dsGetAudioLevelfunc(handle, &from);
+    }
+    dsAudioRampCancel(handle, DS_AUDIO_RAMP_DUCKING, NULL);
+    if ((DS_AUDIO_DUCKING_RAMP_MS > 0) && (dsSetAudioLevelFunc != 0) &&
+        (dsERR_NONE == dsAudioRampStart(handle, DS_AUDIO_RAMP_DUCKING, from, volume, DS_AUDIO_DUCKING_RAMP_MS,
+                                        dsAUDIO_RAMP_CURVE_EXPONENTIAL, _dsAudioRampDuckingStep, NULL)))
     {
-        dsSetAudioLevelFunc(param->handle, volume);
+        /* Broadcast by the last step of the fade */
+        return dsERR_NONE;
     }
 
-    if(volume != m_volumeDuckingLevel)
+    if (dsSetAudioLevelFunc != 0 )
     {
-        m_volumeDuckingLevel = volume;
+        dsSetAudioLevelFunc(handle, volume);
+    }
+    _dsBroadcastAudioLevel(handle, volume);
+    return dsERR_NONE;
+}
 
-        dsAudioStereoMode_t mode = dsAUDIO_STEREO_STEREO;
-        if (_APortType == dsAUDIOPORT_TYPE_SPDIF)
-        {
-                mode = _srv_SPDIF_Audiomode;
-        }
-        else if (_APortType == dsAUDIOPORT_TYPE_HDMI) {
-                mode = _srv_HDMI_Audiomode;
-        }
-        INT_INFO("The Port type is :%d  Audio Settings Mode is %d \r\n",_APortType, mode);
+IARM_Result_t _dsSetAudioDucking(void *arg)
+{
+    _DEBUG_ENTER();
 
-        if(mode == dsAUDIO_STEREO_PASSTHRU && volume != 100)
-        {
-            eventData.data.AudioLevelInfo.level = 0;
-            INT_DEBUG(" IARM_BUS_DSMGR_EVENT_AUDIO_LEVEL_CHANGED PASSTHRU mode volume:%d \n",eventData.data.AudioLevelInfo.level);
-        }
-        else
-        {
-            eventData.data.AudioLevelInfo.level = volume;
-            INT_DEBUG(" IARM_BUS_DSMGR_EVENT_AUDIO_LEVEL_CHANGED  volume:%d \n ",eventData.data.AudioLevelInfo.level);
-        }
-        IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,(IARM_EventId_t)IARM_BUS_DSMGR_EVENT_AUDIO_LEVEL_CHANGED,(void *)&eventData, sizeof(eventData));
+    IARM_BUS_Lock(lock);
+    dsAudioSetDuckingParam_t *param = (dsAudioSetDuckingParam_t *)arg;
+    /* This RPC has no result field, so a dropped request is only logged */
+    dsError_t ret = _dsApplyAudioDucking(param->handle, DS_AUDIO_DUCKING_SOURCE_DEFAULT, 0, param->action, param->type, param->level);
+    if (ret != dsERR_NONE) {
+        INT_ERROR("%s: ducking request on handle %ld dropped, error %d\n", __FUNCTION__, (long)param->handle, ret);
+    }
+    IARM_BUS_Unlock(lock);
+
+    return IARM_RESULT_SUCCESS;
+}
+
+IARM_Result_t _dsSetAudioDuckingSource(void *arg)
+{
+    _DEBUG_ENTER();
+
+    IARM_BUS_Lock(lock);
+    dsAudioSetDuckingSourceParam_t *param = (dsAudioSetDuckingSourceParam_t *)arg;
+    if (param->source == DS_AUDIO_DUCKING_SOURCE_DEFAULT) {
+        /* Reserved for dsSetAudioDucking, whose requests would otherwise be replaced */
+        param->result = dsERR_INVALID_PARAM;
+    } else {
+        param->result = _dsApplyAudioDucking(param->handle, param->source, param->priority, param->action, param->type, param->level);
     }
     IARM_BUS_Unlock(lock);
 
@@ -3050,7 +3097,7 @@ IARM_Result_t _dsGetAudioGain(void *arg)
                 INT_DEBUG("dsGetAudioGain_t(int, float *) is defined and loaded\r\n");
             }
             else {
-                INT_INFO("dsGetAudioGain_t(int, float *) is not defined\r\n");
+                INT_INFO_RL("dsGetAudioGain_t(int, float *) is not defined\r\n");
             }
             dlclose(dllib);
         }
@@ -3094,7 +3141,7 @@ IARM_Result_t _dsGetAudioLevel(void *arg)
                 INT_DEBUG("dsGetAudioLevel_t(int, float *) is defined and loaded\r\n");
             }
             else {
-                INT_INFO("dsGetAudioLevel_t(int, float *) is not defined\r\n");
+                INT_INFO_RL("dsGetAudioLevel_t(int, float *) is not defined\r\n");
             }
             dlclose(dllib);
         }
@@ -3218,6 +3265,9 @@ IARM_Result_t _dsSetAudioLevel(void *arg)
     dsAudioSetLevelParam_t *param = (dsAudioSetLevelParam_t *)arg;
     if (dsSetAudioLevelFunc != 0 && param != NULL)
     {
+        /* A set supersedes the ramps of the port */
+        dsAudioRampCancel(param->handle, DS_AUDIO_RAMP_VOLUME, NULL);
+        bool duckFading = dsAudioRampCancel(param->handle, DS_AUDIO_RAMP_DUCKING, NULL);
         dsAudioPortType_t _APortType = _GetAudioPortType(param->handle);
         if(_APortType == dsAUDIOPORT_TYPE_SPEAKER)
         {
@@ -3253,6 +3303,10 @@ IARM_Result_t _dsSetAudioLevel(void *arg)
             if(m_isDuckingInProgress && currlevel != m_volumeDuckingLevel )
             {
                dsSetAudioLevelFunc(param->handle, m_volumeDuckingLevel);
+               if (duckFading) {
+                   /* The fade was cut short, report where it was going */
+                   _dsBroadcastAudioLevel(param->handle, m_volumeDuckingLevel);
+               }
             }
             else if (m_isDuckingInProgress || dsSetAudioLevelFunc(param->handle, param->level) == dsERR_NONE)
             {
@@ -3262,62 +3316,209 @@ IARM_Result_t _dsSetAudioLevel(void *arg)
             result = IARM_RESULT_SUCCESS;
         }
 	m_LastVolumeLevel = {param->level};
+        _dsPersistAudioLevel(_APortType, param->level);
+    }
+
+    IARM_BUS_Unlock(lock);
+
+    return result;
+
+}
+
+/* Store the level of a port type, through the persistence timer when it runs */
+static void _dsPersistAudioLevel(dsAudioPortType_t _APortType, float level)
+{
 #ifdef DS_AUDIO_SETTINGS_PERSISTENCE
-        std::string _AudioLevel = std::to_string(param->level);
-        switch(_APortType) {
-                case dsAUDIOPORT_TYPE_SPDIF:
-                    if(persist_audioLevel_timer_threadIsAlive) {
-                      audioLevel_cache_spdif = {param->level};
-                    }
-                    else {
-                      device::HostPersistence::getInstance().persistHostProperty("SPDIF0.audio.Level",_AudioLevel);
-                    }
-                    break;
-                case dsAUDIOPORT_TYPE_HDMI:
-                    if(persist_audioLevel_timer_threadIsAlive) {
-                      audioLevel_cache_hdmi = {param->level};
-                    }
-                    else {
-                      device::HostPersistence::getInstance().persistHostProperty("HDMI0.audio.Level",_AudioLevel);
-                    }
-                    break;
-                case dsAUDIOPORT_TYPE_SPEAKER:
-		    if(persist_audioLevel_timer_threadIsAlive) {
-                      audioLevel_cache_speaker = {param->level};
-                    }
-                    else {
-                      device::HostPersistence::getInstance().persistHostProperty("SPEAKER0.audio.Level",_AudioLevel);
-                    }
-                    break;
-                case dsAUDIOPORT_TYPE_HEADPHONE:
-                    if(persist_audioLevel_timer_threadIsAlive) {
-                      audioLevel_cache_headphone = {param->level};
-                    }
-                    else {
-                      device::HostPersistence::getInstance().persistHostProperty("HEADPHONE0.audio.Level",_AudioLevel);
-                    }
-                    break;
-                default:
-                    break;
+    std::string _AudioLevel = std::to_string(level);
+    switch(_APortType) {
+        case dsAUDIOPORT_TYPE_SPDIF:
+            if(persist_audioLevel_timer_threadIsAlive) {
+                audioLevel_cache_spdif = {level};
+            }
+            else {
+                device::HostPersistence::getInstance().persistHostProperty("SPDIF0.audio.Level",_AudioLevel);
+            }
+            break;
+        case dsAUDIOPORT_TYPE_HDMI:
+            if(persist_audioLevel_timer_threadIsAlive) {
+                audioLevel_cache_hdmi = {level};
+            }
+            else {
+                device::HostPersistence::getInstance().persistHostProperty("HDMI0.audio.Level",_AudioLevel);
+            }
+            break;
+        case dsAUDIOPORT_TYPE_SPEAKER:
+            if(persist_audioLevel_timer_threadIsAlive) {
+                audioLevel_cache_speaker = {level};
+            }
+            else {
+                device::HostPersistence::getInstance().persistHostProperty("SPEAKER0.audio.Level",_AudioLevel);
+            }
+            break;
+        case dsAUDIOPORT_TYPE_HEADPHONE:
+            if(persist_audioLevel_timer_threadIsAlive) {
+                audioLevel_cache_headphone = {level};
+            }
+            else {
+                device::HostPersistence::getInstance().persistHostProperty("HEADPHONE0.audio.Level",_AudioLevel);
+            }
+            break;
+        default:
+            break;
+    }
+    if(persist_audioLevel_timer_threadIsAlive){
+        if(!audioLevel_timer_set){
+            pthread_mutex_lock(&audioLevelMutex);
+            audioLevel_timer_set = true;
+            if(pthread_cond_signal(&audioLevelTimerCV) != 0){
+                INT_INFO("Error in signalling pthread CV\n");
+            }
+            pthread_mutex_unlock(&audioLevelMutex);
         }
-	if(persist_audioLevel_timer_threadIsAlive){
-		if(!audioLevel_timer_set){
-                  	pthread_mutex_lock(&audioLevelMutex);
-			audioLevel_timer_set = true;
-                  	if(pthread_cond_signal(&audioLevelTimerCV) != 0){
-                        	INT_INFO("Error in signalling pthread CV\n");
-                        }
-                  	pthread_mutex_unlock(&audioLevelMutex);
-                }
-	}
-
+    }
+#else
+    (void)_APortType;
+    (void)level;
 #endif
+}
+
+/* IARM_BUS_DSMGR_EVENT_AUDIO_LEVEL_CHANGED for a level applied to the HAL */
+static void _dsBroadcastAudioLevel(intptr_t handle, int volume)
+{
+    IARM_Bus_DSMgr_EventData_t eventData;
+    dsAudioPortType_t _APortType = _GetAudioPortType(handle);
+    dsAudioStereoMode_t mode = dsAUDIO_STEREO_STEREO;
+    if (_APortType == dsAUDIOPORT_TYPE_SPDIF)
+    {
+            mode = _srv_SPDIF_Audiomode;
+    }
+    else if (_APortType == dsAUDIOPORT_TYPE_HDMI) {
+            mode = _srv_HDMI_Audiomode;
+    }
+    INT_INFO("The Port type is :%d  Audio Settings Mode is %d \r\n",_APortType, mode);
+
+    if(mode == dsAUDIO_STEREO_PASSTHRU && volume != 100)
+    {
+        eventData.data.AudioLevelInfo.level = 0;
+        INT_DEBUG(" IARM_BUS_DSMGR_EVENT_AUDIO_LEVEL_CHANGED PASSTHRU mode volume:%d \n",eventData.data.AudioLevelInfo.level);
+    }
+    else
+    {
+        eventData.data.AudioLevelInfo.level = volume;
+        INT_DEBUG(" IARM_BUS_DSMGR_EVENT_AUDIO_LEVEL_CHANGED  volume:%d \n ",eventData.data.AudioLevelInfo.level);
+    }
+    dsMgr_BroadcastEvent((IARM_EventId_t)IARM_BUS_DSMGR_EVENT_AUDIO_LEVEL_CHANGED,(void *)&eventData, sizeof(eventData));
+}
+
+/* Apply a user volume level; the speaker stays at its ducked level while ducking */
+static void _dsApplyAudioLevel(intptr_t handle, float level)
+{
+    m_LastVolumeLevel = {level};
+    if (m_isDuckingInProgress && (_GetAudioPortType(handle) == dsAUDIOPORT_TYPE_SPEAKER)) {
+        return;
+    }
+    if (dsSetAudioLevelFunc != 0) {
+        dsSetAudioLevelFunc(handle, level);
+    }
+}
+
+/* Step of a volume ramp, from the ramp thread. Only the last one is persisted and broadcast. */
+static void _dsAudioRampVolumeStep(intptr_t handle, int channel, unsigned int id, float level, bool last)
+{
+    IARM_BUS_Lock(lock);
+    if (!dsAudioRampIsCurrent(handle, channel, id)) {
+        IARM_BUS_Unlock(lock);
+        return;
+    }
+    _dsApplyAudioLevel(handle, level);
+    if (last) {
+        dsAudioRampDone(handle, channel, id);
+        INT_INFO("%s: handle %ld reached level %f\n", __FUNCTION__, (long)handle, level);
+        _dsPersistAudioLevel(_GetAudioPortType(handle), level);
+        _dsBroadcastAudioLevel(handle, (int)level);
     }
+    IARM_BUS_Unlock(lock);
+}
 
+/* Step of a ducking fade, from the ramp thread. Only the last one is broadcast. */
+static void _dsAudioRampDuckingStep(intptr_t handle, int channel, unsigned int id, float level, bool last)
+{
+    IARM_BUS_Lock(lock);
+    if (!dsAudioRampIsCurrent(handle, channel, id)) {
+        IARM_BUS_Unlock(lock);
+        return;
+    }
+    if (dsSetAudioLevelFunc != 0) {
+        dsSetAudioLevelFunc(handle, level);
+    }
+    if (last) {
+        dsAudioRampDone(handle, channel, id);
+        _dsBroadcastAudioLevel(handle, (int)level);
+    }
     IARM_BUS_Unlock(lock);
+}
 
-    return result;
+/* Finish a running volume ramp at its target. Called with lock held. */
+static void _dsCommitAudioRamp(intptr_t handle)
+{
+    float target = 0;
+    if (dsAudioRampCancel(handle, DS_AUDIO_RAMP_VOLUME, &target)) {
+        INT_INFO("%s: handle %ld ramp committed at level %f\n", __FUNCTION__, (long)handle, target);
+        _dsApplyAudioLevel(handle, target);
+        _dsPersistAudioLevel(_GetAudioPortType(handle), target);
+        _dsBroadcastAudioLevel(handle, (int)target);
+    }
+}
+
+IARM_Result_t _dsAudioRampLevel(void *arg)
+{
+    _DEBUG_ENTER();
+    dsAudioRampLevelParam_t *param = (dsAudioRampLevelParam_t *)arg;
+    if (param == NULL) {
+        return IARM_RESULT_INVALID_PARAM;
+    }
+    IARM_BUS_Lock(lock);
+
+    if (dsSetAudioLevelFunc == 0) {
+        void *dllib = dlopen(RDK_DSHAL_NAME, RTLD_LAZY);
+        if (dllib) {
+            dsSetAudioLevelFunc = (dsSetAudioLevel_t) dlsym(dllib, "dsSetAudioLevel");
+            dlclose(dllib);
+        }
+        else {
+            INT_ERROR("Opening RDK_DSHAL_NAME [%s] failed\r\n", RDK_DSHAL_NAME);
+        }
+    }
+    if (dsSetAudioLevelFunc == 0) {
+        INT_INFO("dsSetAudioLevel_t(int, float ) is not defined\r\n");
+        param->result = dsERR_OPERATION_NOT_SUPPORTED;
+        IARM_BUS_Unlock(lock);
+        return IARM_RESULT_SUCCESS;
+    }
+    if ((param->target < 0) || (param->target > 100)) {
+        param->result = dsERR_INVALID_PARAM;
+        IARM_BUS_Unlock(lock);
+        return IARM_RESULT_SUCCESS;
+    }
+
+    /* Start where the port is, which is not the last level while a ramp is cut short.
+     * Only the speaker is held at the ducked level, as in _dsApplyAudioLevel. */
+    bool ducked = m_isDuckingInProgress && (_GetAudioPortType(param->handle) == dsAUDIOPORT_TYPE_SPEAKER);
+    float from = m_LastVolumeLevel;
+    if (dsGetAudioLevelfunc != 0 && !ducked) {
+        dsGetAudioLevelfunc(param->handle, &from);
+    }
+    if (!ducked) {
+        /* The volume ramp moves the HAL level from here on */
+        dsAudioRampCancel(param->handle, DS_AUDIO_RAMP_DUCKING, NULL);
+    }
+    INT_INFO("%s: handle %ld from %f to %f in %u ms, curve %d\n", __FUNCTION__,
+             (long)param->handle, from, param->target, param->durationMs, param->curve);
+    param->result = dsAudioRampStart(param->handle, DS_AUDIO_RAMP_VOLUME, from, param->target,
+                                     param->durationMs, param->curve, _dsAudioRampVolumeStep, NULL);
 
+    IARM_BUS_Unlock(lock);
+    return IARM_RESULT_SUCCESS;
 }
 
 static IARM_Result_t setAudioDuckingAudioLevel(intptr_t handle)
@@ -3457,11 +3658,11 @@ IARM_Result_t _dsIsAudioMute(void *arg)
             _mute = device::HostPersistence::getInstance().getProperty(isMuteKey);
         }
         catch(...) {
-            INT_INFO("%s : Exception in getting the %s from persistence storage\n", __FUNCTION__, isMuteKey.c_str());
+            INT_INFO_RL("%s : Exception in getting the %s from persistence storage\n", __FUNCTION__, isMuteKey.c_str());
             _mute = "FALSE";
         }
         if ("TRUE" == _mute) {
-            INT_INFO("%s: param mute to true \n", __FUNCTION__);
+            INT_INFO_RL("%s: param mute to true \n", __FUNCTION__);
             param->mute = true;
         }
         INT_DEBUG("%s: persist value:%s for :%s\n", __FUNCTION__, _mute.c_str(), isMuteKey.c_str());
@@ -3652,7 +3853,7 @@ IARM_Result_t _dsGetEnablePersist(void *arg)
     
     param->enabled = enabled;
     result = IARM_RESULT_SUCCESS;
-    INT_INFO("%s: persist dsEnableAudioPort value: %s for the port %s AudioPortEnable: %s result:%d \n", 
+    INT_INFO_RL("%s: persist dsEnableAudioPort value: %s for the port %s AudioPortEnable: %s result:%d \n", 
            __FUNCTION__, param->enabled? "TRUE":"FALSE", isEnabledAudioPortKey.c_str(), _AudioPortEnable.c_str(), result);
 
     IARM_BUS_Unlock(lock);
@@ -3724,7 +3925,7 @@ IARM_Result_t _dsGetAudioFormat(void *arg)
                 INT_DEBUG("dsGetAudioFormat_t(int, dsAudioFormat_t *) is defined and loaded\r\n");
             }
             else {
-                INT_INFO("dsGetAudioFormat_t(int, dsAudioFormat_t *) is not defined\r\n");
+                INT_INFO_RL("dsGetAudioFormat_t(int, dsAudioFormat_t *) is not defined\r\n");
             }
             dlclose(dllib);
         }
@@ -3748,7 +3949,7 @@ IARM_Result_t _dsGetAudioFormat(void *arg)
         }
         else
         {
-           INT_INFO("%s dsGetAudioFormat failed ret=%d\n",__FUNCTION__, ret);
+           INT_INFO_RL("%s dsGetAudioFormat failed ret=%d\n",__FUNCTION__, ret);
         }
     }
 
@@ -3863,7 +4064,7 @@ IARM_Result_t _dsIsAudioMSDecode(void *arg)
                 INT_DEBUG("dsIsAudioMSDecode(int, bool*) is defined and loaded\r\n");
             }   
             else {
-                INT_INFO("dsIsAudioMSDecode(int, bool*) is not defined\r\n");
+                INT_INFO_RL("dsIsAudioMSDecode(int, bool*) is not defined\r\n");
             }   
             dlclose(dllib);
         }   
@@ -3913,7 +4114,7 @@ IARM_Result_t _dsIsAudioMS12Decode(void *arg)
                 INT_DEBUG("dsIsAudioMS12Decode(int, bool*) is defined and loaded\r\n");
             }   
             else {
-                INT_INFO("dsIsAudioMS12Decode(int, bool*) is not defined\r\n");
+                INT_INFO_RL("dsIsAudioMS12Decode(int, bool*) is not defined\r\n");
             }   
             dlclose(dllib);
         }   
@@ -4121,7 +4322,7 @@ IARM_Result_t _dsGetAudioDelay(void *arg)
        dsAudioPortType_t _APortType = _GetAudioPortType(param->handle);
        audioDelayMs = dsGetAudioDelayInternal(_APortType);
        param->audioDelayMs = audioDelayMs;
-       INT_INFO("%s: (SERVER) getAudioDelay audioDelayMs: %d \n", __FUNCTION__,audioDelayMs);
+       INT_INFO_RL("%s: (SERVER) getAudioDelay audioDelayMs: %d \n", __FUNCTION__,audioDelayMs);
        result = IARM_RESULT_SUCCESS;
     }
 
@@ -4149,7 +4350,7 @@ IARM_Result_t _dsGetAudioDelayOffset(void *arg)
                 INT_DEBUG("dsGetAudioDelayOffset_t(int, uint32_t*) is defined and loaded\r\n");
             }
             else {
-                INT_INFO("dsGetAudioDelayOffset_t(int, uint32_t*) is not defined\r\n");
+                INT_INFO_RL("dsGetAudioDelayOffset_t(int, uint32_t*) is not defined\r\n");
             }
             dlclose(dllib);
         }
@@ -4237,7 +4438,7 @@ IARM_Result_t _dsGetSinkDeviceAtmosCapability(void *arg)
                 INT_DEBUG("dsGetSinkDeviceAtmosCapability_t (intptr_t handle, dsATMOSCapability_t *capability ) is defined and loaded\r\n");
             }
             else {
-                INT_INFO("dsGetSinkDeviceAtmosCapability_t (intptr_t handle, dsATMOSCapability_t *capability ) is not defined\r\n");
+                INT_INFO_RL("dsGetSinkDeviceAtmosCapability_t (intptr_t handle, dsATMOSCapability_t *capability ) is not defined\r\n");
             }
             dlclose(dllib);
         }
@@ -4332,7 +4533,7 @@ IARM_Result_t _dsGetAudioCompression(void *arg)
                 INT_DEBUG("dsGetAudioCompression_t(int, int *) is defined and loaded\r\n");
             }
             else {
-                INT_INFO("dsGetAudioCompression_t(int, int *) is not defined\r\n");
+                INT_INFO_RL("dsGetAudioCompression_t(int, int *) is not defined\r\n");
             }
             dlclose(dllib);
         }
@@ -4434,7 +4635,7 @@ IARM_Result_t _dsGetDialogEnhancement(void *arg)
                 INT_DEBUG("dsGetDialogEnhancement_t(int, int *) is defined and loaded\r\n");
             }
             else {
-                INT_INFO("dsGetDialogEnhancement_t(int, int *) is not defined\r\n");
+                INT_INFO_RL("dsGetDialogEnhancement_t(int, int *) is not defined\r\n");
             }
             dlclose(dllib);
         }
@@ -4528,7 +4729,7 @@ IARM_Result_t _dsGetDolbyVolumeMode(void *arg)
                 INT_DEBUG("dsGetDolbyVolumeMode_t(int, bool *) is defined and loaded\r\n");
             }
             else {
-                INT_INFO("dsGetDolbyVolumeMode_t(int, bool *) is not defined\r\n");
+                INT_INFO_RL("dsGetDolbyVolumeMode_t(int, bool *) is not defined\r\n");
             }
             dlclose(dllib);
         }
@@ -4623,7 +4824,7 @@ IARM_Result_t _dsGetIntelligentEqualizerMode(void *arg)
                 INT_DEBUG("dsGetIntelligentEqualizerMode_t(int, int *) is defined and loaded\r\n");
             }
             else {
-                INT_INFO("dsGetIntelligentEqualizerMode_t(int, int *) is not defined\r\n");
+                INT_INFO_RL("dsGetIntelligentEqualizerMode_t(int, int *) is not defined\r\n");
             }
             dlclose(dllib);
         }
@@ -4670,7 +4871,7 @@ IARM_Result_t _dsGetVolumeLeveller(void *arg)
                 INT_DEBUG("dsGetVolumeLeveller_t(int, dsVolumeLeveller_t *) is defined and loaded\r\n");
             }
             else {
-                INT_INFO("dsGetVolumeLeveller_t(int, dsVolumeLeveller_t *) is not defined\r\n");
+                INT_INFO_RL("dsGetVolumeLeveller_t(int, dsVolumeLeveller_t *) is not defined\r\n");
             }
             dlclose(dllib);
         }
@@ -4792,7 +4993,7 @@ IARM_Result_t _dsGetBassEnhancer(void *arg)
                 INT_DEBUG("dsGetBassEnhancer_t(int, int *) is defined and loaded\r\n");
             }
             else {
-                INT_INFO("dsGetBassEnhancer_t(int, int *) is not defined\r\n");
+                INT_INFO_RL("dsGetBassEnhancer_t(int, int *) is not defined\r\n");
             }
             dlclose(dllib);
         }
@@ -4894,7 +5095,7 @@ IARM_Result_t _dsIsSurroundDecoderEnabled(void *arg)
                 INT_DEBUG("dsIsSurroundDecoderEnabled_t(int, bool *) is defined and loaded\r\n");
             }
             else {
-                INT_INFO("dsIsSurroundDecoderEnabled_t(int, bool *) is not defined\r\n");
+                INT_INFO_RL("dsIsSurroundDecoderEnabled_t(int, bool *) is not defined\r\n");
             }
             dlclose(dllib);
         }
@@ -4989,7 +5190,7 @@ IARM_Result_t _dsGetDRCMode(void *arg)
                 INT_DEBUG("dsGetDRCMode_t(int, int *) is defined and loaded\r\n");
             }
             else {
-                INT_INFO("dsGetDRCMode_t(int, int *) is not defined\r\n");
+                INT_INFO_RL("dsGetDRCMode_t(int, int *) is not defined\r\n");
             }
             dlclose(dllib);
         }
@@ -5083,7 +5284,7 @@ IARM_Result_t _dsGetSurroundVirtualizer(void *arg)
                 INT_DEBUG("dsGetSurroundVirtualizer_t(int, dsSurroundVirtualizer_t *) is defined and loaded\r\n");
             }
             else {
-                INT_INFO("dsGetSurroundVirtualizer_t(int, dsSurroundVirtualizer_t *) is not defined\r\n");
+                INT_INFO_RL("dsGetSurroundVirtualizer_t(int, dsSurroundVirtualizer_t *) is not defined\r\n");
             }
             dlclose(dllib);
         }
@@ -5205,7 +5406,7 @@ IARM_Result_t _dsGetMISteering(void *arg)
                 INT_DEBUG("dsGetMISteering_t(int, bool *) is defined and loaded\r\n");
             }
             else {
-                INT_INFO("dsGetMISteering_t(int, bool *) is not defined\r\n");
+                INT_INFO_RL("dsGetMISteering_t(int, bool *) is not defined\r\n");
             }
             dlclose(dllib);
         }
@@ -5348,7 +5549,7 @@ IARM_Result_t _dsGetGraphicEqualizerMode(void *arg)
                 INT_DEBUG("dsGetGraphicEqualizerMode_t(int, int *) is defined and loaded\r\n");
             }
             else {
-                INT_INFO("dsGetGraphicEqualizerMode_t(int, int *) is not defined\r\n");
+                INT_INFO_RL("dsGetGraphicEqualizerMode_t(int, int *) is not defined\r\n");
             }
             dlclose(dllib);
         }
@@ -5395,7 +5596,7 @@ IARM_Result_t _dsGetMS12AudioProfileList(void *arg)
                 INT_DEBUG("dsGetMS12AudioProfileList_t(int, dsMS12AudioProfileList_t*) is defined and loaded\r\n");
             }
             else {
-                INT_INFO("dsGetMS12AudioProfileList_t(int, dsMS12AudioProfileList_t*) is not defined\r\n");
+                INT_INFO_RL("dsGetMS12AudioProfileList_t(int, dsMS12AudioProfileList_t*) is not defined\r\n");
             }
             dlclose(dllib);
         }
@@ -5412,8 +5613,8 @@ IARM_Result_t _dsGetMS12AudioProfileList(void *arg)
 	ret = func(param->handle, &pList);
         if (ret == dsERR_NONE)
         {
-	    INT_INFO("%s: Total number of supported profiles: %d\n",__FUNCTION__, pList.audioProfileCount);
-	    INT_INFO("%s: Profile List: %s\n",__FUNCTION__, pList.audioProfileList);
+	    INT_INFO_RL("%s: Total number of supported profiles: %d\n",__FUNCTION__, pList.audioProfileCount);
+	    INT_INFO_RL("%s: Profile List: %s\n",__FUNCTION__, pList.audioProfileList);
 	    param->profileList.audioProfileCount = pList.audioProfileCount;
 	    strncpy(param->profileList.audioProfileList,pList.audioProfileList,MAX_PROFILE_LIST_BUFFER_LEN);
             result = IARM_RESULT_SUCCESS;
@@ -5445,7 +5646,7 @@ IARM_Result_t _dsGetMS12AudioProfile(void *arg)
                 INT_DEBUG("dsGetMS12AudioProfile_t(int, char* ) is defined and loaded\r\n");
             }
             else {
-                INT_INFO("dsGetMS12AudioProfile_t(int, char*) is not defined\r\n");
+                INT_INFO_RL("dsGetMS12AudioProfile_t(int, char*) is not defined\r\n");
             }
             dlclose(dllib);
         }
@@ -5565,7 +5766,7 @@ IARM_Result_t _dsSetAssociatedAudioMixing(void *arg)
             INT_INFO("%s: Associated Audio Mixing status changed :%d \r\n", __FUNCTION__, param->mixing);
             associated_audio_mixing_event_data.data.AssociatedAudioMixingInfo.mixing = param->mixing;
 
-            IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,
+            dsMgr_BroadcastEvent(
                                    (IARM_EventId_t)IARM_BUS_DSMGR_EVENT_AUDIO_ASSOCIATED_AUDIO_MIXING_CHANGED,
                                    (void *)&associated_audio_mixing_event_data,
                                    sizeof(associated_audio_mixing_event_data));
@@ -5598,7 +5799,7 @@ IARM_Result_t _dsGetAssociatedAudioMixing(void *arg)
                 INT_DEBUG("dsGetAssociatedAudioMixing_t(int, bool *) is defined and loaded\r\n");
             }
             else {
-                INT_INFO("dsGetAssociatedAudioMixing_t(int, bool *) is not defined\r\n");
+                INT_INFO_RL("dsGetAssociatedAudioMixing_t(int, bool *) is not defined\r\n");
             }
             dlclose(dllib);
         }
@@ -5668,7 +5869,7 @@ IARM_Result_t _dsSetFaderControl(void *arg)
             INT_INFO("%s: Fader Control changed :%d \r\n", __FUNCTION__, param->mixerbalance);
             fader_control_event_data.data.FaderControlInfo.mixerbalance = param->mixerbalance;
 
-            IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,
+            dsMgr_BroadcastEvent(
                                    (IARM_EventId_t)IARM_BUS_DSMGR_EVENT_AUDIO_FADER_CONTROL_CHANGED,
                                    (void *)&fader_control_event_data,
                                    sizeof(fader_control_event_data));
@@ -5704,7 +5905,7 @@ IARM_Result_t _dsGetFaderControl(void *arg)
                 INT_DEBUG("dsGetFaderControl_t(int, int *) is defined and loaded\r\n");
             }
             else {
-                INT_INFO("dsGetFaderControl_t(int, int *) is not defined\r\n");
+                INT_INFO_RL("dsGetFaderControl_t(int, int *) is not defined\r\n");
             }
             dlclose(dllib);
         }
@@ -5774,7 +5975,7 @@ IARM_Result_t _dsSetPrimaryLanguage(void *arg)
 	    memset(primary_language_event_data.data.AudioLanguageInfo.audioLanguage,'\0',MAX_LANGUAGE_LEN);
             strncpy(primary_language_event_data.data.AudioLanguageInfo.audioLanguage, param->primaryLanguage, MAX_LANGUAGE_LEN-1);
  
-            IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,
+            dsMgr_BroadcastEvent(
                                    (IARM_EventId_t)IARM_BUS_DSMGR_EVENT_AUDIO_PRIMARY_LANGUAGE_CHANGED,
                                    (void *)&primary_language_event_data,
                                    sizeof(primary_language_event_data));
@@ -5808,7 +6009,7 @@ IARM_Result_t _dsGetPrimaryLanguage(void *arg)
                 INT_DEBUG("dsGetPrimaryLanguage_t(int, char* ) is defined and loaded\r\n");
             }
             else {
-                INT_INFO("dsGetPrimaryLanguage_t(int, char*) is not defined\r\n");
+                INT_INFO_RL("dsGetPrimaryLanguage_t(int, char*) is not defined\r\n");
             }
             dlclose(dllib);
         }
@@ -5878,7 +6079,7 @@ IARM_Result_t _dsSetSecondaryLanguage(void *arg)
 	    memset(secondary_language_event_data.data.AudioLanguageInfo.audioLanguage,'\0',MAX_LANGUAGE_LEN);
             strncpy(secondary_language_event_data.data.AudioLanguageInfo.audioLanguage, param->secondaryLanguage, MAX_LANGUAGE_LEN-1);
 
-            IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,
+            dsMgr_BroadcastEvent(
                                    (IARM_EventId_t)IARM_BUS_DSMGR_EVENT_AUDIO_SECONDARY_LANGUAGE_CHANGED,
                                    (void *)&secondary_language_event_data,
                                    sizeof(secondary_language_event_data));
@@ -5912,7 +6113,7 @@ IARM_Result_t _dsGetSecondaryLanguage(void *arg)
                 INT_DEBUG("dsGetSecondaryLanguage_t(int, char* ) is defined and loaded\r\n");
             }
             else {
-                INT_INFO("dsGetSecondaryLanguage_t(int, char*) is not defined\r\n");
+                INT_INFO_RL("dsGetSecondaryLanguage_t(int, char*) is not defined\r\n");
             }
             dlclose(dllib);
         }
@@ -6108,7 +6309,7 @@ IARM_Result_t _dsGetSupportedARCTypes(void *arg)
                 INT_DEBUG("dsGetSupportedARCTypes_t(int, int*) is defined and loaded\r\n");
             }
             else {
-                INT_INFO("dsGetSupportedARCTypes_t(int, int*) is not defined\r\n");
+                INT_INFO_RL("dsGetSupportedARCTypes_t(int, int*) is not defined\r\n");
             }
             dlclose(dllib);
         }
@@ -6333,7 +6534,7 @@ IARM_Result_t _dsGetLEConfig(void *arg)
                 INT_DEBUG("dsGetLEConfig(int , bool *) is defined and loaded\r\n");
             }
             else {
-                INT_INFO("dsGetLEConfig(int , bool *) is not defined\r\n");
+                INT_INFO_RL("dsGetLEConfig(int , bool *) is not defined\r\n");
             }
             dlclose(dllib);
         }
@@ -6448,7 +6649,7 @@ IARM_Result_t _dsGetAudioCapabilities(void *arg)
                 INT_DEBUG("dsGetAudioCapabilities() is defined and loaded\r\n");
             }
             else {
-                INT_INFO("dsGetAudioCapabilities() is not defined\r\n");
+                INT_INFO_RL("dsGetAudioCapabilities() is not defined\r\n");
             }
             dlclose(dllib);
         }
@@ -6485,7 +6686,7 @@ IARM_Result_t _dsGetMS12Capabilities(void *arg)
                 INT_DEBUG("dsGetMS12Capabilities() is defined and loaded\r\n");
             }
             else {
-                INT_INFO("dsGetMS12Capabilities() is not defined\r\n");
+                INT_INFO_RL("dsGetMS12Capabilities() is not defined\r\n");
             }
             dlclose(dllib);
         }
@@ -6508,13 +6709,15 @@ IARM_Result_t _dsGetMS12Capabilities(void *arg)
 void _dsAudioOutPortConnectCB(dsAudioPortType_t portType, unsigned int uiPortNo, bool isPortConnected)
 {
     IARM_Bus_DSMgr_EventData_t audio_out_hpd_eventData;
+    dsEventTraceRecord(dsEVENT_TRACE_HAL_CALLBACK, IARM_BUS_DSMGR_EVENT_AUDIO_OUT_HOTPLUG, uiPortNo);
+
     INT_INFO("%s: AudioOutPort type:%d portNo:%d Hotplug happened\r\n", 
             __FUNCTION__, portType, uiPortNo);
     audio_out_hpd_eventData.data.audio_out_connect.portType = portType;
     audio_out_hpd_eventData.data.audio_out_connect.uiPortNo = uiPortNo;
     audio_out_hpd_eventData.data.audio_out_connect.isPortConnected = isPortConnected;
         
-    IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,
+    dsMgr_BroadcastEvent(
                            (IARM_EventId_t)IARM_BUS_DSMGR_EVENT_AUDIO_OUT_HOTPLUG,
                            (void *)&audio_out_hpd_eventData, 
                            sizeof(audio_out_hpd_eventData));
@@ -6616,10 +6819,12 @@ IARM_Result_t _dsAudioOutIsConnected (void *arg) {
 void _dsAudioFormatUpdateCB(dsAudioFormat_t audioFormat)
 {
     IARM_Bus_DSMgr_EventData_t audio_format_event_data;
+    dsEventTraceRecord(dsEVENT_TRACE_HAL_CALLBACK, IARM_BUS_DSMGR_EVENT_AUDIO_FORMAT_UPDATE, audioFormat);
+
     INT_INFO("%s: AudioOutPort format:%d \r\n", __FUNCTION__, audioFormat);
     audio_format_event_data.data.AudioFormatInfo.audioFormat = audioFormat;
 
-    IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,
+    dsMgr_BroadcastEvent(
                            (IARM_EventId_t)IARM_BUS_DSMGR_EVENT_AUDIO_FORMAT_UPDATE,
                            (void *)&audio_format_event_data,
                            sizeof(audio_format_event_data));
@@ -6665,11 +6870,13 @@ static dsError_t _dsAudioFormatUpdateRegisterCB (dsAudioFormatUpdateCB_t cbFun)
 void _dsAudioAtmosCapsChangeCB(dsATMOSCapability_t atmosCaps, bool status)
 {
     IARM_Bus_DSMgr_EventData_t atmos_caps_change_event_data;
+    dsEventTraceRecord(dsEVENT_TRACE_HAL_CALLBACK, IARM_BUS_DSMGR_EVENT_ATMOS_CAPS_CHANGED, atmosCaps);
+
     INT_INFO("%s: Atmos caps changed :%d \r\n", __FUNCTION__, atmosCaps);
     atmos_caps_change_event_data.data.AtmosCapsChange.caps = atmosCaps;
     atmos_caps_change_event_data.data.AtmosCapsChange.status = status;
 
-    IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,
+    dsMgr_BroadcastEvent(
                            (IARM_EventId_t)IARM_BUS_DSMGR_EVENT_ATMOS_CAPS_CHANGED,
                            (void *)&atmos_caps_change_event_data,
                            sizeof(atmos_caps_change_event_data));
@@ -6994,196 +7201,227 @@ static std::string _dsGenerateProfileProperty(std::string profile,std::string pr
    return profileProperty;
 }
 
-void _dsMS12ProfileSettingOverride(intptr_t handle)
+/* The MS12 settings a profile overrides, in the order they are applied */
+enum {
+    MS12_PROFILE_ENHANCER_LEVEL = 0,
+    MS12_PROFILE_BASS_BOOST,
+    MS12_PROFILE_VL_MODE,
+    MS12_PROFILE_VL_LEVEL,
+    MS12_PROFILE_SV_MODE,
+    MS12_PROFILE_SV_BOOST,
+    MS12_PROFILE_SETTINGS_MAX
+};
+
+/* Persistence keys of a profile, and its system defaults which do not change at runtime */
+typedef struct _dsMS12ProfileTable_t {
+    std::string key[MS12_PROFILE_SETTINGS_MAX];
+    std::string defValue[MS12_PROFILE_SETTINGS_MAX];    /* empty when the defaults have none */
+} dsMS12ProfileTable_t;
+
+static std::map<std::string, dsMS12ProfileTable_t> m_MS12ProfileTables;
+
+/* Built on the first switch to the profile of prefix ("audio.<profile>." or "audio.") */
+static const dsMS12ProfileTable_t &_dsMS12ProfileTable(const std::string &prefix)
 {
-    typedef dsError_t (*dsSetDialogEnhancement_t)(intptr_t handle, int enhancerLevel);
-    static dsSetDialogEnhancement_t dsSetDialogEnhancementfunc = 0;
-    if (dsSetDialogEnhancementfunc == 0) {
-       void *dllib = dlopen(RDK_DSHAL_NAME, RTLD_LAZY);
-       if (dllib) {
-          dsSetDialogEnhancementfunc = (dsSetDialogEnhancement_t) dlsym(dllib, "dsSetDialogEnhancement");
-          if (dsSetDialogEnhancementfunc) {
-             INT_DEBUG("dsSetDialogEnhancement_t(int, int) is defined and loaded\r\n");
-          }
-          else {
-             INT_INFO("dsSetDialogEnhancement_t(int, int ) is not defined\r\n");
-          }
-          dlclose(dllib);
-       }
-       else {
-          INT_ERROR("Opening RDK_DSHAL_NAME [%s] failed\r\n", RDK_DSHAL_NAME);
-       }
-    }
-
-    if (dsSetDialogEnhancementfunc) {
-       std::string _EnhancerLevel("0");
-       int m_enhancerLevel = 0;
-       std::string _Property = _dsGetCurrentProfileProperty("EnhancerLevel");
-       try {
-          _EnhancerLevel = device::HostPersistence::getInstance().getProperty(_Property);
-       }
-       catch(...) {
-            try {
-                INT_DEBUG("audio.EnhancerLevel not found in persistence store. Try system default\n");
-                _EnhancerLevel = device::HostPersistence::getInstance().getDefaultProperty(_Property);
-            }
-            catch(...) {
-                _EnhancerLevel = "0";
-            }
-       }
-       m_enhancerLevel = atoi(_EnhancerLevel.c_str());
-       if (dsSetDialogEnhancementfunc(handle, m_enhancerLevel) == dsERR_NONE) {
-           device::HostPersistence::getInstance().persistHostProperty(_Property ,_EnhancerLevel);
-           INT_INFO("%s: persist enhancer level: %d\n",__func__,m_enhancerLevel );
-       }
-    }
- 
-    typedef dsError_t (*dsSetBassEnhancer_t)(intptr_t handle, int boost);
-    static dsSetBassEnhancer_t dsSetBassEnhancerFunc = 0;
-    if (dsSetBassEnhancerFunc == 0) {
-        void *dllib = dlopen(RDK_DSHAL_NAME, RTLD_LAZY);
-        if (dllib) {
-            dsSetBassEnhancerFunc = (dsSetBassEnhancer_t) dlsym(dllib, "dsSetBassEnhancer");
-            if (dsSetBassEnhancerFunc) {
-                INT_DEBUG("dsSetBassEnhancer_t(int, int) is defined and loaded\r\n");
-            }
-            else {
-                INT_INFO("dsSetBassEnhancer_t(int, int) is not defined\r\n");
-            }
-            dlclose(dllib);
-        }
-        else {
-           INT_ERROR("Opening RDK_DSHAL_NAME [%s] failed\r\n", RDK_DSHAL_NAME);
-        }
-    }
-    if (dsSetBassEnhancerFunc != 0)
-    {
-        std::string _BassBoost("0");
-        int m_bassBoost = 0;
-        std::string _Property = _dsGetCurrentProfileProperty("BassBoost");
+    std::map<std::string, dsMS12ProfileTable_t>::iterator it = m_MS12ProfileTables.find(prefix);
+    if (it != m_MS12ProfileTables.end()) {
+        return it->second;
+    }
+
+    static const char *properties[MS12_PROFILE_SETTINGS_MAX] = {
+        "EnhancerLevel", "BassBoost", "VolumeLeveller.mode", "VolumeLeveller.level",
+        "SurroundVirtualizer.mode", "SurroundVirtualizer.boost"
+    };
+    dsMS12ProfileTable_t table;
+    for (int i = 0; i < MS12_PROFILE_SETTINGS_MAX; i++) {
+        std::string property = prefix + properties[i];
+        table.key[i] = property;
         try {
-            _BassBoost = device::HostPersistence::getInstance().getProperty("audio.BassBoost");
+            table.defValue[i] = device::HostPersistence::getInstance().getDefaultProperty(property);
         }
         catch(...) {
-            try {
-                INT_DEBUG("audio.EnhancerLevel not found in persistence store. Try system default\n");
-                _BassBoost = device::HostPersistence::getInstance().getDefaultProperty(_Property);
-            }
-            catch(...) {
-                _BassBoost = "0";
-            }
+            table.defValue[i] = "";
         }
-        m_bassBoost = atoi(_BassBoost.c_str());
-        if (dsSetBassEnhancerFunc(handle, m_bassBoost) == dsERR_NONE)
-        {
-            INT_INFO("%s: persist boost value: %d\n",__func__, m_bassBoost);
-            device::HostPersistence::getInstance().persistHostProperty("audio.BassBoost" ,_BassBoost);
+    }
+    /* The bass boost is not kept per profile, only its default is */
+    table.key[MS12_PROFILE_BASS_BOOST] = "audio.BassBoost";
+    INT_INFO("%s: settings table of %s built\n", __func__, prefix.c_str());
+    return m_MS12ProfileTables.insert(std::make_pair(prefix, table)).first->second;
+}
+
+/* User values of settings first to first + count - 1, else all their defaults, else all "0" */
+static void _dsMS12ProfileValues(const dsMS12ProfileTable_t &table, int first, int count, std::string *values)
+{
+    try {
+        for (int i = 0; i < count; i++) {
+            values[i] = device::HostPersistence::getInstance().getProperty(table.key[first + i]);
         }
+        return;
     }
+    catch(...) {
+    }
+    bool haveDefaults = true;
+    for (int i = 0; i < count; i++) {
+        haveDefaults = haveDefaults && !table.defValue[first + i].empty();
+    }
+    for (int i = 0; i < count; i++) {
+        values[i] = haveDefaults ? table.defValue[first + i] : std::string("0");
+    }
+}
 
-    typedef dsError_t (*dsSetVolumeLeveller_t)(intptr_t handle, dsVolumeLeveller_t volLeveller);
-    static dsSetVolumeLeveller_t dsSetVolumeLevellerfunc = 0;
-    if (dsSetVolumeLevellerfunc == 0) {
-        void *dllib = dlopen(RDK_DSHAL_NAME, RTLD_LAZY);
-        if (dllib) {
-            dsSetVolumeLevellerfunc = (dsSetVolumeLeveller_t) dlsym(dllib, "dsSetVolumeLeveller");
-            if (dsSetVolumeLevellerfunc) {
-                INT_DEBUG("dsSetVolumeLeveller_t(int, dsVolumeLeveller_t) is defined and loaded\r\n");
+typedef dsError_t (*dsSetDialogEnhancement_t)(intptr_t handle, int enhancerLevel);
+typedef dsError_t (*dsGetDialogEnhancement_t)(intptr_t handle, int *enhancerLevel);
+typedef dsError_t (*dsSetBassEnhancer_t)(intptr_t handle, int boost);
+typedef dsError_t (*dsGetBassEnhancer_t)(intptr_t handle, int *boost);
+typedef dsError_t (*dsSetVolumeLeveller_t)(intptr_t handle, dsVolumeLeveller_t volLeveller);
+typedef dsError_t (*dsGetVolumeLeveller_t)(intptr_t handle, dsVolumeLeveller_t *volLeveller);
+typedef dsError_t (*dsSetSurroundVirtualizer_t)(intptr_t handle, dsSurroundVirtualizer_t virtualizer);
+typedef dsError_t (*dsGetSurroundVirtualizer_t)(intptr_t handle, dsSurroundVirtualizer_t *virtualizer);
+
+static struct {
+    bool loaded;
+    dsSetDialogEnhancement_t setDialogEnhancement;
+    dsGetDialogEnhancement_t getDialogEnhancement;
+    dsSetBassEnhancer_t setBassEnhancer;
+    dsGetBassEnhancer_t getBassEnhancer;
+    dsSetVolumeLeveller_t setVolumeLeveller;
+    dsGetVolumeLeveller_t getVolumeLeveller;
+    dsSetSurroundVirtualizer_t setSurroundVirtualizer;
+    dsGetSurroundVirtualizer_t getSurroundVirtualizer;
+} m_MS12ProfileHal;
+
+/* Resolve the HAL calls of the profile settings once, whether they exist or not */
+static void _dsMS12ProfileLoadHal(void)
+{
+    if (m_MS12ProfileHal.loaded) {
+        return;
+    }
+    m_MS12ProfileHal.loaded = true;
+    void *dllib = dlopen(RDK_DSHAL_NAME, RTLD_LAZY);
+    if (!dllib) {
+        INT_ERROR("Opening RDK_DSHAL_NAME [%s] failed\r\n", RDK_DSHAL_NAME);
+        return;
+    }
+    m_MS12ProfileHal.setDialogEnhancement = (dsSetDialogEnhancement_t) dlsym(dllib, "dsSetDialogEnhancement");
+    m_MS12ProfileHal.getDialogEnhancement = (dsGetDialogEnhancement_t) dlsym(dllib, "dsGetDialogEnhancement");
+    m_MS12ProfileHal.setBassEnhancer = (dsSetBassEnhancer_t) dlsym(dllib, "dsSetBassEnhancer");
+    m_MS12ProfileHal.getBassEnhancer = (dsGetBassEnhancer_t) dlsym(dllib, "dsGetBassEnhancer");
+    m_MS12ProfileHal.setVolumeLeveller = (dsSetVolumeLeveller_t) dlsym(dllib, "dsSetVolumeLeveller");
+    m_MS12ProfileHal.getVolumeLeveller = (dsGetVolumeLeveller_t) dlsym(dllib, "dsGetVolumeLeveller");
+    m_MS12ProfileHal.setSurroundVirtualizer = (dsSetSurroundVirtualizer_t) dlsym(dllib, "dsSetSurroundVirtualizer");
+    m_MS12ProfileHal.getSurroundVirtualizer = (dsGetSurroundVirtualizer_t) dlsym(dllib, "dsGetSurroundVirtualizer");
+    INT_INFO("%s: set/get dialog enhancement %d/%d, bass enhancer %d/%d, volume leveller %d/%d, surround virtualizer %d/%d\r\n", __func__,
+             (0 != m_MS12ProfileHal.setDialogEnhancement), (0 != m_MS12ProfileHal.getDialogEnhancement),
+             (0 != m_MS12ProfileHal.setBassEnhancer), (0 != m_MS12ProfileHal.getBassEnhancer),
+             (0 != m_MS12ProfileHal.setVolumeLeveller), (0 != m_MS12ProfileHal.getVolumeLeveller),
+             (0 != m_MS12ProfileHal.setSurroundVirtualizer), (0 != m_MS12ProfileHal.getSurroundVirtualizer));
+    dlclose(dllib);
+}
+
+/*
+ * Apply the settings of the current profile that differ from what the HAL
+ * reports, and persist them with one write. A setting the HAL cannot report
+ * is always applied.
+ */
+void _dsMS12ProfileSettingOverride(intptr_t handle)
+{
+    uint64_t start = dsPerfNowUs();
+    int applied = 0;
+    int unchanged = 0;
+    std::map<std::string, std::string> toPersist;
+    std::string values[MS12_PROFILE_SETTINGS_MAX];
+
+    _dsMS12ProfileLoadHal();
+    const dsMS12ProfileTable_t &table = _dsMS12ProfileTable(_dsGetCurrentProfileProperty(""));
+    _dsMS12ProfileValues(table, MS12_PROFILE_ENHANCER_LEVEL, 1, &values[MS12_PROFILE_ENHANCER_LEVEL]);
+    _dsMS12ProfileValues(table, MS12_PROFILE_BASS_BOOST, 1, &values[MS12_PROFILE_BASS_BOOST]);
+    _dsMS12ProfileValues(table, MS12_PROFILE_VL_MODE, 2, &values[MS12_PROFILE_VL_MODE]);
+    _dsMS12ProfileValues(table, MS12_PROFILE_SV_MODE, 2, &values[MS12_PROFILE_SV_MODE]);
+
+    if (m_MS12ProfileHal.setDialogEnhancement) {
+        int enhancerLevel = atoi(values[MS12_PROFILE_ENHANCER_LEVEL].c_str());
+        int current = 0;
+        bool same = m_MS12ProfileHal.getDialogEnhancement &&
+                    (m_MS12ProfileHal.getDialogEnhancement(handle, &current) == dsERR_NONE) && (current == enhancerLevel);
+        if (same || (m_MS12ProfileHal.setDialogEnhancement(handle, enhancerLevel) == dsERR_NONE)) {
+            if (same) {
+                unchanged++;
             }
             else {
-                INT_INFO("dsSetVolumeLeveller_t(int, dsVolumeLeveller_t) is not defined\r\n");
+                applied++;
             }
-            dlclose(dllib);
-        }
-        else {
-              INT_ERROR("Opening RDK_DSHAL_NAME [%s] failed\r\n", RDK_DSHAL_NAME);
+            INT_INFO("%s: persist enhancer level: %d\n",__func__, enhancerLevel);
+            toPersist[table.key[MS12_PROFILE_ENHANCER_LEVEL]] = values[MS12_PROFILE_ENHANCER_LEVEL];
         }
     }
 
-    if (dsSetVolumeLevellerfunc != 0 )
-    {
-        std::string _volLevellerMode("0");
-        std::string _volLevellerLevel("0");
-        dsVolumeLeveller_t m_volumeLeveller;
-        std::string _PropertyMode = _dsGetCurrentProfileProperty("VolumeLeveller.mode");
-        std::string _PropertyLevel = _dsGetCurrentProfileProperty("VolumeLeveller.level");
-        try {
-            _volLevellerMode = device::HostPersistence::getInstance().getProperty(_PropertyMode);
-            _volLevellerLevel = device::HostPersistence::getInstance().getProperty(_PropertyLevel);
-        }
-        catch(...) {
-            try {
-                _volLevellerMode = device::HostPersistence::getInstance().getDefaultProperty(_PropertyMode);
-                _volLevellerLevel = device::HostPersistence::getInstance().getDefaultProperty(_PropertyLevel);
+    if (m_MS12ProfileHal.setBassEnhancer) {
+        int bassBoost = atoi(values[MS12_PROFILE_BASS_BOOST].c_str());
+        int current = 0;
+        bool same = m_MS12ProfileHal.getBassEnhancer &&
+                    (m_MS12ProfileHal.getBassEnhancer(handle, &current) == dsERR_NONE) && (current == bassBoost);
+        if (same || (m_MS12ProfileHal.setBassEnhancer(handle, bassBoost) == dsERR_NONE)) {
+            if (same) {
+                unchanged++;
             }
-            catch(...) {
-                _volLevellerMode = "0";
-                _volLevellerLevel = "0";
+            else {
+                applied++;
             }
+            INT_INFO("%s: persist boost value: %d\n",__func__, bassBoost);
+            toPersist[table.key[MS12_PROFILE_BASS_BOOST]] = values[MS12_PROFILE_BASS_BOOST];
         }
-        m_volumeLeveller.mode = atoi(_volLevellerMode.c_str());
-        m_volumeLeveller.level = atoi(_volLevellerLevel.c_str());
-        if (dsSetVolumeLevellerfunc(handle, m_volumeLeveller) == dsERR_NONE)
-        {
-            INT_INFO("%s: persist volume leveller mode: %d\n",__func__, m_volumeLeveller.mode);
-            device::HostPersistence::getInstance().persistHostProperty(_PropertyMode,_volLevellerMode);
-            INT_INFO("%s: persist volume leveller value: %d\n",__func__, m_volumeLeveller.level);
-            device::HostPersistence::getInstance().persistHostProperty(_PropertyLevel,_volLevellerLevel);
-        }
-    }   
-    
-    typedef dsError_t (*dsSetSurroundVirtualizer_t)(intptr_t handle, dsSurroundVirtualizer_t virtualizer);
-    static dsSetSurroundVirtualizer_t dsSetSurroundVirtualizerfunc = 0;
-    if (dsSetSurroundVirtualizerfunc == 0) {
-        void *dllib = dlopen(RDK_DSHAL_NAME, RTLD_LAZY);
-        if (dllib) {
-        dsSetSurroundVirtualizerfunc = (dsSetSurroundVirtualizer_t) dlsym(dllib, "dsSetSurroundVirtualizer");
-            if (dsSetSurroundVirtualizerfunc) {
-                INT_DEBUG("dsSetSurroundVirtualizer_t(int, dsSurroundVirtualizer_t) is defined and loaded\r\n");
+    }
+
+    if (m_MS12ProfileHal.setVolumeLeveller) {
+        dsVolumeLeveller_t volumeLeveller;
+        volumeLeveller.mode = atoi(values[MS12_PROFILE_VL_MODE].c_str());
+        volumeLeveller.level = atoi(values[MS12_PROFILE_VL_LEVEL].c_str());
+        dsVolumeLeveller_t current;
+        bool same = m_MS12ProfileHal.getVolumeLeveller &&
+                    (m_MS12ProfileHal.getVolumeLeveller(handle, &current) == dsERR_NONE) &&
+                    (current.mode == volumeLeveller.mode) && (current.level == volumeLeveller.level);
+        if (same || (m_MS12ProfileHal.setVolumeLeveller(handle, volumeLeveller) == dsERR_NONE)) {
+            if (same) {
+                unchanged++;
             }
             else {
-                INT_INFO("dsSetSurroundVirtualizer_t(int, dsSurroundVirtualizer_t) is not defined\r\n");
+                applied++;
             }
-            dlclose(dllib);
-        }
-        else {
-              INT_ERROR("Opening RDK_DSHAL_NAME [%s] failed\r\n", RDK_DSHAL_NAME);
+            INT_INFO("%s: persist volume leveller mode: %d value: %d\n",__func__, volumeLeveller.mode, volumeLeveller.level);
+            toPersist[table.key[MS12_PROFILE_VL_MODE]] = values[MS12_PROFILE_VL_MODE];
+            toPersist[table.key[MS12_PROFILE_VL_LEVEL]] = values[MS12_PROFILE_VL_LEVEL];
         }
     }
 
-    if (dsSetSurroundVirtualizerfunc != 0 )
-    {
-        std::string _SVMode("0");
-        std::string _SVBoost("0");
-        dsSurroundVirtualizer_t m_virtualizer;
-        std::string _PropertyMode = _dsGetCurrentProfileProperty("SurroundVirtualizer.mode");
-        std::string _PropertyBoost = _dsGetCurrentProfileProperty("SurroundVirtualizer.boost");
-        try {
-            _SVMode = device::HostPersistence::getInstance().getProperty(_PropertyMode);
-            _SVBoost = device::HostPersistence::getInstance().getProperty(_PropertyBoost);
-        }
-        catch(...) {
-            try {
-                _SVMode = device::HostPersistence::getInstance().getDefaultProperty(_PropertyMode);
-                _SVBoost = device::HostPersistence::getInstance().getDefaultProperty(_PropertyBoost);
+    if (m_MS12ProfileHal.setSurroundVirtualizer) {
+        dsSurroundVirtualizer_t virtualizer;
+        virtualizer.mode = atoi(values[MS12_PROFILE_SV_MODE].c_str());
+        virtualizer.boost = atoi(values[MS12_PROFILE_SV_BOOST].c_str());
+        dsSurroundVirtualizer_t current;
+        bool same = m_MS12ProfileHal.getSurroundVirtualizer &&
+                    (m_MS12ProfileHal.getSurroundVirtualizer(handle, &current) == dsERR_NONE) &&
+                    (current.mode == virtualizer.mode) && (current.boost == virtualizer.boost);
+        if (same || (m_MS12ProfileHal.setSurroundVirtualizer(handle, virtualizer) == dsERR_NONE)) {
+            if (same) {
+                unchanged++;
             }
-            catch(...) {
-                _SVMode = "0";
-                _SVBoost = "0";
+            else {
+                applied++;
             }
+            INT_INFO("%s: persist surround virtualizer mode: %d boost value: %d\n",__func__, virtualizer.mode, virtualizer.boost);
+            toPersist[table.key[MS12_PROFILE_SV_MODE]] = values[MS12_PROFILE_SV_MODE];
+            toPersist[table.key[MS12_PROFILE_SV_BOOST]] = values[MS12_PROFILE_SV_BOOST];
         }
-        m_virtualizer.mode = atoi(_SVMode.c_str());
-        m_virtualizer.boost = atoi(_SVBoost.c_str());
+    }
 
-        if (dsSetSurroundVirtualizerfunc(handle,m_virtualizer) == dsERR_NONE)
-        {
-            INT_INFO("%s: persist surround virtualizer mode: %d\n",__func__, m_virtualizer.mode);
-            device::HostPersistence::getInstance().persistHostProperty(_PropertyMode,_SVMode);
-            INT_INFO("%s: persist surround virtualizer boost value: %d\n",__func__, m_virtualizer.boost);
-            device::HostPersistence::getInstance().persistHostProperty(_PropertyBoost,_SVBoost);
- 
-        }
+    try {
+        device::HostPersistence::getInstance().persistHostProperties(toPersist);
+    }
+    catch(...) {
+        INT_ERROR("%s: persisting the profile settings failed\n", __func__);
     }
+    INT_INFO("%s: %d settings applied, %d already set, in %llu us\n", __func__, applied, unchanged,
+             (unsigned long long)(dsPerfNowUs() - start));
 }
 
 bool _dsMs12ProfileSupported(intptr_t handle,std::string profile)
@@ -0,0 +1,146 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2025 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+
+/**
+* @defgroup devicesettings
+* @{
+* @defgroup rpc
+* @{
+**/
+
+
+#include <string.h>
+#include "dsAudioDucking.h"
+#include "dsserverlogger.h"
+
+typedef struct _dsAudioDuckingRequest_t {
+    intptr_t handle;
+    unsigned int source;
+    int priority;
+    dsAudioDuckingType_t type;
+    unsigned char level;
+} dsAudioDuckingRequest_t;
+
+/* The stacks of all ports, ordered by priority, then by age: the last entry of a port decides */
+static dsAudioDuckingRequest_t duckingStack[DS_AUDIO_DUCKING_REQUESTS_MAX];
+static int duckingCount = 0;
+
+static void _dsAudioDuckingRemove(int index)
+{
+    memmove(&duckingStack[index], &duckingStack[index + 1], (duckingCount - index - 1) * sizeof(duckingStack[0]));
+    duckingCount--;
+}
+
+static int _dsAudioDuckingFind(intptr_t handle, unsigned int source)
+{
+    for (int i = 0; i < duckingCount; i++) {
+        if ((duckingStack[i].handle == handle) && (duckingStack[i].source == source)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static int _dsAudioDuckingSources(intptr_t handle)
+{
+    int sources = 0;
+    for (int i = 0; i < duckingCount; i++) {
+        sources += (duckingStack[i].handle == handle) ? 1 : 0;
+    }
+    return sources;
+}
+
+dsError_t dsAudioDuckingPush(intptr_t handle, unsigned int source, int priority, dsAudioDuckingType_t type, unsigned char level)
+{
+    if (level > 100) {
+        return dsERR_INVALID_PARAM;
+    }
+    int index = _dsAudioDuckingFind(handle, source);
+    if (index >= 0) {
+        _dsAudioDuckingRemove(index);
+    }
+    int sources = _dsAudioDuckingSources(handle);
+    if (sources == DS_AUDIO_DUCKING_SOURCES_MAX) {
+        INT_ERROR("[%s]: %d sources already ducking port %ld, source %u ignored\r\n", __FUNCTION__, sources,
+                  (long)handle, source);
+        return dsERR_RESOURCE_NOT_AVAILABLE;
+    }
+    if (duckingCount == DS_AUDIO_DUCKING_REQUESTS_MAX) {
+        INT_ERROR("[%s]: %d requests already active, source %u on port %ld ignored\r\n", __FUNCTION__, duckingCount,
+                  source, (long)handle);
+        return dsERR_RESOURCE_NOT_AVAILABLE;
+    }
+
+    /* Above every request of the same or lower priority */
+    index = duckingCount;
+    while ((index > 0) && (duckingStack[index - 1].priority > priority)) {
+        index--;
+    }
+    memmove(&duckingStack[index + 1], &duckingStack[index], (duckingCount - index) * sizeof(duckingStack[0]));
+    duckingStack[index].handle = handle;
+    duckingStack[index].source = source;
+    duckingStack[index].priority = priority;
+    duckingStack[index].type = type;
+    duckingStack[index].level = level;
+    duckingCount++;
+    INT_INFO("[%s]: port %ld source %u priority %d %s %u, %d sources ducking the port\r\n", __FUNCTION__,
+             (long)handle, source, priority, (type == dsAUDIO_DUCKINGTYPE_RELATIVE) ? "relative" : "absolute",
+             level, sources + 1);
+    return dsERR_NONE;
+}
+
+bool dsAudioDuckingPop(intptr_t handle, unsigned int source)
+{
+    int index = _dsAudioDuckingFind(handle, source);
+    if (index < 0) {
+        return false;
+    }
+    _dsAudioDuckingRemove(index);
+    INT_INFO("[%s]: port %ld source %u, %d sources ducking the port\r\n", __FUNCTION__, (long)handle, source,
+             _dsAudioDuckingSources(handle));
+    return true;
+}
+
+bool dsAudioDuckingActive(intptr_t handle)
+{
+    return (_dsAudioDuckingSources(handle) > 0);
+}
+
+int dsAudioDuckingLevel(intptr_t handle, float volume)
+{
+    const dsAudioDuckingRequest_t *top = NULL;
+    for (int i = duckingCount - 1; (i >= 0) && (NULL == top); i--) {
+        if (duckingStack[i].handle == handle) {
+            top = &duckingStack[i];
+        }
+    }
+    if (NULL == top) {
+        return (int)volume;
+    }
+    if (top->type == dsAUDIO_DUCKINGTYPE_RELATIVE) {
+        return (int)((volume * top->level) / 100);
+    }
+    /* Ducking never raises the level */
+    return (top->level > volume) ? (int)volume : top->level;
+}
+
+
+/** @} */
+/** @} */
@@ -0,0 +1,344 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2025 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+
+/**
+* @defgroup devicesettings
+* @{
+* @defgroup rpc
+* @{
+**/
+
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <math.h>
+#include <pthread.h>
+#include <time.h>
+#include "dsAudioRamp.h"
+#include "dsserverlogger.h"
+
+/* Floor of dsAUDIO_RAMP_CURVE_EXPONENTIAL, in level percent (-40 dB) */
+#define DS_AUDIO_RAMP_EXP_FLOOR     1.0f
+
+typedef struct _dsAudioRamp_t {
+    bool used;                  /* handle and channel are set; id tells whether the ramp is current */
+    bool active;                /* steps remain to be delivered */
+    bool delivering;            /* the last step is being delivered, keep the slot */
+    intptr_t handle;
+    int channel;
+    unsigned int id;            /* 0 once cancelled */
+    float from;
+    float to;
+    unsigned long long startMs;
+    unsigned int durationMs;
+    dsAudioRampCurve_t curve;
+    dsAudioRampApplyFn apply;
+} dsAudioRamp_t;
+
+typedef struct _dsAudioRampStep_t {
+    dsAudioRampApplyFn apply;
+    intptr_t handle;
+    int channel;
+    unsigned int id;
+    float level;
+    bool last;
+    int slot;
+} dsAudioRampStep_t;
+
+static pthread_mutex_t rampLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t rampCond;
+static pthread_t rampThread;
+static bool rampThreadRunning = false;
+static bool rampStopping = false;
+static unsigned int rampNextId = 1;
+static dsAudioRamp_t ramps[DS_AUDIO_RAMP_MAX];
+
+static unsigned long long _dsAudioRampNowMs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+float dsAudioRampLevelAt(dsAudioRampCurve_t curve, float from, float to, float t)
+{
+    if (t <= 0.0f) {
+        return from;
+    }
+    if (t >= 1.0f) {
+        return to;
+    }
+    switch (curve) {
+        case dsAUDIO_RAMP_CURVE_EASE_IN_OUT:
+            t = t * t * (3.0f - 2.0f * t);
+            return from + (to - from) * t;
+        case dsAUDIO_RAMP_CURVE_EXPONENTIAL: {
+            float fromDb = 20.0f * log10f(((from > DS_AUDIO_RAMP_EXP_FLOOR) ? from : DS_AUDIO_RAMP_EXP_FLOOR) / 100.0f);
+            float toDb = 20.0f * log10f(((to > DS_AUDIO_RAMP_EXP_FLOOR) ? to : DS_AUDIO_RAMP_EXP_FLOOR) / 100.0f);
+            return 100.0f * powf(10.0f, (fromDb + (toDb - fromDb) * t) / 20.0f);
+        }
+        case dsAUDIO_RAMP_CURVE_LINEAR:
+        default:
+            return from + (to - from) * t;
+    }
+}
+
+/* Collects the steps due now. Called with rampLock held. */
+static int _dsAudioRampCollect(dsAudioRampStep_t *steps, bool *anyActive)
+{
+    unsigned long long now = _dsAudioRampNowMs();
+    int count = 0;
+    *anyActive = false;
+
+    for (int i = 0; i < DS_AUDIO_RAMP_MAX; i++) {
+        dsAudioRamp_t *ramp = &ramps[i];
+        if (!ramp->active) {
+            continue;
+        }
+        unsigned long long elapsed = now - ramp->startMs;
+        bool last = (elapsed >= ramp->durationMs);
+        float t = last ? 1.0f : (float)elapsed / (float)ramp->durationMs;
+
+        dsAudioRampStep_t *step = &steps[count++];
+        step->apply = ramp->apply;
+        step->handle = ramp->handle;
+        step->channel = ramp->channel;
+        step->id = ramp->id;
+        step->level = dsAudioRampLevelAt(ramp->curve, ramp->from, ramp->to, t);
+        step->last = last;
+        step->slot = i;
+        if (last) {
+            ramp->active = false;
+            ramp->delivering = true;
+        } else {
+            *anyActive = true;
+        }
+    }
+    return count;
+}
+
+static void *_dsAudioRampThread(void *arg)
+{
+    (void)arg;
+    dsAudioRampStep_t steps[DS_AUDIO_RAMP_MAX];
+    struct timespec next;
+    clock_gettime(CLOCK_MONOTONIC, &next);
+
+    pthread_mutex_lock(&rampLock);
+    while (!rampStopping) {
+        bool anyActive = false;
+        int count = _dsAudioRampCollect(steps, &anyActive);
+        pthread_mutex_unlock(&rampLock);
+
+        for (int i = 0; i < count; i++) {
+            steps[i].apply(steps[i].handle, steps[i].channel, steps[i].id, steps[i].level, steps[i].last);
+        }
+
+        pthread_mutex_lock(&rampLock);
+        for (int i = 0; i < count; i++) {
+            if (steps[i].last) {
+                ramps[steps[i].slot].delivering = false;
+            }
+        }
+        if (!anyActive) {
+            /* Idle until the next ramp starts */
+            bool idle = true;
+            for (int i = 0; i < DS_AUDIO_RAMP_MAX; i++) {
+                idle = idle && !ramps[i].active;
+            }
+            while (idle && !rampStopping) {
+                pthread_cond_wait(&rampCond, &rampLock);
+                for (int i = 0; i < DS_AUDIO_RAMP_MAX; i++) {
+                    idle = idle && !ramps[i].active;
+                }
+            }
+            clock_gettime(CLOCK_MONOTONIC, &next);
+            continue;
+        }
+
+        next.tv_nsec += DS_AUDIO_RAMP_TICK_MS * 1000000L;
+        if (next.tv_nsec >= 1000000000L) {
+            next.tv_sec++;
+            next.tv_nsec -= 1000000000L;
+        }
+        int rc = 0;
+        while (!rampStopping && (ETIMEDOUT != rc)) {
+            rc = pthread_cond_timedwait(&rampCond, &rampLock, &next);
+        }
+    }
+    pthread_mutex_unlock(&rampLock);
+    return NULL;
+}
+
+/* Called with rampLock held */
+static bool _dsAudioRampStartThread(void)
+{
+    if (rampThreadRunning) {
+        return true;
+    }
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&rampCond, &attr);
+    pthread_condattr_destroy(&attr);
+
+    rampStopping = false;
+    if (0 != pthread_create(&rampThread, NULL, _dsAudioRampThread, NULL)) {
+        pthread_cond_destroy(&rampCond);
+        INT_ERROR("[%s]: cannot start the audio ramp thread\r\n", __FUNCTION__);
+        return false;
+    }
+    rampThreadRunning = true;
+    return true;
+}
+
+dsError_t dsAudioRampStart(intptr_t handle, int channel, float from, float to, unsigned int durationMs,
+                           dsAudioRampCurve_t curve, dsAudioRampApplyFn apply, unsigned int *id)
+{
+    if ((curve < dsAUDIO_RAMP_CURVE_LINEAR) || (curve >= dsAUDIO_RAMP_CURVE_MAX) ||
+        (durationMs > DS_AUDIO_RAMP_DURATION_MAX_MS) || (NULL == apply)) {
+        return dsERR_INVALID_PARAM;
+    }
+
+    pthread_mutex_lock(&rampLock);
+    /* The slot of handle and channel, else one that is no longer needed */
+    int slot = -1;
+    for (int i = 0; i < DS_AUDIO_RAMP_MAX; i++) {
+        if (ramps[i].used && (ramps[i].handle == handle) && (ramps[i].channel == channel)) {
+            slot = i;
+            break;
+        }
+        if ((slot < 0) && (!ramps[i].used || (!ramps[i].active && !ramps[i].delivering))) {
+            slot = i;
+        }
+    }
+    if ((slot < 0) || (ramps[slot].delivering && ((ramps[slot].handle != handle) || (ramps[slot].channel != channel)))) {
+        pthread_mutex_unlock(&rampLock);
+        INT_ERROR("[%s]: %d ramps already running\r\n", __FUNCTION__, DS_AUDIO_RAMP_MAX);
+        return dsERR_RESOURCE_NOT_AVAILABLE;
+    }
+    if (!_dsAudioRampStartThread()) {
+        pthread_mutex_unlock(&rampLock);
+        return dsERR_GENERAL;
+    }
+
+    dsAudioRamp_t *ramp = &ramps[slot];
+    ramp->used = true;
+    ramp->active = true;
+    ramp->handle = handle;
+    ramp->channel = channel;
+    ramp->id = rampNextId++;
+    if (0 == rampNextId) {
+        rampNextId = 1;
+    }
+    ramp->from = from;
+    ramp->to = to;
+    ramp->startMs = _dsAudioRampNowMs();
+    ramp->durationMs = durationMs;
+    ramp->curve = curve;
+    ramp->apply = apply;
+    if (id) {
+        *id = ramp->id;
+    }
+    pthread_cond_signal(&rampCond);
+    pthread_mutex_unlock(&rampLock);
+
+    INT_DEBUG("[%s]: handle %ld channel %d: %.1f -> %.1f in %u ms, curve %d\r\n", __FUNCTION__,
+              (long)handle, channel, from, to, durationMs, curve);
+    return dsERR_NONE;
+}
+
+bool dsAudioRampCancel(intptr_t handle, int channel, float *target)
+{
+    bool running = false;
+    pthread_mutex_lock(&rampLock);
+    for (int i = 0; i < DS_AUDIO_RAMP_MAX; i++) {
+        dsAudioRamp_t *ramp = &ramps[i];
+        if (ramp->used && (ramp->handle == handle) && (ramp->channel == channel)) {
+            /* A last step being delivered has not been applied yet either */
+            running = (ramp->active || ramp->delivering) && (0 != ramp->id);
+            if (running && target) {
+                *target = ramp->to;
+            }
+            ramp->active = false;
+            ramp->id = 0;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&rampLock);
+    return running;
+}
+
+bool dsAudioRampIsCurrent(intptr_t handle, int channel, unsigned int id)
+{
+    bool current = false;
+    pthread_mutex_lock(&rampLock);
+    for (int i = 0; i < DS_AUDIO_RAMP_MAX; i++) {
+        if (ramps[i].used && (ramps[i].handle == handle) && (ramps[i].channel == channel)) {
+            current = (0 != id) && (ramps[i].id == id);
+            break;
+        }
+    }
+    pthread_mutex_unlock(&rampLock);
+    return current;
+}
+
+void dsAudioRampDone(intptr_t handle, int channel, unsigned int id)
+{
+    pthread_mutex_lock(&rampLock);
+    for (int i = 0; i < DS_AUDIO_RAMP_MAX; i++) {
+        if (ramps[i].used && (ramps[i].handle == handle) && (ramps[i].channel == channel)) {
+            if ((0 != id) && (ramps[i].id == id)) {
+                ramps[i].delivering = false;
+                ramps[i].id = 0;
+            }
+            break;
+        }
+    }
+    pthread_mutex_unlock(&rampLock);
+}
+
+void dsAudioRampTerm(void)
+{
+    pthread_mutex_lock(&rampLock);
+    for (int i = 0; i < DS_AUDIO_RAMP_MAX; i++) {
+        ramps[i].active = false;
+        ramps[i].id = 0;
+    }
+    if (!rampThreadRunning) {
+        pthread_mutex_unlock(&rampLock);
+        return;
+    }
+    rampStopping = true;
+    pthread_cond_signal(&rampCond);
+    pthread_mutex_unlock(&rampLock);
+
+    pthread_join(rampThread, NULL);
+
+    pthread_mutex_lock(&rampLock);
+    pthread_cond_destroy(&rampCond);
+    rampThreadRunning = false;
+    pthread_mutex_unlock(&rampLock);
+}
+
+
+/** @} */
+/** @} */
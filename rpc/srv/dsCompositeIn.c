@@ -67,6 +67,8 @@
 #include "dsTypes.h"
 #include "dsserverlogger.h"
 #include "dsMgr.h"
+#include "dsPerfStats.h"
+#include "dsEventTrace.h"
 
 #include "iarmUtil.h"
 #include "libIARM.h"
@@ -75,8 +77,8 @@
 #include "dsInternal.h"
 
 #define direct_list_top(list) ((list))
-#define IARM_BUS_Lock(lock) pthread_mutex_lock(&fpLock)
-#define IARM_BUS_Unlock(lock) pthread_mutex_unlock(&fpLock)
+#define IARM_BUS_Lock(lock) dsPerfMutexLock(&fpLock)
+#define IARM_BUS_Unlock(lock) dsPerfMutexUnlock(&fpLock)
 
 static int m_isInitialized = 0;
 static int m_isPlatInitialized=0;
@@ -109,7 +111,7 @@ IARM_Result_t dsCompositeInMgr_init()
 {
 
     _dsCompositeInInit(NULL);
-    IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsCompositeInInit, _dsCompositeInInit);
+    dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsCompositeInInit, _dsCompositeInInit);
 
     return IARM_RESULT_SUCCESS;
 }
@@ -246,11 +248,11 @@ IARM_Result_t _dsCompositeInInit(void *arg)
 
         }//end of (PROFILE_TV == profileType)
 
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsCompositeInTerm,                  _dsCompositeInTerm);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsCompositeInGetNumberOfInputs,     _dsCompositeInGetNumberOfInputs);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsCompositeInGetStatus,             _dsCompositeInGetStatus);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsCompositeInSelectPort,            _dsCompositeInSelectPort);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsCompositeInScaleVideo,            _dsCompositeInScaleVideo);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsCompositeInTerm,                  _dsCompositeInTerm);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsCompositeInGetNumberOfInputs,     _dsCompositeInGetNumberOfInputs);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsCompositeInGetStatus,             _dsCompositeInGetStatus);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsCompositeInSelectPort,            _dsCompositeInSelectPort);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsCompositeInScaleVideo,            _dsCompositeInScaleVideo);
 
         m_isInitialized = 1;
     }//end of (!m_isInitialized)
@@ -479,12 +481,13 @@ IARM_Result_t _dsCompositeInScaleVideo(void *arg)
 void _dsCompositeInConnectCB(dsCompositeInPort_t port, bool isPortConnected)
 {
     IARM_Bus_DSMgr_EventData_t composite_in_hpd_eventData;
+    dsEventTraceRecord(dsEVENT_TRACE_HAL_CALLBACK, IARM_BUS_DSMGR_EVENT_COMPOSITE_IN_HOTPLUG, port);
 
     INT_INFO("%s:%d - COMPOSITE In hotplug update!!!!!!..%d, %d\r\n",__PRETTY_FUNCTION__,__LINE__, port, isPortConnected);
     composite_in_hpd_eventData.data.composite_in_connect.port = port;
     composite_in_hpd_eventData.data.composite_in_connect.isPortConnected = isPortConnected;
 
-    IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,
+    dsMgr_BroadcastEvent(
 	                        (IARM_EventId_t)IARM_BUS_DSMGR_EVENT_COMPOSITE_IN_HOTPLUG,
 	                        (void *)&composite_in_hpd_eventData,
 	                        sizeof(composite_in_hpd_eventData));
@@ -495,11 +498,13 @@ void _dsCompositeInConnectCB(dsCompositeInPort_t port, bool isPortConnected)
 void _dsCompositeInSignalChangeCB(dsCompositeInPort_t port, dsCompInSignalStatus_t sigStatus)
 {
     IARM_Bus_DSMgr_EventData_t composite_in_sigStatus_eventData;
+    dsEventTraceRecord(dsEVENT_TRACE_HAL_CALLBACK, IARM_BUS_DSMGR_EVENT_COMPOSITE_IN_SIGNAL_STATUS, port);
+
     INT_INFO("%s:%d Composite In signal change update!!!!!! Port: %d, Signal Status: %d\r\n", __PRETTY_FUNCTION__, __LINE__, port, sigStatus);
     composite_in_sigStatus_eventData.data.composite_in_sig_status.port = port;
     composite_in_sigStatus_eventData.data.composite_in_sig_status.status = sigStatus;
 
-    IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,
+    dsMgr_BroadcastEvent(
 			        (IARM_EventId_t)IARM_BUS_DSMGR_EVENT_COMPOSITE_IN_SIGNAL_STATUS,
 			        (void *)&composite_in_sigStatus_eventData,
 			        sizeof(composite_in_sigStatus_eventData));
@@ -510,11 +515,13 @@ void _dsCompositeInSignalChangeCB(dsCompositeInPort_t port, dsCompInSignalStatus
 void _dsCompositeInStatusChangeCB(dsCompositeInStatus_t inputStatus)
 {
     IARM_Bus_DSMgr_EventData_t hdmi_in_status_eventData;
+    dsEventTraceRecord(dsEVENT_TRACE_HAL_CALLBACK, IARM_BUS_DSMGR_EVENT_COMPOSITE_IN_STATUS, inputStatus.activePort);
+
     INT_INFO("%s:%d Composite In status change update!!!!!! Port: %d, isPresented: %d\r\n", __PRETTY_FUNCTION__, __LINE__, inputStatus.activePort, inputStatus.isPresented);
     hdmi_in_status_eventData.data.composite_in_status.port = inputStatus.activePort;
     hdmi_in_status_eventData.data.composite_in_status.isPresented = inputStatus.isPresented;
 
-    IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,
+    dsMgr_BroadcastEvent(
                                 (IARM_EventId_t)IARM_BUS_DSMGR_EVENT_COMPOSITE_IN_STATUS,
                                 (void *)&hdmi_in_status_eventData,
                                 sizeof(hdmi_in_status_eventData));
@@ -525,12 +532,14 @@ void _dsCompositeInStatusChangeCB(dsCompositeInStatus_t inputStatus)
 void _dsCompositeInVideoModeUpdateCB(dsCompositeInPort_t port, dsVideoPortResolution_t videoResolution)
 {
     IARM_Bus_DSMgr_EventData_t composite_in_videoMode_eventData;
+    dsEventTraceRecord(dsEVENT_TRACE_HAL_CALLBACK, IARM_BUS_DSMGR_EVENT_COMPOSITE_IN_VIDEO_MODE_UPDATE, port);
+
     INT_INFO("%s:%d - Composite In video mode info  update, Port: %d, Pixel Resolution: %d, Interlaced: %d, Frame Rate: %d \n", __PRETTY_FUNCTION__,__LINE__,port, videoResolution.pixelResolution, videoResolution.interlaced, videoResolution.frameRate);
     composite_in_videoMode_eventData.data.composite_in_video_mode.port = port;
     composite_in_videoMode_eventData.data.composite_in_video_mode.resolution.pixelResolution = videoResolution.pixelResolution;
     composite_in_videoMode_eventData.data.composite_in_video_mode.resolution.interlaced = videoResolution.interlaced;
     composite_in_videoMode_eventData.data.composite_in_video_mode.resolution.frameRate = videoResolution.frameRate;
-    IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,
+    dsMgr_BroadcastEvent(
                                 (IARM_EventId_t)IARM_BUS_DSMGR_EVENT_COMPOSITE_IN_VIDEO_MODE_UPDATE,
                                 (void *)&composite_in_videoMode_eventData,
                                 sizeof(composite_in_videoMode_eventData));
@@ -27,6 +27,8 @@
 **/
 
 
+#define DS_LOG_MODULE dsLOG_MODULE_DISPLAY
+
 #include "dsDisplay.h"
 #include "dsTelemetry.h"
 
@@ -35,6 +37,9 @@
 #include <string.h>
 #include <stdlib.h>
 #include <dlfcn.h>
+#include <unistd.h>
+#include <errno.h>
+#include <time.h>
 #include "dsError.h"
 #include "dsUtl.h"
 #include "dsTypes.h"
@@ -45,6 +50,9 @@
 #include "iarmUtil.h"
 #include "dsRpc.h"
 #include "dsMgr.h"
+#include "dsPerfStats.h"
+#include "dsEventTrace.h"
+#include "dsEdidCache.h"
 #include "dsserverlogger.h"
 #include "dsVideoPort.h"
 #include "dsVideoPortConfig.h"
@@ -57,17 +65,37 @@ static int m_isInitialized = 0;
 static int m_isPlatInitialized = 0;
 static bool isEdidCached = false;
 static bool isEdidBytesCached = false;
+static bool edidBytesUnsupported = false;       /* HAL has no dsGetEDIDBytes, EDIDs cannot be verified */
+static unsigned char edidBytes[1024] = {0};
+static int edidBytesLength = 0;
+static dsEdidCache<dsDisplayEDID_t> edidCache;   /* filtered EDID of recently connected displays */
+static dsDisplayEDID_t edidInfo;                 /* EDID returned by _dsGetEDID while isEdidCached */
+static dsDisplayEDID_t edidFilterScratch;        /* unfiltered copy used by filterEDIDResolution, lock held */
+static unsigned int edidGeneration = 0;          /* bumped on every HDMI hotplug */
+static intptr_t edidDisplayHandle = 0;
+
+#define DS_EDID_PROBE_INTERVAL_MS   50
+#define DS_EDID_PROBE_TIMEOUT_MS    5000
 static pthread_mutex_t dsLock = PTHREAD_MUTEX_INITIALIZER;
 
+/* EDID probe thread state, edidProbeLock is never taken before dsLock */
+static pthread_mutex_t edidProbeLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t edidProbeCond;
+static pthread_t edidProbeThread;
+static bool edidProbeRunning = false;
+static bool edidProbePending = false;           /* a hotplug asked for a new probe */
+static bool edidProbeActive = false;            /* a probe is reading the HAL */
+
 #define NULL_HANDLE 0
-#define IARM_BUS_Lock(lock) pthread_mutex_lock(&dsLock)
-#define IARM_BUS_Unlock(lock) pthread_mutex_unlock(&dsLock)
+#define IARM_BUS_Lock(lock) dsPerfMutexLock(&dsLock)
+#define IARM_BUS_Unlock(lock) dsPerfMutexUnlock(&dsLock)
 
 IARM_Result_t _dsDisplayInit(void *arg);
 IARM_Result_t _dsGetDisplay(void *arg);
 IARM_Result_t _dsGetDisplayAspectRatio(void *arg);
 IARM_Result_t _dsGetEDID(void *arg);
 IARM_Result_t _dsGetEDIDBytes(void *arg);
+IARM_Result_t _dsGetEDIDState(void *arg);
 IARM_Result_t _dsSetAllmEnabled(void *arg);
 IARM_Result_t _dsSetAVIContentType(void *arg);
 IARM_Result_t _dsSetAVIScanInformation(void *arg);
@@ -76,6 +104,9 @@ void _dsDisplayEventCallback(intptr_t handle, dsDisplayEvent_t event, void *even
 static void  filterEDIDResolution(intptr_t Shandle, dsDisplayEDID_t *edid);
 static void  dumpEDIDInformation( dsDisplayEDID_t *edid);
 static dsVideoPortType_t _GetDisplayPortType(intptr_t handle);
+static dsError_t _dsReadEDIDBytes(intptr_t handle);
+static void _dsStartEDIDProbe(intptr_t handle, bool restart);
+static void _dsStopEDIDProbe(void);
 extern void resetColorDepthOnHdmiReset(intptr_t handle);
 extern void _dsSyncHdmiStatus(const std::string& key, int value);
 
@@ -92,7 +123,7 @@ IARM_Result_t dsDisplayMgr_init()
 	m_isPlatInitialized++;
 
 	IARM_BUS_Unlock(lock);  //CID:136387 - Data race condition
-	IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsDisplayInit, _dsDisplayInit);
+	dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsDisplayInit, _dsDisplayInit);
     return IARM_RESULT_SUCCESS;
 }
 
@@ -119,15 +150,18 @@ IARM_Result_t _dsDisplayInit(void *arg)
             }
         }
         dsRegisterDisplayEventCallback(handle, _dsDisplayEventCallback);
-
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetDisplay,_dsGetDisplay);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetDisplayAspectRatio,_dsGetDisplayAspectRatio);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetEDID,_dsGetEDID);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetEDIDBytes,_dsGetEDIDBytes);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetAllmEnabled,_dsSetAllmEnabled);
-                IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetAVIContentType,_dsSetAVIContentType);
-                IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetAVIScanInformation,_dsSetAVIScanInformation);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsDisplayTerm,_dsDisplayTerm);
+        /* a display connected before dsMgr started gets no hotplug event */
+        _dsStartEDIDProbe(handle, true);
+
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetDisplay,_dsGetDisplay);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetDisplayAspectRatio,_dsGetDisplayAspectRatio);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetEDID,_dsGetEDID);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetEDIDBytes,_dsGetEDIDBytes);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetEDIDState,_dsGetEDIDState);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetAllmEnabled,_dsSetAllmEnabled);
+                dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetAVIContentType,_dsSetAVIContentType);
+                dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetAVIScanInformation,_dsSetAVIScanInformation);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsDisplayTerm,_dsDisplayTerm);
 
 		m_isInitialized = 1;
     }
@@ -178,71 +212,79 @@ IARM_Result_t _dsGetEDID(void *arg)
        return IARM_RESULT_INVALID_PARAM;
     }
     errno_t rc = -1;
-    static dsDisplayEDID_t *edidInfo = (dsDisplayEDID_t*)malloc(sizeof(dsDisplayEDID_t));
     dsDisplayGetEDIDParam_t *param = (dsDisplayGetEDIDParam_t *)arg;
     dsVideoPortType_t _VPortType;
+    IARM_BUS_Lock(lock);
+    param->result = dsERR_NONE;
     if(isEdidCached && param)
     {
-	    rc = memcpy_s(&param->edid,sizeof(param->edid),edidInfo,sizeof(dsDisplayEDID_t));
+	    rc = memcpy_s(&param->edid,sizeof(param->edid),&edidInfo,sizeof(dsDisplayEDID_t));
 	    if(rc!=EOK)
 		     {
 			     ERR_CHK(rc);
 	             }
+	    IARM_BUS_Unlock(lock);
 	    return IARM_RESULT_SUCCESS;
     }
-    IARM_BUS_Lock(lock);
-    memset(edidInfo,0,sizeof(*edidInfo));
+    memset(&edidInfo,0,sizeof(edidInfo));
+
+    /* The hotplug callback does not take the lock: an EDID read across a hotplug is not cached */
+    unsigned int generation = __atomic_load_n(&edidGeneration, __ATOMIC_ACQUIRE);
+
+    /* A replugged display that was seen before skips the HAL parse and the filtering.
+     * Only bytes already read by the hotplug probe or dsGetEDIDBytes are used for
+     * the lookup, a miss costs no more HAL reads than before the cache. */
+    bool haveBytes = isEdidBytesCached;
+    if (haveBytes && edidCache.lookup(edidBytes, edidBytesLength, &param->edid)) {
+        INT_INFO("[DsMgr] EDID of known display %x/%x reused, %lu hits\r\n",
+                 param->edid.productCode, param->edid.serialNumber, edidCache.hits());
+    }
+    else {
+        param->result = dsGetEDID(param->handle, &param->edid);
+        if (param->result != dsERR_NONE) {
+            INT_ERROR("[DsMgr] dsGetEDID failed, error %d\r\n", param->result);
+            IARM_BUS_Unlock(lock);
+            return IARM_RESULT_SUCCESS;
+        }
 
-    dsGetEDID(param->handle, &param->edid);
-    
-    filterEDIDResolution(param->handle, &param->edid);
-    dumpEDIDInformation( &param->edid);
-    rc = memcpy_s(edidInfo,sizeof(dsDisplayEDID_t),&param->edid,sizeof(param->edid));
-     if(rc!=EOK)
-     {
-	     ERR_CHK(rc);
-     }
-     isEdidCached = true;
+        filterEDIDResolution(param->handle, &param->edid);
+        dumpEDIDInformation( &param->edid);
+        if (haveBytes && (generation == __atomic_load_n(&edidGeneration, __ATOMIC_ACQUIRE))) {
+            edidCache.insert(edidBytes, edidBytesLength, param->edid);
+        }
+    }
+    if (generation == __atomic_load_n(&edidGeneration, __ATOMIC_ACQUIRE)) {
+        rc = memcpy_s(&edidInfo,sizeof(dsDisplayEDID_t),&param->edid,sizeof(param->edid));
+        if(rc!=EOK)
+        {
+            ERR_CHK(rc);
+        }
+        isEdidCached = true;
+    }
 	
 	IARM_BUS_Unlock(lock);
 	
 	return IARM_RESULT_SUCCESS;
 }
 
-IARM_Result_t _dsGetEDIDBytes(void *arg)
+static bool _dsEDIDHeaderValid(const unsigned char *bytes, int length)
+{
+    static const unsigned char header[8] = {0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00};
+    return (length >= 128) && (0 == memcmp(bytes, header, sizeof(header)));
+}
+
+/*
+ * Reads the raw EDID into edidBytes, called with the lock held. The bytes are
+ * only marked cached (valid) when they carry an EDID header and no hotplug
+ * happened during the read.
+ */
+static dsError_t _dsReadEDIDBytes(intptr_t handle)
 {
 
 #ifndef RDK_DSHAL_NAME
 #warning   "RDK_DSHAL_NAME is not defined"
 #define RDK_DSHAL_NAME "RDK_DSHAL_NAME is not defined"
 #endif
-    errno_t rc = -1;
-    _DEBUG_ENTER();
-    if (!arg) {   //  coverity - FORWARD_NULL check
-       return IARM_RESULT_INVALID_PARAM;
-    }
-
-    static unsigned char edid[1024] = {0};
-    static int length = 0;
-   dsDisplayGetEDIDBytesParam_t *param = (dsDisplayGetEDIDBytesParam_t *)arg;
-    if(isEdidBytesCached && param)
-	     {
-		     rc = memcpy_s(param->bytes,sizeof(param->bytes),edid,length);
-		     if(rc!=EOK)
-			      {
-				      ERR_CHK(rc);
-			      }
-		     param->length = length;
-		     param->result = dsERR_NONE; 
-		     return IARM_RESULT_SUCCESS; 
-
-              }
-
-
-    IARM_BUS_Lock(lock);
-
-    INT_DEBUG("dsSRV::getEDIDBytes \r\n");
-
     typedef dsError_t (*dsGetEDIDBytes_t)(intptr_t handle, unsigned char *edid, int *length);
     static dsGetEDIDBytes_t func = 0;
     if (func == 0) {
@@ -253,7 +295,7 @@ IARM_Result_t _dsGetEDIDBytes(void *arg)
                 INT_DEBUG("dsGetEDIDBytes(void) is defined and loaded\r\n");
             }   
             else {
-                INT_INFO("dsGetEDIDBytes(void) is not defined\r\n");
+                INT_INFO_RL("dsGetEDIDBytes(void) is not defined\r\n");
             }   
             dlclose(dllib);
         }   
@@ -262,23 +304,67 @@ IARM_Result_t _dsGetEDIDBytes(void *arg)
         }   
     }   
 
-   
+    if (func == 0) {
+        edidBytesUnsupported = true;
+        return dsERR_OPERATION_NOT_SUPPORTED;
+    }
 
-    if (func != 0) {
-        dsError_t ret = func(param->handle, edid, &length);
-        if (ret == dsERR_NONE && length <= 1024) {
-            rc = memcpy_s(param->bytes,sizeof(param->bytes),edid,length);
-            if(rc!=EOK)
-            {
-                    ERR_CHK(rc);
-            }
-     	    param->length = length;
-	    isEdidBytesCached = true;
+    int length = 0;
+    unsigned int generation = __atomic_load_n(&edidGeneration, __ATOMIC_ACQUIRE);
+    dsError_t ret = func(handle, edidBytes, &length);
+    if (ret == dsERR_NONE) {
+        if (length >= 0 && length <= (int)sizeof(edidBytes)) {
+            edidBytesLength = length;
+            isEdidBytesCached = _dsEDIDHeaderValid(edidBytes, length) &&
+                                (generation == __atomic_load_n(&edidGeneration, __ATOMIC_ACQUIRE));
+        }
+        else {
+            ret = dsERR_GENERAL;
         }
-        param->result = ret;
     }
-    else {
-        param->result = dsERR_OPERATION_NOT_SUPPORTED;
+    return ret;
+}
+
+/* Copies edidBytes into the variable length payload of param, if it has room for them. Lock held. */
+static void _dsCopyEDIDBytes(dsDisplayGetEDIDBytesParam_t *param)
+{
+    int capacity = DS_RPC_VAR_PARAM_CAPACITY(param, bytes);
+
+    if (edidBytesLength <= capacity) {
+        errno_t rc = memcpy_s(param->bytes, capacity, edidBytes, edidBytesLength);
+        if(rc!=EOK)
+        {
+                ERR_CHK(rc);
+        }
+    }
+    param->length = edidBytesLength;
+}
+
+IARM_Result_t _dsGetEDIDBytes(void *arg)
+{
+    _DEBUG_ENTER();
+    if (!arg) {   //  coverity - FORWARD_NULL check
+       return IARM_RESULT_INVALID_PARAM;
+    }
+
+   dsDisplayGetEDIDBytesParam_t *param = (dsDisplayGetEDIDBytesParam_t *)arg;
+
+    /* The probe thread may be rewriting edidBytes, never copy them without the lock */
+    IARM_BUS_Lock(lock);
+    if(isEdidBytesCached && param)
+	     {
+		     _dsCopyEDIDBytes(param);
+		     param->result = dsERR_NONE; 
+		     IARM_BUS_Unlock(lock);
+		     return IARM_RESULT_SUCCESS; 
+
+              }
+
+    INT_DEBUG("dsSRV::getEDIDBytes \r\n");
+
+    param->result = _dsReadEDIDBytes(param->handle);
+    if (param->result == dsERR_NONE) {
+        _dsCopyEDIDBytes(param);
     }
 
     IARM_BUS_Unlock(lock);
@@ -286,6 +372,158 @@ IARM_Result_t _dsGetEDIDBytes(void *arg)
 	return IARM_RESULT_SUCCESS;
 }
 
+IARM_Result_t _dsGetEDIDState(void *arg)
+{
+    _DEBUG_ENTER();
+    if (!arg) {
+       return IARM_RESULT_INVALID_PARAM;
+    }
+    dsDisplayGetEDIDStateParam_t *param = (dsDisplayGetEDIDStateParam_t *)arg;
+
+    IARM_BUS_Lock(lock);
+    /* Without dsGetEDIDBytes nothing can be verified, dsGetEDID is all there is */
+    param->valid = isEdidBytesCached || edidBytesUnsupported;
+    param->generation = __atomic_load_n(&edidGeneration, __ATOMIC_ACQUIRE);
+    param->result = dsERR_NONE;
+    IARM_BUS_Unlock(lock);
+
+    /* The HAL is only read by the probe thread, a stale state just asks it for another probe */
+    if (!param->valid) {
+        _dsStartEDIDProbe(param->handle, false);
+    }
+
+    return IARM_RESULT_SUCCESS;
+}
+
+/*
+ * Waits up to ms on edidProbeCond, called with edidProbeLock held.
+ * Returns false when the probe thread is stopping or a newer probe was asked for.
+ */
+static bool _dsEDIDProbeSleep(int ms)
+{
+    struct timespec deadline;
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    deadline.tv_nsec += (long)ms * 1000000L;
+    deadline.tv_sec += deadline.tv_nsec / 1000000000L;
+    deadline.tv_nsec %= 1000000000L;
+
+    while (edidProbeRunning && !edidProbePending) {
+        if (ETIMEDOUT == pthread_cond_timedwait(&edidProbeCond, &edidProbeLock, &deadline)) {
+            break;
+        }
+    }
+    return edidProbeRunning && !edidProbePending;
+}
+
+/*
+ * Single thread that reads the EDID every DS_EDID_PROBE_INTERVAL_MS after a
+ * hotplug, without any client IPC, and broadcasts IARM_BUS_DSMGR_EVENT_EDID_READY
+ * as soon as it verifies. dsLock is only held for each HAL read. A newer
+ * hotplug restarts the probe, _dsStopEDIDProbe() ends the thread.
+ */
+static void *_dsEDIDProbeThread(void *arg)
+{
+    (void)arg;
+    pthread_mutex_lock(&edidProbeLock);
+    while (edidProbeRunning) {
+        if (!edidProbePending) {
+            pthread_cond_wait(&edidProbeCond, &edidProbeLock);
+            continue;
+        }
+        edidProbePending = false;
+        edidProbeActive = true;
+        pthread_mutex_unlock(&edidProbeLock);
+
+        unsigned int generation = __atomic_load_n(&edidGeneration, __ATOMIC_ACQUIRE);
+        bool probing = true;
+        int waited = 0;
+        while (probing) {
+            IARM_BUS_Lock(lock);
+            if (!isEdidBytesCached && m_isPlatInitialized) {
+                _dsReadEDIDBytes(__atomic_load_n(&edidDisplayHandle, __ATOMIC_ACQUIRE));
+            }
+            bool ready = (isEdidBytesCached || edidBytesUnsupported) &&
+                         (generation == __atomic_load_n(&edidGeneration, __ATOMIC_ACQUIRE));
+            int length = edidBytesLength;
+            IARM_BUS_Unlock(lock);
+
+            if (ready) {
+                IARM_Bus_DSMgr_EventData_t eventData;
+                memset(&eventData, 0, sizeof(eventData));
+                eventData.data.edid_ready.generation = generation;
+                eventData.data.edid_ready.length = length;
+                INT_INFO("EDID ready %d ms after hotplug, generation %u\r\n", waited, generation);
+                dsMgr_BroadcastEvent((IARM_EventId_t)IARM_BUS_DSMGR_EVENT_EDID_READY, (void *)&eventData, sizeof(eventData));
+                break;
+            }
+            if (waited >= DS_EDID_PROBE_TIMEOUT_MS) {
+                INT_ERROR("No valid EDID %d ms after hotplug, generation %u\r\n", DS_EDID_PROBE_TIMEOUT_MS, generation);
+                break;
+            }
+            pthread_mutex_lock(&edidProbeLock);
+            probing = _dsEDIDProbeSleep(DS_EDID_PROBE_INTERVAL_MS);
+            pthread_mutex_unlock(&edidProbeLock);
+            waited += DS_EDID_PROBE_INTERVAL_MS;
+        }
+        pthread_mutex_lock(&edidProbeLock);
+        edidProbeActive = false;
+    }
+    pthread_mutex_unlock(&edidProbeLock);
+    return NULL;
+}
+
+/*
+ * Asks the probe thread, started on first use, for a new probe. Without restart
+ * a probe already running is left alone. Called from the HAL callback, so it
+ * must not take dsLock.
+ */
+static void _dsStartEDIDProbe(intptr_t handle, bool restart)
+{
+    if (NULL_HANDLE != handle) {
+        __atomic_store_n(&edidDisplayHandle, handle, __ATOMIC_RELEASE);
+    }
+
+    pthread_mutex_lock(&edidProbeLock);
+    if (!edidProbeRunning) {
+        pthread_condattr_t attr;
+        pthread_condattr_init(&attr);
+        pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+        pthread_cond_init(&edidProbeCond, &attr);
+        pthread_condattr_destroy(&attr);
+
+        edidProbeRunning = true;
+        if (0 != pthread_create(&edidProbeThread, NULL, _dsEDIDProbeThread, NULL)) {
+            edidProbeRunning = false;
+            pthread_cond_destroy(&edidProbeCond);
+            pthread_mutex_unlock(&edidProbeLock);
+            INT_ERROR("Failed to start the EDID probe thread\r\n");
+            return;
+        }
+    }
+    if (restart || !edidProbeActive) {
+        edidProbePending = true;
+        pthread_cond_signal(&edidProbeCond);
+    }
+    pthread_mutex_unlock(&edidProbeLock);
+}
+
+/* Ends the probe thread, must be called without dsLock held */
+static void _dsStopEDIDProbe(void)
+{
+    pthread_mutex_lock(&edidProbeLock);
+    if (!edidProbeRunning) {
+        pthread_mutex_unlock(&edidProbeLock);
+        return;
+    }
+    edidProbeRunning = false;
+    edidProbePending = false;
+    pthread_cond_signal(&edidProbeCond);
+    pthread_mutex_unlock(&edidProbeLock);
+
+    pthread_join(edidProbeThread, NULL);
+    pthread_cond_destroy(&edidProbeCond);
+}
+
 IARM_Result_t _dsSetAllmEnabled(void* arg)
 {
 #ifndef RDK_DSHAL_NAME
@@ -494,6 +732,7 @@ IARM_Result_t _dsDisplayTerm(void *arg)
 	IARM_BUS_Lock(lock);
 
     m_isPlatInitialized--;
+	bool stopProbe = (0 == m_isPlatInitialized);
 	
 	if (0 == m_isPlatInitialized)
 	{
@@ -501,6 +740,9 @@ IARM_Result_t _dsDisplayTerm(void *arg)
 	}
 
     IARM_BUS_Unlock(lock);
+    if (stopProbe) {
+        _dsStopEDIDProbe();
+    }
 	return IARM_RESULT_SUCCESS;
 }
 
@@ -510,7 +752,7 @@ void _dsDisplayEventCallback(intptr_t handle, dsDisplayEvent_t event, void *even
 {
 	IARM_Bus_DSMgr_EventData_t _eventData;
     IARM_Bus_DSMgr_EventId_t _eventId;
-
+    uint64_t halTimestamp = dsEventTraceNow();
 
 	if (NULL_HANDLE == handle)
 	{
@@ -520,15 +762,21 @@ void _dsDisplayEventCallback(intptr_t handle, dsDisplayEvent_t event, void *even
 	{
 		case dsDISPLAY_EVENT_CONNECTED:
 			INT_INFO("connecting HDMI to display !!!!!!..\r\n");
+			TELEMETRY_COUNT("HDMI_INFO_hotplug_connect");
 			_eventData.data.hdmi_hpd.event =  dsDISPLAY_EVENT_CONNECTED;
             _eventId = IARM_BUS_DSMGR_EVENT_HDMI_HOTPLUG;
+	    __atomic_add_fetch(&edidGeneration, 1, __ATOMIC_ACQ_REL);
+	    isEdidCached = false;
+	    isEdidBytesCached = false;
 			_dsSyncHdmiStatus(DS_HDMI_TAG_HOTPLUP, dsDISPLAY_EVENT_CONNECTED);
 	        break;
 
 		case dsDISPLAY_EVENT_DISCONNECTED:
 			INT_INFO("Disconnecting HDMI from display !!!!!!!! ..\r\n");
+			TELEMETRY_COUNT("HDMI_INFO_hotplug_disconnect");
 			_eventData.data.hdmi_hpd.event =  dsDISPLAY_EVENT_DISCONNECTED ;
             _eventId = IARM_BUS_DSMGR_EVENT_HDMI_HOTPLUG;
+	    __atomic_add_fetch(&edidGeneration, 1, __ATOMIC_ACQ_REL);
 	    isEdidCached = false;
 	    isEdidBytesCached = false;
 	      INT_INFO("isEdidCached & isEdidBytesCached set to false !!!!!!..\r\n");
@@ -543,7 +791,7 @@ void _dsDisplayEventCallback(intptr_t handle, dsDisplayEvent_t event, void *even
 
         case dsDISPLAY_RXSENSE_OFF:
             INT_INFO("Rx Sense Status OFF !!!!!!!! ..\r\n");
-            TELEMETRY_EVENT_INT("HDMI_INFO_tv_off", 1);
+            TELEMETRY_COUNT("HDMI_INFO_tv_off");
             _eventData.data.hdmi_rxsense.status =  dsDISPLAY_RXSENSE_OFF ;
             _eventId = IARM_BUS_DSMGR_EVENT_RX_SENSE;
             break;    
@@ -558,9 +806,11 @@ void _dsDisplayEventCallback(intptr_t handle, dsDisplayEvent_t event, void *even
 			return;
 			
 	}
-    IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,(IARM_EventId_t)_eventId,(void *)&_eventData, sizeof(_eventData));
+    dsEventTraceRecordAt(halTimestamp, dsEVENT_TRACE_HAL_CALLBACK, _eventId, event);
+    dsMgr_BroadcastEvent((IARM_EventId_t)_eventId,(void *)&_eventData, sizeof(_eventData));
     if (dsDISPLAY_EVENT_CONNECTED == event) {
         dsError_t eRet = dsERR_NONE;
+        _dsStartEDIDProbe(handle, true);
         if (!_hdmiVideoPortHandle){
             eRet = dsGetVideoPort(dsVIDEOPORT_TYPE_HDMI,0,&_hdmiVideoPortHandle);
             if (dsERR_NONE != eRet) {
@@ -587,11 +837,7 @@ static void filterEDIDResolution(intptr_t handle, dsDisplayEDID_t *edid)
     }
 
     dsVideoPortType_t _VPortType = _GetDisplayPortType(handle);
-    dsDisplayEDID_t *edidData = (dsDisplayEDID_t*)malloc(sizeof(dsDisplayEDID_t));
-    if (edidData == NULL) {
-        INT_ERROR("Failed to allocate memory for EDID data\n");
-    	return;
-    }
+    dsDisplayEDID_t *edidData = &edidFilterScratch;
 
     int numOfSupportedResolution = 0;
 
@@ -602,7 +848,6 @@ static void filterEDIDResolution(intptr_t handle, dsDisplayEDID_t *edid)
         //Get details from libds
         if (_dsGetVideoPortResolutions(&iCount, &pVideoResolutionsSettings) != dsERR_NONE) {
             INT_ERROR("Failed to get video port resolutions, leaving EDID unchanged\n");
-            free(edidData);
             return;
         }
 
@@ -637,8 +882,6 @@ static void filterEDIDResolution(intptr_t handle, dsDisplayEDID_t *edid)
     {
         INT_INFO("EDID for Non HDMI Port\r\n");            
     }
-
-    free(edidData);
 }
 
 static void dumpEDIDInformation( dsDisplayEDID_t *edid)
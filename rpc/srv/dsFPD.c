@@ -27,6 +27,8 @@
 **/
 
 
+#define DS_LOG_MODULE dsLOG_MODULE_FPD
+
 #include <stdio.h>
 #include <string.h>
 #include <unistd.h>
@@ -39,6 +41,9 @@
 #include "dsTypes.h"
 #include "dsserverlogger.h"
 #include "dsMgr.h"
+#include "dsPerfStats.h"
+#include "dsFPDAnim.h"
+#include "dsFPDClock.h"
 	
 #include "iarmUtil.h"
 #include "libIARM.h"
@@ -47,11 +52,12 @@
 #include <iostream>
 #include "hostPersistence.hpp"
 #include <sstream>
+#include <map>
 
 
 #define direct_list_top(list) ((list))
-#define IARM_BUS_Lock(lock) pthread_mutex_lock(&fpLock)
-#define IARM_BUS_Unlock(lock) pthread_mutex_unlock(&fpLock)
+#define IARM_BUS_Lock(lock) dsPerfMutexLock(&fpLock)
+#define IARM_BUS_Unlock(lock) dsPerfMutexUnlock(&fpLock)
 
 /* Below block allows the default brightness of a device (after a reset) to be set from 
  * device-specific recipes. If recipes say nothing, it should use max brightness supported. */
@@ -83,6 +89,10 @@ IARM_Result_t _dsFPEnableCLockDisplay(void *arg);
 IARM_Result_t _dsGetTimeFormat(void *arg);
 IARM_Result_t _dsSetTimeFormat(void *arg);
 IARM_Result_t _dsSetFPDMode(void *arg);
+IARM_Result_t _dsFPStartAnimation(void *arg);
+IARM_Result_t _dsFPCancelAnimation(void *arg);
+IARM_Result_t _dsFPSetAutoClock(void *arg);
+IARM_Result_t _dsSetFPIndicatorScene(void *arg);
 
 /*TBD - Only Text and Power Brigghtness settings for the time being
  * Create an Array of all inidcator and test display
@@ -92,6 +102,11 @@ static  dsFPDBrightness_t _dsTextBrightness  = dsFPD_BRIGHTNESS_MAX ;
 static  dsFPDColor_t     _dsPowerLedColor   = dsFPD_COLOR_BLUE;
 static  dsFPDTimeFormat_t _dsTextTimeFormat	= dsFPD_TIME_12_HOUR;
 static  dsFPDMode_t _dsFPDMode  = dsFPD_MODE_ANY;
+#ifdef HAS_CLOCK_DISPLAY
+static  bool _dsAutoClock = true;               /* dsMgr updates the clock until an app sets the time */
+static  bool _dsClockDisplayEnabled = true;     /* disabled by the power manager in standby */
+static  bool _dsTextShown = false;              /* text covers the clock in dsFPD_MODE_ANY */
+#endif
 
 
 
@@ -102,6 +117,8 @@ typedef struct _dsFPDSettings_t_
     dsFPDBrightness_t brightness;
     dsFPDState_t state;
     dsFPDColor_t color;
+    int level;              /* brightness last given to the HAL, -1 until then */
+    bool colorApplied;      /* color has been given to the HAL */
 }_FPDSettings_t;
 
 /** Variable that stores the brightness and State for FP */
@@ -111,6 +128,49 @@ static _FPDSettings_t srvFPDSettings[dsFPD_INDICATOR_MAX];
 
 using namespace std;
 
+#ifdef HAS_CLOCK_DISPLAY
+/* Draws the animation frames; called by dsFPDAnim with its lock held, which is taken before fpLock */
+static bool _dsFPDAnimDraw(const char *text)
+{
+    bool drawn = false;
+    IARM_BUS_Lock(lock);
+
+    if (m_isPlatInitialized && ((_dsFPDMode == dsFPD_MODE_ANY) || (_dsFPDMode == dsFPD_MODE_TEXT))) {
+        drawn = (dsERR_NONE == dsSetFPText(text));
+        _dsTextShown = _dsTextShown || drawn;
+    }
+
+    IARM_BUS_Unlock(lock);
+    return drawn;
+}
+
+/* The last animation ended or was cancelled: show the clock again. Called like _dsFPDAnimDraw. */
+static void _dsFPDAnimIdle(void)
+{
+    IARM_BUS_Lock(lock);
+
+    _dsTextShown = false;
+    dsFPDClockRefresh();
+
+    IARM_BUS_Unlock(lock);
+}
+
+/* Called by the dsFPDClock thread on every minute boundary */
+static bool _dsFPDClockDraw(unsigned int hours, unsigned int minutes)
+{
+    bool drawn = false;
+    IARM_BUS_Lock(lock);
+
+    if (m_isPlatInitialized && _dsAutoClock && _dsClockDisplayEnabled && !_dsTextShown &&
+        ((_dsFPDMode == dsFPD_MODE_ANY) || (_dsFPDMode == dsFPD_MODE_CLOCK))) {
+        drawn = (dsERR_NONE == dsSetFPTime(_dsTextTimeFormat, hours, minutes));
+    }
+
+    IARM_BUS_Unlock(lock);
+    return drawn;
+}
+#endif
+
 std::string numberToString (int number);
 int stringToNumber (std::string text);
 std::string enumToColor (dsFPDColor_t enumColor);
@@ -174,7 +234,11 @@ IARM_Result_t dsFPDMgr_init()
 {
 
 
-	IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsFPInit,_dsFPInit);
+	dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsFPInit,_dsFPInit);
+#ifdef HAS_CLOCK_DISPLAY
+	dsFPDAnimInit(_dsFPDAnimDraw, _dsFPDAnimIdle);
+	dsFPDClockStart(_dsFPDClockDraw);
+#endif
 	
 	try
 	{
@@ -235,6 +299,8 @@ IARM_Result_t dsFPDMgr_init()
 
 IARM_Result_t dsFPDMgr_term()
 {
+   dsFPDAnimTerm();
+   dsFPDClockStop();
    return IARM_RESULT_SUCCESS;
 }
 
@@ -247,23 +313,27 @@ IARM_Result_t _dsFPInit(void *arg)
 
     	INT_INFO("<<<<< called _dsFPInit >>>>>>>>\r\n");
 
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsFPTerm,_dsFPTerm);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetFPText,_dsSetFPText);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetFPTime,_dsSetFPTime);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetFPScroll,_dsSetFPScroll);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetFPBlink,_dsSetFPBlink);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetFPBrightness,_dsGetFPBrightness);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetFPState,_dsSetFPState);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetFPState,_dsGetFPState);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetFPBrightness,_dsSetFPBrightness);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetFPColor,_dsSetFPColor);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetFPColor,_dsGetFPColor);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetFPTextBrightness,_dsGetFPTextBrightness);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetFPTextBrightness,_dsSetFPTextBrightness);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsFPEnableCLockDisplay,_dsFPEnableCLockDisplay);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetTimeFormat,_dsGetTimeFormat);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetTimeFormat,_dsSetTimeFormat);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetFPDMode,_dsSetFPDMode);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsFPTerm,_dsFPTerm);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetFPText,_dsSetFPText);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetFPTime,_dsSetFPTime);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetFPScroll,_dsSetFPScroll);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetFPBlink,_dsSetFPBlink);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetFPBrightness,_dsGetFPBrightness);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetFPState,_dsSetFPState);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetFPState,_dsGetFPState);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetFPBrightness,_dsSetFPBrightness);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetFPColor,_dsSetFPColor);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetFPColor,_dsGetFPColor);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetFPTextBrightness,_dsGetFPTextBrightness);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetFPTextBrightness,_dsSetFPTextBrightness);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsFPEnableCLockDisplay,_dsFPEnableCLockDisplay);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetTimeFormat,_dsGetTimeFormat);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetTimeFormat,_dsSetTimeFormat);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetFPDMode,_dsSetFPDMode);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsFPStartAnimation,_dsFPStartAnimation);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsFPCancelAnimation,_dsFPCancelAnimation);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsFPSetAutoClock,_dsFPSetAutoClock);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetFPIndicatorScene,_dsSetFPIndicatorScene);
 		
         
 		memset (srvFPDSettings, 0, sizeof (srvFPDSettings));
@@ -273,6 +343,7 @@ IARM_Result_t _dsFPInit(void *arg)
 			srvFPDSettings[i].brightness = dsFPD_BRIGHTNESS_MAX;
 			srvFPDSettings[i].state = dsFPD_STATE_OFF;
                         srvFPDSettings[i].color = dsFPD_COLOR_BLUE;
+			srvFPDSettings[i].level = -1;
 		}
 
         m_isInitialized = 1;
@@ -281,6 +352,9 @@ IARM_Result_t _dsFPInit(void *arg)
     if (!m_isPlatInitialized) {
         dsFPInit();
         m_isPlatInitialized = 1;
+        #ifdef HAS_CLOCK_DISPLAY
+        dsFPDClockRefresh();
+        #endif
     }
 
     IARM_BUS_Unlock(lock);
@@ -311,6 +385,8 @@ IARM_Result_t _dsSetFPText(void *arg)
    
     IARM_Result_t ret = IARM_RESULT_SUCCESS; 
      #ifdef HAS_CLOCK_DISPLAY
+    /* Text set by an app replaces any running animation */
+    dsFPDAnimStop();
     IARM_BUS_Lock(lock);
 
     if ((_dsFPDMode  == dsFPD_MODE_ANY) || (_dsFPDMode  == dsFPD_MODE_TEXT)) {
@@ -319,6 +395,10 @@ IARM_Result_t _dsSetFPText(void *arg)
         {
             ret = IARM_RESULT_INVALID_PARAM;
         }
+        else
+        {
+            _dsTextShown = true;
+        }
     }
     else {
        INT_INFO("_dsSetFPText: Not setting Text, Clock mode enabled \r\n");
@@ -345,6 +425,15 @@ IARM_Result_t _dsSetFPTime(void *arg)
         {
             ret = IARM_RESULT_INVALID_PARAM;
         }
+        else
+        {
+            /* The app drives the clock from now on, until it enables the automatic clock again */
+            if (_dsAutoClock) {
+                INT_INFO("_dsSetFPTime: clock set by an app, stopping automatic clock updates \r\n");
+                _dsAutoClock = false;
+            }
+            _dsTextShown = false;
+        }
     }
     else {
        INT_INFO("_dsSetFPTime: Not setting Clock, Text mode enabled \r\n");
@@ -362,6 +451,8 @@ IARM_Result_t _dsSetFPScroll(void *arg)
    	
     IARM_Result_t ret = IARM_RESULT_SUCCESS;
    	#ifdef HAS_CLOCK_DISPLAY
+    /* HAL scrolling would fight the animation frames */
+    dsFPDAnimStop();
     IARM_BUS_Lock(lock);
 
 	dsFPDScrollParam_t *param = (dsFPDScrollParam_t *)arg;
@@ -436,6 +527,7 @@ IARM_Result_t _dsSetFPBrightness(void *arg)
                 if(dsStatus == dsERR_NONE)
                 {
 		    srvFPDSettings[param->eIndicator].brightness = param->eBrightness;
+		    srvFPDSettings[param->eIndicator].level = param->eBrightness;
 
 		    try{
 			switch (param->eIndicator)
@@ -583,6 +675,7 @@ IARM_Result_t _dsSetFPColor(void *arg)
     {
     param->eColor &= 0x00FFFFFF;
     srvFPDSettings[param->eIndicator].color = param->eColor;
+    srvFPDSettings[param->eIndicator].colorApplied = true;
     INT_INFO("_dsSetFPColor Value  From  App is %d for Indicator %d \r\n",param->eColor,param->eIndicator);
     try{
 			switch (param->eIndicator)
@@ -634,6 +727,13 @@ IARM_Result_t _dsFPEnableCLockDisplay(void *arg)
     if(dsStatus != dsERR_NONE)
     {
         ret = IARM_RESULT_INVALID_PARAM;
+    }
+    else
+    {
+        _dsClockDisplayEnabled = (0 != lenable);
+        if (_dsClockDisplayEnabled) {
+            dsFPDClockRefresh();
+        }
     }
 	IARM_BUS_Unlock(lock);
 #endif
@@ -663,6 +763,7 @@ IARM_Result_t _dsSetFPState(void *arg)
 			INT_INFO("_dsSetFPState Setting Power LED to ON with Brightness %d \r\n",_dsPowerBrightness);
 	
 		    srvFPDSettings[param->eIndicator].state = param->state;
+		    srvFPDSettings[param->eIndicator].level = _dsPowerBrightness;
                 }
                 else
                 {
@@ -678,6 +779,7 @@ IARM_Result_t _dsSetFPState(void *arg)
 			INT_INFO("_dsSetFPState Setting Power LED to OFF with Brightness 0 \r\n");  //CID:127891 - Print_args
 
 		    srvFPDSettings[param->eIndicator].state = param->state;
+		    srvFPDSettings[param->eIndicator].level = 0;
                 }
                 else
                 {
@@ -754,9 +856,10 @@ IARM_Result_t _dsSetTimeFormat(void *arg)
 	    	_eventData.data.FPDTimeFormat.eTimeFormat =  _dsTextTimeFormat;
 	    	_eventId = IARM_BUS_DSMGR_EVENT_TIME_FORMAT_CHANGE;
 	    	
-	    	IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,(IARM_EventId_t)_eventId,(void *)&_eventData, sizeof(_eventData));
+	    	dsMgr_BroadcastEvent((IARM_EventId_t)_eventId,(void *)&_eventData, sizeof(_eventData));
 		    
 		    INT_INFO("Sent Clock IARM_BUS_DSMGR_EVENT_TIME_FORMAT_CHANGE event ... \r\n");
+		    dsFPDClockRefresh();
 		}
 
 	    IARM_BUS_Unlock(lock);
@@ -794,6 +897,14 @@ IARM_Result_t _dsSetFPDMode(void *arg)
                 if ((param->eMode == dsFPD_MODE_ANY) || (param->eMode == dsFPD_MODE_TEXT) || (param->eMode == dsFPD_MODE_CLOCK)) {
                     _dsFPDMode = param->eMode;
                     INT_INFO("_dsSetFPDMode: Mode set to %d \r\n",param->eMode);
+                    #ifdef HAS_CLOCK_DISPLAY
+                    if (param->eMode == dsFPD_MODE_CLOCK) {
+                        _dsTextShown = false;
+                    }
+                    if (param->eMode != dsFPD_MODE_TEXT) {
+                        dsFPDClockRefresh();
+                    }
+                    #endif
                 }
                 else {
                     INT_INFO("Error:_dsSetFPDMode : Invalid Param ... \r\n");
@@ -802,9 +913,185 @@ IARM_Result_t _dsSetFPDMode(void *arg)
                 }
 
                 IARM_BUS_Unlock(lock);
+
+                /* Back in text mode: show the running animation, if any */
+                if (param->eMode != dsFPD_MODE_CLOCK) {
+                    dsFPDAnimRedraw();
+                }
         return IARM_RESULT_SUCCESS;
 }
 
+IARM_Result_t _dsFPStartAnimation(void *arg)
+{
+    _DEBUG_ENTER();
+
+    dsFPDAnimParam_t *param = (dsFPDAnimParam_t *)arg;
+#ifdef HAS_CLOCK_DISPLAY
+    /* Not under fpLock, the animation lock is taken first */
+    param->result = dsFPDAnimSubmit(&param->animation, &param->handle);
+#else
+    param->result = dsERR_OPERATION_NOT_SUPPORTED;
+#endif
+    return IARM_RESULT_SUCCESS;
+}
+
+IARM_Result_t _dsFPCancelAnimation(void *arg)
+{
+    _DEBUG_ENTER();
+
+    dsFPDAnimCancelParam_t *param = (dsFPDAnimCancelParam_t *)arg;
+    param->result = dsFPDAnimCancel(param->handle);
+    return IARM_RESULT_SUCCESS;
+}
+
+/*
+ * Applies the settings of every indicator in one go: only what differs from
+ * what the HAL was last given is sent to it, and the power indicator
+ * brightness and color are persisted with a single write.
+ */
+IARM_Result_t _dsSetFPIndicatorScene(void *arg)
+{
+    _DEBUG_ENTER();
+
+    dsFPDSceneParam_t *param = (dsFPDSceneParam_t *)arg;
+    param->result = dsERR_NONE;
+    param->halCalls = 0;
+
+    /* Reject the whole scene rather than applying part of it */
+    for (int i = 0; i < dsFPD_INDICATOR_MAX; i++) {
+        const dsFPDIndicatorScene_t *scene = &param->indicators[i];
+        if (((scene->mask & DS_FPD_SCENE_STATE) && (scene->state != dsFPD_STATE_ON) && (scene->state != dsFPD_STATE_OFF)) ||
+            ((scene->mask & DS_FPD_SCENE_BRIGHTNESS) && (scene->brightness > dsFPD_BRIGHTNESS_MAX))) {
+            INT_ERROR("_dsSetFPIndicatorScene: invalid settings for indicator %d \r\n", i);
+            param->result = dsERR_INVALID_PARAM;
+            return IARM_RESULT_SUCCESS;
+        }
+    }
+
+    std::map<std::string, std::string> persist;
+    IARM_BUS_Lock(lock);
+
+    /* Power LED Indicator Brightness is the Global LED brightness for all indicators.
+     * It is only stored once dsSetFPBrightness succeeded for the power indicator. */
+    const dsFPDIndicatorScene_t *power = &param->indicators[dsFPD_INDICATOR_POWER];
+    const bool newPowerBrightness = param->toPersist && (power->mask & DS_FPD_SCENE_BRIGHTNESS);
+    const int globalBrightness = newPowerBrightness ? (int)power->brightness : (int)_dsPowerBrightness;
+
+    for (int i = 0; i < dsFPD_INDICATOR_MAX; i++) {
+        const dsFPDIndicatorScene_t *scene = &param->indicators[i];
+        _FPDSettings_t *current = &srvFPDSettings[i];
+        dsFPDIndicator_t indicator = (dsFPDIndicator_t)i;
+        dsError_t dsStatus;
+
+        if (0 == scene->mask) {
+            continue;
+        }
+
+        if (scene->mask & DS_FPD_SCENE_COLOR) {
+            dsFPDColor_t color = scene->color & 0x00FFFFFF;
+            if (!current->colorApplied || (current->color != color)) {
+                param->halCalls++;
+                dsStatus = dsSetFPColor(indicator, scene->color);
+                if (dsStatus == dsERR_NONE) {
+                    current->color = color;
+                    current->colorApplied = true;
+                    if (param->toPersist && (indicator == dsFPD_INDICATOR_POWER)) {
+                        _dsPowerLedColor = color;
+                        persist["Power.Color"] = enumToColor(color);
+                    }
+                } else {
+                    INT_ERROR("_dsSetFPIndicatorScene: dsSetFPColor failed for indicator %d, dsStatus:%d \r\n", i, dsStatus);
+                    param->result = dsStatus;
+                }
+            }
+        }
+
+        if (scene->mask & (DS_FPD_SCENE_STATE | DS_FPD_SCENE_BRIGHTNESS)) {
+            /* Same levels as _dsSetFPState and _dsSetFPBrightness */
+            int level;
+            if (!(scene->mask & DS_FPD_SCENE_STATE)) {
+                level = scene->brightness;
+            } else if (scene->state == dsFPD_STATE_OFF) {
+                level = 0;
+            } else {
+                level = (scene->mask & DS_FPD_SCENE_BRIGHTNESS) ? scene->brightness : globalBrightness;
+            }
+
+            dsStatus = dsERR_NONE;
+            if (current->level != level) {
+                param->halCalls++;
+                dsStatus = dsSetFPBrightness(indicator, (dsFPDBrightness_t)level);
+            }
+            if (dsStatus == dsERR_NONE) {
+                current->level = level;
+                if (scene->mask & DS_FPD_SCENE_STATE) {
+                    current->state = scene->state;
+                }
+                if (scene->mask & DS_FPD_SCENE_BRIGHTNESS) {
+                    current->brightness = scene->brightness;
+                }
+                if (newPowerBrightness && (indicator == dsFPD_INDICATOR_POWER)) {
+                    _dsPowerBrightness = power->brightness;
+                    persist["Power.brightness"] = numberToString(_dsPowerBrightness);
+                }
+            } else {
+                INT_ERROR("_dsSetFPIndicatorScene: dsSetFPBrightness failed for indicator %d, dsStatus:%d \r\n", i, dsStatus);
+                param->result = dsStatus;
+            }
+        }
+
+        if (scene->mask & DS_FPD_SCENE_BLINK) {
+            param->halCalls++;
+            dsStatus = dsSetFPBlink(indicator, scene->blinkDuration, scene->blinkIterations);
+            if (dsStatus != dsERR_NONE) {
+                INT_ERROR("_dsSetFPIndicatorScene: dsSetFPBlink failed for indicator %d, dsStatus:%d \r\n", i, dsStatus);
+                param->result = dsStatus;
+            }
+        }
+    }
+
+    if (!persist.empty()) {
+        try {
+            device::HostPersistence::getInstance().persistHostProperties(persist);
+        }
+        catch(...) {
+            INT_ERROR("Error in Persisting the indicator scene \r\n");
+        }
+    }
+
+    IARM_BUS_Unlock(lock);
+
+    INT_INFO("_dsSetFPIndicatorScene: applied with %u HAL calls, result %d \r\n", param->halCalls, param->result);
+    return IARM_RESULT_SUCCESS;
+}
+
+IARM_Result_t _dsFPSetAutoClock(void *arg)
+{
+    _DEBUG_ENTER();
+
+    dsFPDAutoClockParam_t *param = (dsFPDAutoClockParam_t *)arg;
+#ifdef HAS_CLOCK_DISPLAY
+    /* Enabling hands the display back to the clock */
+    if (param->enable) {
+        dsFPDAnimStop();
+    }
+    IARM_BUS_Lock(lock);
+
+    _dsAutoClock = param->enable;
+    if (param->enable) {
+        _dsTextShown = false;
+        dsFPDClockRefresh();
+    }
+    INT_INFO("_dsFPSetAutoClock: automatic clock %s \r\n", param->enable ? "enabled" : "disabled");
+    param->result = dsERR_NONE;
+
+    IARM_BUS_Unlock(lock);
+#else
+    param->result = dsERR_OPERATION_NOT_SUPPORTED;
+#endif
+    return IARM_RESULT_SUCCESS;
+}
+
 
 /** @} */
 /** @} */
@@ -0,0 +1,461 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2025 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+
+/**
+* @defgroup devicesettings
+* @{
+* @defgroup rpc
+* @{
+**/
+
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <poll.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <limits.h>
+#include <time.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include "dsFPDAnim.h"
+#include "dsserverlogger.h"
+
+typedef struct _dsFPDAnimEntry_t {
+    bool inUse;
+    unsigned int handle;
+    unsigned long sequence;         /* start order, the highest owns the display */
+    dsFPDAnimation_t animation;
+    unsigned int step;              /* next step to show */
+    unsigned int totalSteps;        /* 0 runs until cancelled */
+    char frame[DS_FPD_ANIM_TEXT_MAX];
+    unsigned long long dueMs;       /* when the next step is shown */
+} dsFPDAnimEntry_t;
+
+static pthread_mutex_t animLock = PTHREAD_MUTEX_INITIALIZER;
+static dsFPDAnimDrawFn animDraw = NULL;
+static dsFPDAnimIdleFn animIdle = NULL;
+static pthread_t animThread;
+static bool animThreadRunning = false;
+static int animTimerFd = -1;
+static int animWakeFd = -1;
+static unsigned long long animArmedMs = 0;  /* 0 while the timer is disarmed */
+static dsFPDAnimEntry_t animEntries[DS_FPD_ANIM_MAX];
+static int animActive = 0;
+static unsigned int animNextHandle = 1;
+static unsigned long animNextSequence = 1;
+static int animOwner = -1;
+static char animShown[DS_FPD_ANIM_TEXT_MAX];
+
+static unsigned long long _dsFPDAnimNowMs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+/* The functions below are called with animLock held */
+
+/* Arm the timer for the earliest due step, or disarm it when nothing runs */
+static void _dsFPDAnimArm(void)
+{
+    unsigned long long due = 0;
+    for (int i = 0; i < DS_FPD_ANIM_MAX; i++) {
+        if (animEntries[i].inUse && ((0 == due) || (animEntries[i].dueMs < due))) {
+            due = animEntries[i].dueMs;
+        }
+    }
+    if (due == animArmedMs) {
+        return;
+    }
+    struct itimerspec spec;
+    memset(&spec, 0, sizeof(spec));
+    spec.it_value.tv_sec = due / 1000;
+    spec.it_value.tv_nsec = (long)(due % 1000) * 1000000L;
+    if (0 != timerfd_settime(animTimerFd, TFD_TIMER_ABSTIME, &spec, NULL)) {
+        INT_ERROR("[%s]: timerfd_settime failed, errno %d\r\n", __FUNCTION__, errno);
+        return;
+    }
+    animArmedMs = due;
+}
+
+/* Render the next step into entry->frame; false once all steps were shown */
+static bool _dsFPDAnimRender(dsFPDAnimEntry_t *entry)
+{
+    const dsFPDAnimation_t *animation = &entry->animation;
+    const char *text = animation->frames[0];
+    unsigned int step = entry->step;
+
+    if ((entry->totalSteps > 0) && (step >= entry->totalSteps)) {
+        return false;
+    }
+    switch (animation->type) {
+    case dsFPD_ANIM_FRAMES:
+        snprintf(entry->frame, sizeof(entry->frame), "%s", animation->frames[step % animation->nFrames]);
+        break;
+    case dsFPD_ANIM_SCROLL: {
+        /* The text enters on the right and leaves on the left */
+        unsigned int length = strlen(text);
+        int start = (int)(step % (length + animation->width - 1)) + 1 - (int)animation->width;
+        for (unsigned int i = 0; i < animation->width; i++) {
+            int position = start + (int)i;
+            entry->frame[i] = ((position >= 0) && (position < (int)length)) ? text[position] : ' ';
+        }
+        entry->frame[animation->width] = '\0';
+        break;
+    }
+    case dsFPD_ANIM_BLINK:
+        if (animation->blinkPattern & (1u << (step % animation->blinkSteps))) {
+            snprintf(entry->frame, sizeof(entry->frame), "%s", text);
+        } else {
+            entry->frame[0] = '\0';
+        }
+        break;
+    case dsFPD_ANIM_COUNTDOWN: {
+        unsigned int left = animation->countdownSec - step;
+        if (animation->countdownSec >= 60) {
+            snprintf(entry->frame, sizeof(entry->frame), "%02u:%02u", left / 60, left % 60);
+        } else {
+            snprintf(entry->frame, sizeof(entry->frame), "%02u", left);
+        }
+        break;
+    }
+    default:
+        return false;
+    }
+    entry->step++;
+    return true;
+}
+
+static void _dsFPDAnimShowOwner(bool force)
+{
+    if ((animOwner < 0) || (NULL == animDraw)) {
+        return;
+    }
+    const char *frame = animEntries[animOwner].frame;
+    if (!force && (0 == strcmp(frame, animShown))) {
+        return;
+    }
+    if (animDraw(frame)) {
+        snprintf(animShown, sizeof(animShown), "%s", frame);
+    } else {
+        /* Not shown, e.g. in clock mode: draw it again next time */
+        animShown[0] = '\0';
+    }
+}
+
+static void _dsFPDAnimUpdateOwner(void)
+{
+    int owner = -1;
+    for (int i = 0; i < DS_FPD_ANIM_MAX; i++) {
+        if (animEntries[i].inUse && ((owner < 0) || (animEntries[i].sequence > animEntries[owner].sequence))) {
+            owner = i;
+        }
+    }
+    animOwner = owner;
+}
+
+static void _dsFPDAnimRemove(int index)
+{
+    animEntries[index].inUse = false;
+    animActive--;
+    if (index == animOwner) {
+        _dsFPDAnimUpdateOwner();
+        animShown[0] = '\0';
+    }
+}
+
+/* The display is no longer covered by an animation */
+static void _dsFPDAnimIdle(void)
+{
+    if (NULL != animIdle) {
+        animIdle();
+    }
+}
+
+/* Show the steps that are due; returns true when the owner's frame changed */
+static bool _dsFPDAnimRun(unsigned long long now)
+{
+    bool ownerChanged = false;
+    for (int i = 0; i < DS_FPD_ANIM_MAX; i++) {
+        dsFPDAnimEntry_t *entry = &animEntries[i];
+        if (!entry->inUse || (entry->dueMs > now)) {
+            continue;
+        }
+        /* Late, e.g. after a stall: skip the missed steps but keep the last one */
+        unsigned int stepMs = entry->animation.stepMs;
+        unsigned long long missed = (now - entry->dueMs) / stepMs;
+        entry->dueMs += (missed + 1) * stepMs;
+        if (missed > 0) {
+            unsigned long long step = entry->step + missed;
+            if ((entry->totalSteps > 0) && (step >= entry->totalSteps)) {
+                step = (entry->step < entry->totalSteps) ? entry->totalSteps - 1 : entry->step;
+            }
+            entry->step = (unsigned int)step;
+        }
+        ownerChanged |= (i == animOwner);
+        if (!_dsFPDAnimRender(entry)) {
+            INT_DEBUG("[%s]: animation %u done\r\n", __FUNCTION__, entry->handle);
+            _dsFPDAnimRemove(i);
+        }
+    }
+    return ownerChanged;
+}
+
+static void *_dsFPDAnimThread(void *arg)
+{
+    (void)arg;
+    struct pollfd fds[2];
+    fds[0].fd = animTimerFd;
+    fds[0].events = POLLIN;
+    fds[1].fd = animWakeFd;
+    fds[1].events = POLLIN;
+
+    for (;;) {
+        if (poll(fds, 2, -1) < 0) {
+            if (EINTR == errno) {
+                continue;
+            }
+            INT_ERROR("[%s]: poll failed, errno %d\r\n", __FUNCTION__, errno);
+            break;
+        }
+        if (fds[1].revents & POLLIN) {
+            break;
+        }
+        if (!(fds[0].revents & POLLIN)) {
+            continue;
+        }
+        uint64_t expirations = 0;
+        if ((ssize_t)sizeof(expirations) != read(animTimerFd, &expirations, sizeof(expirations))) {
+            continue;
+        }
+
+        pthread_mutex_lock(&animLock);
+        /* The timer fired, so it is no longer armed */
+        animArmedMs = 0;
+        if (_dsFPDAnimRun(_dsFPDAnimNowMs())) {
+            if (0 == animActive) {
+                _dsFPDAnimIdle();
+            } else {
+                _dsFPDAnimShowOwner(false);
+            }
+        }
+        _dsFPDAnimArm();
+        pthread_mutex_unlock(&animLock);
+    }
+    return NULL;
+}
+
+static bool _dsFPDAnimStartThread(void)
+{
+    if (animThreadRunning) {
+        return true;
+    }
+    animTimerFd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+    animWakeFd = eventfd(0, EFD_CLOEXEC);
+    if ((animTimerFd < 0) || (animWakeFd < 0)) {
+        INT_ERROR("[%s]: cannot create the animation timer, errno %d\r\n", __FUNCTION__, errno);
+    } else if (0 != pthread_create(&animThread, NULL, _dsFPDAnimThread, NULL)) {
+        INT_ERROR("[%s]: cannot start the animation thread\r\n", __FUNCTION__);
+    } else {
+        animArmedMs = 0;
+        animThreadRunning = true;
+        return true;
+    }
+    if (animTimerFd >= 0) {
+        close(animTimerFd);
+    }
+    if (animWakeFd >= 0) {
+        close(animWakeFd);
+    }
+    animTimerFd = animWakeFd = -1;
+    return false;
+}
+
+/* Steps of all passes, 0 (until cancelled) for 0 passes; saturated instead of wrapping */
+static unsigned int _dsFPDAnimSteps(unsigned long long perPass, unsigned int iterations)
+{
+    unsigned long long steps = perPass * iterations;
+    return (steps > UINT_MAX) ? UINT_MAX : (unsigned int)steps;
+}
+
+static bool _dsFPDAnimValid(const dsFPDAnimation_t *animation, unsigned int *totalSteps)
+{
+    if (animation->nFrames > DS_FPD_ANIM_FRAMES_MAX) {
+        return false;
+    }
+    for (unsigned int i = 0; i < animation->nFrames; i++) {
+        if (NULL == memchr(animation->frames[i], '\0', DS_FPD_ANIM_TEXT_MAX)) {
+            return false;
+        }
+    }
+
+    switch (animation->type) {
+    case dsFPD_ANIM_FRAMES:
+        *totalSteps = _dsFPDAnimSteps(animation->nFrames, animation->iterations);
+        return (animation->nFrames > 0) && (animation->stepMs > 0);
+    case dsFPD_ANIM_SCROLL:
+        if ((animation->nFrames < 1) || (0 == animation->stepMs) || (0 == animation->width) ||
+            (animation->width >= DS_FPD_ANIM_TEXT_MAX) || ('\0' == animation->frames[0][0])) {
+            return false;
+        }
+        *totalSteps = _dsFPDAnimSteps(strlen(animation->frames[0]) + animation->width - 1, animation->iterations);
+        return true;
+    case dsFPD_ANIM_BLINK:
+        *totalSteps = _dsFPDAnimSteps(animation->blinkSteps, animation->iterations);
+        return (animation->nFrames >= 1) && (animation->stepMs > 0) &&
+               (animation->blinkSteps > 0) && (animation->blinkSteps <= 32);
+    case dsFPD_ANIM_COUNTDOWN:
+        /* Down to and including 0; longer than 99:59 does not fit */
+        *totalSteps = animation->countdownSec + 1;
+        return (animation->countdownSec > 0) && (animation->countdownSec < 6000);
+    default:
+        return false;
+    }
+}
+
+static dsError_t _dsFPDAnimCancel(unsigned int handle, bool handBack)
+{
+    dsError_t result = (0 == handle) ? dsERR_NONE : dsERR_INVALID_PARAM;
+
+    pthread_mutex_lock(&animLock);
+    int owner = animOwner;
+    for (int i = 0; i < DS_FPD_ANIM_MAX; i++) {
+        if (animEntries[i].inUse && ((0 == handle) || (animEntries[i].handle == handle))) {
+            _dsFPDAnimRemove(i);
+            result = dsERR_NONE;
+        }
+    }
+    if (owner != animOwner) {
+        if (animOwner >= 0) {
+            _dsFPDAnimShowOwner(true);
+        } else if (handBack) {
+            _dsFPDAnimIdle();
+        }
+    }
+    _dsFPDAnimArm();
+    pthread_mutex_unlock(&animLock);
+    return result;
+}
+
+void dsFPDAnimInit(dsFPDAnimDrawFn draw, dsFPDAnimIdleFn idle)
+{
+    pthread_mutex_lock(&animLock);
+    animDraw = draw;
+    animIdle = idle;
+    pthread_mutex_unlock(&animLock);
+}
+
+void dsFPDAnimTerm(void)
+{
+    _dsFPDAnimCancel(0, false);
+
+    pthread_mutex_lock(&animLock);
+    bool running = animThreadRunning;
+    animThreadRunning = false;
+    pthread_mutex_unlock(&animLock);
+    if (!running) {
+        return;
+    }
+
+    uint64_t one = 1;
+    if ((ssize_t)sizeof(one) != write(animWakeFd, &one, sizeof(one))) {
+        INT_ERROR("[%s]: cannot wake the animation thread\r\n", __FUNCTION__);
+    }
+    pthread_join(animThread, NULL);
+
+    pthread_mutex_lock(&animLock);
+    close(animTimerFd);
+    close(animWakeFd);
+    animTimerFd = animWakeFd = -1;
+    animArmedMs = 0;
+    pthread_mutex_unlock(&animLock);
+}
+
+dsError_t dsFPDAnimSubmit(const dsFPDAnimation_t *animation, unsigned int *handle)
+{
+    unsigned int totalSteps = 0;
+    if ((NULL == animation) || (NULL == handle) || !_dsFPDAnimValid(animation, &totalSteps)) {
+        return dsERR_INVALID_PARAM;
+    }
+
+    pthread_mutex_lock(&animLock);
+    int index = -1;
+    for (int i = 0; (i < DS_FPD_ANIM_MAX) && (index < 0); i++) {
+        if (!animEntries[i].inUse) {
+            index = i;
+        }
+    }
+    if ((index < 0) || !_dsFPDAnimStartThread()) {
+        pthread_mutex_unlock(&animLock);
+        INT_ERROR("[%s]: cannot start another animation\r\n", __FUNCTION__);
+        return dsERR_RESOURCE_NOT_AVAILABLE;
+    }
+
+    dsFPDAnimEntry_t *entry = &animEntries[index];
+    memset(entry, 0, sizeof(*entry));
+    entry->inUse = true;
+    entry->animation = *animation;
+    if (dsFPD_ANIM_COUNTDOWN == animation->type) {
+        entry->animation.stepMs = 1000;
+        entry->animation.nFrames = 0;
+    }
+    entry->totalSteps = totalSteps;
+    entry->handle = animNextHandle++;
+    if (0 == animNextHandle) {
+        animNextHandle = 1;
+    }
+    entry->sequence = animNextSequence++;
+    animActive++;
+
+    _dsFPDAnimRender(entry);
+    entry->dueMs = _dsFPDAnimNowMs() + entry->animation.stepMs;
+    _dsFPDAnimArm();
+    animOwner = index;
+    _dsFPDAnimShowOwner(true);
+    *handle = entry->handle;
+    pthread_mutex_unlock(&animLock);
+
+    INT_INFO("[%s]: animation %u type %d started\r\n", __FUNCTION__, *handle, animation->type);
+    return dsERR_NONE;
+}
+
+dsError_t dsFPDAnimCancel(unsigned int handle)
+{
+    return _dsFPDAnimCancel(handle, true);
+}
+
+void dsFPDAnimStop(void)
+{
+    _dsFPDAnimCancel(0, false);
+}
+
+void dsFPDAnimRedraw(void)
+{
+    pthread_mutex_lock(&animLock);
+    _dsFPDAnimShowOwner(true);
+    pthread_mutex_unlock(&animLock);
+}
+
+
+/** @} */
+/** @} */
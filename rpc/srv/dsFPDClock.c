@@ -0,0 +1,203 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2025 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+
+/**
+* @defgroup devicesettings
+* @{
+* @defgroup rpc
+* @{
+**/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <poll.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include "dsFPDClock.h"
+#include "dsserverlogger.h"
+
+static pthread_mutex_t clockLock = PTHREAD_MUTEX_INITIALIZER;
+static dsFPDClockDrawFn clockDraw = NULL;
+static pthread_t clockThread;
+static bool clockRunning = false;
+static bool clockStopping = false;
+static int clockTimerFd = -1;
+static int clockWakeFd = -1;
+
+/* Expire on every minute boundary of the wall clock, and when it is set */
+static void _dsFPDClockArm(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_REALTIME, &now);
+
+    struct itimerspec spec;
+    memset(&spec, 0, sizeof(spec));
+    spec.it_value.tv_sec = (now.tv_sec / 60 + 1) * 60;
+    spec.it_interval.tv_sec = 60;
+    if (0 != timerfd_settime(clockTimerFd, TFD_TIMER_ABSTIME | TFD_TIMER_CANCEL_ON_SET, &spec, NULL)) {
+        INT_ERROR("[%s]: timerfd_settime failed, errno %d\r\n", __FUNCTION__, errno);
+    }
+}
+
+static void _dsFPDClockDraw(void)
+{
+    /* Rounded, as time() may still be in the previous second when the timer expires */
+    struct timespec precise;
+    clock_gettime(CLOCK_REALTIME, &precise);
+    time_t now = precise.tv_sec + ((precise.tv_nsec >= 500000000L) ? 1 : 0);
+    struct tm local;
+    /* localtime_r() need not do this; it picks up a changed /etc/localtime */
+    tzset();
+    if (NULL == localtime_r(&now, &local)) {
+        return;
+    }
+    if (clockDraw(local.tm_hour, local.tm_min)) {
+        INT_DEBUG("[%s]: %02d:%02d\r\n", __FUNCTION__, local.tm_hour, local.tm_min);
+    }
+}
+
+static void *_dsFPDClockThread(void *arg)
+{
+    (void)arg;
+    struct pollfd fds[2];
+    fds[0].fd = clockTimerFd;
+    fds[0].events = POLLIN;
+    fds[1].fd = clockWakeFd;
+    fds[1].events = POLLIN;
+
+    _dsFPDClockArm();
+    _dsFPDClockDraw();
+    for (;;) {
+        if (poll(fds, 2, -1) < 0) {
+            if (EINTR == errno) {
+                continue;
+            }
+            INT_ERROR("[%s]: poll failed, errno %d\r\n", __FUNCTION__, errno);
+            break;
+        }
+        uint64_t count = 0;
+        if (fds[1].revents & POLLIN) {
+            if ((ssize_t)sizeof(count) != read(clockWakeFd, &count, sizeof(count))) {
+                continue;
+            }
+            pthread_mutex_lock(&clockLock);
+            bool stopping = clockStopping;
+            pthread_mutex_unlock(&clockLock);
+            if (stopping) {
+                break;
+            }
+            _dsFPDClockDraw();
+        }
+        if (fds[0].revents & POLLIN) {
+            if ((read(clockTimerFd, &count, sizeof(count)) < 0) && (ECANCELED == errno)) {
+                INT_INFO("[%s]: system time was set, realigning the clock\r\n", __FUNCTION__);
+                _dsFPDClockArm();
+            }
+            _dsFPDClockDraw();
+        }
+    }
+    return NULL;
+}
+
+int dsFPDClockStart(dsFPDClockDrawFn draw)
+{
+    pthread_mutex_lock(&clockLock);
+    if (clockRunning) {
+        pthread_mutex_unlock(&clockLock);
+        return 0;
+    }
+    clockDraw = draw;
+    clockStopping = false;
+    clockTimerFd = timerfd_create(CLOCK_REALTIME, TFD_CLOEXEC);
+    clockWakeFd = eventfd(0, EFD_CLOEXEC);
+    if ((clockTimerFd >= 0) && (clockWakeFd >= 0) &&
+        (0 == pthread_create(&clockThread, NULL, _dsFPDClockThread, NULL))) {
+        clockRunning = true;
+        pthread_mutex_unlock(&clockLock);
+        const char *zone = getenv("TZ");
+        if ((NULL != zone) && ('\0' != zone[0])) {
+            INT_INFO("[%s]: front panel clock started, TZ=%s overrides /etc/localtime\r\n", __FUNCTION__, zone);
+        } else {
+            INT_INFO("[%s]: front panel clock started in the /etc/localtime zone\r\n", __FUNCTION__);
+        }
+        return 0;
+    }
+
+    INT_ERROR("[%s]: cannot start the front panel clock, errno %d\r\n", __FUNCTION__, errno);
+    if (clockTimerFd >= 0) {
+        close(clockTimerFd);
+    }
+    if (clockWakeFd >= 0) {
+        close(clockWakeFd);
+    }
+    clockTimerFd = clockWakeFd = -1;
+    pthread_mutex_unlock(&clockLock);
+    return -1;
+}
+
+static void _dsFPDClockWake(void)
+{
+    uint64_t one = 1;
+    if ((ssize_t)sizeof(one) != write(clockWakeFd, &one, sizeof(one))) {
+        INT_ERROR("[%s]: cannot wake the clock thread\r\n", __FUNCTION__);
+    }
+}
+
+void dsFPDClockStop(void)
+{
+    pthread_mutex_lock(&clockLock);
+    if (!clockRunning) {
+        pthread_mutex_unlock(&clockLock);
+        return;
+    }
+    clockStopping = true;
+    _dsFPDClockWake();
+    pthread_mutex_unlock(&clockLock);
+
+    pthread_join(clockThread, NULL);
+
+    pthread_mutex_lock(&clockLock);
+    close(clockTimerFd);
+    close(clockWakeFd);
+    clockTimerFd = clockWakeFd = -1;
+    clockRunning = false;
+    pthread_mutex_unlock(&clockLock);
+}
+
+void dsFPDClockRefresh(void)
+{
+    /* Drawn by the clock thread, so callers may hold their own locks */
+    pthread_mutex_lock(&clockLock);
+    if (clockRunning && !clockStopping) {
+        _dsFPDClockWake();
+    }
+    pthread_mutex_unlock(&clockLock);
+}
+
+
+/** @} */
+/** @} */
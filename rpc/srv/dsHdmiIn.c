@@ -54,6 +54,8 @@
 **/
 
 
+#define DS_LOG_MODULE dsLOG_MODULE_HDMIIN
+
 #include <stdio.h>
 #include <string.h>
 #include <unistd.h>
@@ -67,6 +69,9 @@
 #include "dsTypes.h"
 #include "dsserverlogger.h"
 #include "dsMgr.h"
+#include "dsPerfStats.h"
+#include "dsEventTrace.h"
+#include "dsAVLatencyFilter.h"
 
 #include "iarmUtil.h"
 #include "libIARM.h"
@@ -77,11 +82,17 @@
 #include "dsInternal.h"
 
 #define direct_list_top(list) ((list))
-#define IARM_BUS_Lock(lock) pthread_mutex_lock(&fpLock)
-#define IARM_BUS_Unlock(lock) pthread_mutex_unlock(&fpLock)
+#define IARM_BUS_Lock(lock) dsPerfMutexLock(&fpLock)
+#define IARM_BUS_Unlock(lock) dsPerfMutexUnlock(&fpLock)
 #define TVSETTINGS_DALS_RFC_PARAM "Device.DeviceInfo.X_RDKCENTRAL-COM_RFC.Feature.TvSettings.DynamicAutoLatency"
+#define TVSETTINGS_DALS_MIN_CHANGE_RFC_PARAM TVSETTINGS_DALS_RFC_PARAM ".MinChangeMs"
+#define TVSETTINGS_DALS_SETTLE_RFC_PARAM TVSETTINGS_DALS_RFC_PARAM ".SettleMs"
+#define TVSETTINGS_DALS_MIN_INTERVAL_RFC_PARAM TVSETTINGS_DALS_RFC_PARAM ".MinIntervalMs"
 
 static bool isDalsEnabled = false;
+static dsAVLatencyFilterConfig_t avLatencyFilterConfig = {
+    DS_AVLATENCY_MIN_CHANGE_MS, DS_AVLATENCY_SETTLE_MS, DS_AVLATENCY_MIN_INTERVAL_MS
+};
 static int m_isInitialized = 0;
 static int m_isPlatInitialized=0;
 static pthread_mutex_t fpLock = PTHREAD_MUTEX_INITIALIZER;
@@ -90,6 +101,29 @@ static bool m_edidallmsupport[dsHDMI_IN_PORT_MAX];
 static bool m_vrrsupport[dsHDMI_IN_PORT_MAX];
 static bool m_hdmiPortVrrCaps[dsHDMI_IN_PORT_MAX];
 static uint8_t noOfSupportedHdmiInputs;
+/* Snapshot served by dsHdmiInGetAllPortsStatus; statusLock is taken after fpLock, never before */
+static pthread_mutex_t statusLock = PTHREAD_MUTEX_INITIALIZER;
+static dsHdmiInAllPortsStatus_t m_allPortsStatus;
+
+/*
+ * EDID and SPD infoframe of each port as last read from the HAL. The EDID
+ * only changes through our own EDID setters and the SPD only on hotplug or
+ * signal change; each invalidation bumps the generation so that a read
+ * racing with it is not cached. cacheLock is taken after fpLock, never before.
+ */
+typedef struct _dsHdmiInBlobCache_t
+{
+    unsigned int edidGeneration;
+    bool edidValid;
+    int edidLength;
+    unsigned char edid[MAX_EDID_BYTES_LEN];
+    unsigned int spdGeneration;
+    bool spdValid;
+    unsigned char spd[sizeof(struct dsSpd_infoframe_st)];
+} _dsHdmiInBlobCache_t;
+
+static pthread_mutex_t cacheLock = PTHREAD_MUTEX_INITIALIZER;
+static _dsHdmiInBlobCache_t m_blobCache[dsHDMI_IN_PORT_MAX];
 IARM_Result_t dsHdmiInMgr_init();
 IARM_Result_t dsHdmiInMgr_term();
 IARM_Result_t _dsHdmiInInit(void *arg);
@@ -117,10 +151,16 @@ IARM_Result_t _dsSetVRRSupport (void *arg);
 IARM_Result_t _dsGetVRRSupport (void *arg);
 IARM_Result_t _dsGetVRRStatus (void *arg);
 IARM_Result_t _dsGetHdmiVersion (void *arg);
+IARM_Result_t _dsHdmiInGetAllPortsStatus (void *arg);
 
 static dsError_t setEdid2AllmSupport (dsHdmiInPort_t iHdmiPort, bool allmSupport);
 static dsError_t setVRRSupport (dsHdmiInPort_t iHdmiPort, bool vrrSupport);
 static dsError_t getVRRSupport (dsHdmiInPort_t iHdmiPort, bool *vrrSupport);
+static void _dsHdmiInSeedAllPortsStatus(void);
+static void _dsHdmiInSyncPortConfig(dsHdmiInPort_t port);
+static void _dsHdmiInSyncActivePort(void);
+static void _dsHdmiInInvalidateEdid(dsHdmiInPort_t port);
+static void _dsHdmiInInvalidateSpd(dsHdmiInPort_t port);
 void _dsHdmiInConnectCB(dsHdmiInPort_t port, bool isPortConnected);
 void _dsHdmiInSignalChangeCB(dsHdmiInPort_t port, dsHdmiInSignalStatus_t sigStatus);
 void _dsHdmiInStatusChangeCB(dsHdmiInStatus_t inputStatus);
@@ -129,6 +169,7 @@ void _dsHdmiInAllmChangeCB(dsHdmiInPort_t port, bool allm_mode);
 void _dsHdmiInVRRChangeCB(dsHdmiInPort_t port, dsVRRType_t vrr_type);
 void _dsHdmiInAviContentTypeChangeCB(dsHdmiInPort_t port, dsAviContentType_t content_type);
 void _dsHdmiInAVLatencyChangeCB(int audio_latency, int video_latency);
+static void _dsHdmiInAVLatencyPublish(int audio_latency, int video_latency);
 
 static dsHdmiInCap_t hdmiInCap_gs;
 
@@ -151,6 +192,25 @@ void getDynamicAutoLatencyConfig()
      else {
          INT_ERROR("Fetching RFC for DALS failed or DALS is disabled\n");
      }
+
+     // Filter applied to the AV latency updates before they are broadcast
+     const struct {
+         const char *name;
+         unsigned int *value;
+     } filterParams[] = {
+         { TVSETTINGS_DALS_MIN_CHANGE_RFC_PARAM, &avLatencyFilterConfig.minChangeMs },
+         { TVSETTINGS_DALS_SETTLE_RFC_PARAM, &avLatencyFilterConfig.settleMs },
+         { TVSETTINGS_DALS_MIN_INTERVAL_RFC_PARAM, &avLatencyFilterConfig.minIntervalMs },
+     };
+     for (size_t i = 0; i < sizeof(filterParams) / sizeof(filterParams[0]); i++) {
+         RFC_ParamData_t filterParam = {0};
+         if ((WDMP_SUCCESS == getRFCParameter((char*)"dssrv", filterParams[i].name, &filterParam)) &&
+             (filterParam.value[0] >= '0') && (filterParam.value[0] <= '9')) {
+             *filterParams[i].value = (unsigned int)strtoul(filterParam.value, NULL, 10);
+         }
+     }
+     INT_INFO("AV latency filter: min change %u ms, settle %u ms, min interval %u ms\n",
+              avLatencyFilterConfig.minChangeMs, avLatencyFilterConfig.settleMs, avLatencyFilterConfig.minIntervalMs);
 }
 
 static dsError_t isHdmiARCPort (int iPort, bool* isArcEnabled) {
@@ -279,6 +339,7 @@ static dsError_t setEdidVersion (dsHdmiInPort_t iHdmiPort, tv_hdmi_edid_version_
     if (0 != dsSetEdidVersionFunc) {
         eRet = dsSetEdidVersionFunc (iHdmiPort, iEdidVersion);
         if (eRet == dsERR_NONE) {
+           _dsHdmiInInvalidateEdid(iHdmiPort);
            int port_no = (int)iHdmiPort;
 			if((port_no  >= 0) && (port_no < noOfSupportedHdmiInputs))
 			{
@@ -469,13 +530,14 @@ IARM_Result_t dsHdmiInMgr_init()
 {
     _dsHdmiInInit(NULL);
 
-    IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsHdmiInInit, _dsHdmiInInit);
+    dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsHdmiInInit, _dsHdmiInInit);
     return IARM_RESULT_SUCCESS;
 }
 
 IARM_Result_t dsHdmiInMgr_term()
 {
     _dsHdmiInTerm(NULL);
+    dsAVLatencyFilterStop();
     return IARM_RESULT_SUCCESS;
 }
 
@@ -486,6 +548,7 @@ IARM_Result_t _dsHdmiInInit(void *arg)
                    __PRETTY_FUNCTION__,__LINE__, m_isInitialized, m_isPlatInitialized);
 
     getDynamicAutoLatencyConfig();
+    dsAVLatencyFilterStart(&avLatencyFilterConfig, _dsHdmiInAVLatencyPublish);
 
     if (PROFILE_TV == profileType)
     {
@@ -645,26 +708,27 @@ IARM_Result_t _dsHdmiInInit(void *arg)
     
         }
 
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsHdmiInTerm,                  _dsHdmiInTerm);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsHdmiInGetNumberOfInputs,     _dsHdmiInGetNumberOfInputs);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsHdmiInGetStatus,             _dsHdmiInGetStatus);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsHdmiInSelectPort,            _dsHdmiInSelectPort);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsHdmiInScaleVideo,            _dsHdmiInScaleVideo);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsHdmiInSelectZoomMode,        _dsHdmiInSelectZoomMode);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsHdmiInGetCurrentVideoMode,   _dsHdmiInGetCurrentVideoMode);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetEDIDBytesInfo,              _dsGetEDIDBytesInfo);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetHDMISPDInfo,              _dsGetHDMISPDInfo);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetEdidVersion,              _dsSetEdidVersion);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetEdidVersion,              _dsGetEdidVersion);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetAllmStatus,               _dsGetAllmStatus);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetSupportedGameFeaturesList,_dsGetSupportedGameFeaturesList);
-	IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetAVLatency,  _dsGetAVLatency);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetEdid2AllmSupport,  _dsSetEdid2AllmSupport);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetEdid2AllmSupport,  _dsGetEdid2AllmSupport);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetVRRSupport,  _dsSetVRRSupport);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetVRRSupport,  _dsGetVRRSupport);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetVRRStatus,               _dsGetVRRStatus);
-	IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetHdmiVersion,  _dsGetHdmiVersion);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsHdmiInTerm,                  _dsHdmiInTerm);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsHdmiInGetNumberOfInputs,     _dsHdmiInGetNumberOfInputs);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsHdmiInGetStatus,             _dsHdmiInGetStatus);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsHdmiInSelectPort,            _dsHdmiInSelectPort);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsHdmiInScaleVideo,            _dsHdmiInScaleVideo);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsHdmiInSelectZoomMode,        _dsHdmiInSelectZoomMode);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsHdmiInGetCurrentVideoMode,   _dsHdmiInGetCurrentVideoMode);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetEDIDBytesInfo,              _dsGetEDIDBytesInfo);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetHDMISPDInfo,              _dsGetHDMISPDInfo);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetEdidVersion,              _dsSetEdidVersion);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetEdidVersion,              _dsGetEdidVersion);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetAllmStatus,               _dsGetAllmStatus);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetSupportedGameFeaturesList,_dsGetSupportedGameFeaturesList);
+	dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetAVLatency,  _dsGetAVLatency);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetEdid2AllmSupport,  _dsSetEdid2AllmSupport);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetEdid2AllmSupport,  _dsGetEdid2AllmSupport);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetVRRSupport,  _dsSetVRRSupport);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetVRRSupport,  _dsGetVRRSupport);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetVRRStatus,               _dsGetVRRStatus);
+	dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetHdmiVersion,  _dsGetHdmiVersion);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsHdmiInGetAllPortsStatus,     _dsHdmiInGetAllPortsStatus);
 
         int itr = 0;
         bool isARCCapable = false;
@@ -763,6 +827,7 @@ IARM_Result_t _dsHdmiInInit(void *arg)
                 INT_INFO("Port HDMI%d: Initialized EDID Version : %d\n", itr, m_edidversion[itr]);
             }
         }
+        _dsHdmiInSeedAllPortsStatus();
         m_isInitialized = 1;
     }
 
@@ -786,6 +851,10 @@ IARM_Result_t _dsHdmiInTerm(void *arg)
             if (!m_isPlatInitialized)
             {
                 dsHdmiInTerm();
+                for (int i = 0; i < dsHDMI_IN_PORT_MAX; i++) {
+                    _dsHdmiInInvalidateEdid(static_cast<dsHdmiInPort_t>(i));
+                    _dsHdmiInInvalidateSpd(static_cast<dsHdmiInPort_t>(i));
+                }
             }
         }
     }
@@ -854,6 +923,10 @@ IARM_Result_t _dsHdmiInSelectPort(void *arg)
     {
         INT_INFO("[%d][%s]: its TV Profile\r\n", __LINE__, __FUNCTION__);
         param->result = dsHdmiInSelectPort(param->port,param->requestAudioMix, param->videoPlaneType,param->topMostPlane);
+        if (dsERR_NONE == param->result) {
+            /* Not every HAL reports the new active port through the status callback */
+            _dsHdmiInSyncActivePort();
+        }
     }
     else
     {
@@ -938,12 +1011,28 @@ IARM_Result_t _dsHdmiInGetCurrentVideoMode(void *arg)
 void _dsHdmiInConnectCB(dsHdmiInPort_t port, bool isPortConnected)
 {
     IARM_Bus_DSMgr_EventData_t hdmi_in_hpd_eventData;
+    dsEventTraceRecord(dsEVENT_TRACE_HAL_CALLBACK, IARM_BUS_DSMGR_EVENT_HDMI_IN_HOTPLUG, port);
  
     INT_INFO("%s:%d - HDMI In hotplug update!!!!!!..Port: %d, isPort: %d\r\n",__PRETTY_FUNCTION__,__LINE__, port, isPortConnected);
     hdmi_in_hpd_eventData.data.hdmi_in_connect.port = port;
     hdmi_in_hpd_eventData.data.hdmi_in_connect.isPortConnected = isPortConnected;
+
+    _dsHdmiInInvalidateSpd(port);
+    if ((port >= 0) && (port < dsHDMI_IN_PORT_MAX)) {
+        pthread_mutex_lock(&statusLock);
+        dsHdmiInPortStatus_t *portStatus = &m_allPortsStatus.ports[port];
+        portStatus->isConnected = isPortConnected;
+        if (!isPortConnected) {
+            /* Nothing is received from an unplugged source */
+            portStatus->signalStatus = dsHDMI_IN_SIGNAL_STATUS_NOSIGNAL;
+            portStatus->allmMode = false;
+            portStatus->vrrType = dsVRR_NONE;
+            portStatus->aviContentType = dsAVICONTENT_TYPE_NOT_SIGNALLED;
+        }
+        pthread_mutex_unlock(&statusLock);
+    }
 			
-    IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,
+    dsMgr_BroadcastEvent(
 	                        (IARM_EventId_t)IARM_BUS_DSMGR_EVENT_HDMI_IN_HOTPLUG,
 	                        (void *)&hdmi_in_hpd_eventData, 
 	                        sizeof(hdmi_in_hpd_eventData));
@@ -953,12 +1042,20 @@ void _dsHdmiInConnectCB(dsHdmiInPort_t port, bool isPortConnected)
 void _dsHdmiInSignalChangeCB(dsHdmiInPort_t port, dsHdmiInSignalStatus_t sigStatus)
 {
     IARM_Bus_DSMgr_EventData_t hdmi_in_sigStatus_eventData;
+    dsEventTraceRecord(dsEVENT_TRACE_HAL_CALLBACK, IARM_BUS_DSMGR_EVENT_HDMI_IN_SIGNAL_STATUS, port);
 
     INT_INFO("%s:%d - HDMI In signal status change update!!!!!! Port: %d, Signal Status: %d\r\n", __PRETTY_FUNCTION__,__LINE__,port, sigStatus);
     hdmi_in_sigStatus_eventData.data.hdmi_in_sig_status.port = port;
     hdmi_in_sigStatus_eventData.data.hdmi_in_sig_status.status = sigStatus;
 
-    IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,
+    _dsHdmiInInvalidateSpd(port);
+    if ((port >= 0) && (port < dsHDMI_IN_PORT_MAX)) {
+        pthread_mutex_lock(&statusLock);
+        m_allPortsStatus.ports[port].signalStatus = sigStatus;
+        pthread_mutex_unlock(&statusLock);
+    }
+
+    dsMgr_BroadcastEvent(
 			        (IARM_EventId_t)IARM_BUS_DSMGR_EVENT_HDMI_IN_SIGNAL_STATUS,
 			        (void *)&hdmi_in_sigStatus_eventData,
 			        sizeof(hdmi_in_sigStatus_eventData));
@@ -968,12 +1065,21 @@ void _dsHdmiInSignalChangeCB(dsHdmiInPort_t port, dsHdmiInSignalStatus_t sigStat
 void _dsHdmiInStatusChangeCB(dsHdmiInStatus_t inputStatus)
 {
     IARM_Bus_DSMgr_EventData_t hdmi_in_status_eventData;
+    dsEventTraceRecord(dsEVENT_TRACE_HAL_CALLBACK, IARM_BUS_DSMGR_EVENT_HDMI_IN_STATUS, inputStatus.activePort);
 
     INT_INFO("%s:%d - HDMI In status change update!!!!!! Port: %d, isPresented: %d\r\n", __PRETTY_FUNCTION__,__LINE__, inputStatus.activePort, inputStatus.isPresented);
     hdmi_in_status_eventData.data.hdmi_in_status.port = inputStatus.activePort;
     hdmi_in_status_eventData.data.hdmi_in_status.isPresented = inputStatus.isPresented;
 
-    IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,
+    pthread_mutex_lock(&statusLock);
+    m_allPortsStatus.activePort = inputStatus.activePort;
+    m_allPortsStatus.isPresented = inputStatus.isPresented;
+    for (int i = 0; i < dsHDMI_IN_PORT_MAX; i++) {
+        m_allPortsStatus.ports[i].isConnected = inputStatus.isPortConnected[i];
+    }
+    pthread_mutex_unlock(&statusLock);
+
+    dsMgr_BroadcastEvent(
                                 (IARM_EventId_t)IARM_BUS_DSMGR_EVENT_HDMI_IN_STATUS,
                                 (void *)&hdmi_in_status_eventData,
                                 sizeof(hdmi_in_status_eventData));
@@ -983,6 +1089,7 @@ void _dsHdmiInStatusChangeCB(dsHdmiInStatus_t inputStatus)
 void _dsHdmiInVideoModeUpdateCB(dsHdmiInPort_t port, dsVideoPortResolution_t videoResolution)
 {
     IARM_Bus_DSMgr_EventData_t hdmi_in_videoMode_eventData;
+    dsEventTraceRecord(dsEVENT_TRACE_HAL_CALLBACK, IARM_BUS_DSMGR_EVENT_HDMI_IN_VIDEO_MODE_UPDATE, port);
 
     INT_INFO("%s:%d - HDMI In video mode info  update, Port: %d, Pixel Resolution: %d, Interlaced: %d, Frame Rate: %d \n", __PRETTY_FUNCTION__,__LINE__,port, videoResolution.pixelResolution, videoResolution.interlaced, videoResolution.frameRate);
     hdmi_in_videoMode_eventData.data.hdmi_in_video_mode.port = port;
@@ -990,8 +1097,14 @@ void _dsHdmiInVideoModeUpdateCB(dsHdmiInPort_t port, dsVideoPortResolution_t vid
     hdmi_in_videoMode_eventData.data.hdmi_in_video_mode.resolution.interlaced = videoResolution.interlaced;
     hdmi_in_videoMode_eventData.data.hdmi_in_video_mode.resolution.frameRate = videoResolution.frameRate;
 
+    if ((port >= 0) && (port < dsHDMI_IN_PORT_MAX)) {
+        pthread_mutex_lock(&statusLock);
+        m_allPortsStatus.ports[port].resolution = videoResolution;
+        pthread_mutex_unlock(&statusLock);
+    }
+
 
-    IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,
+    dsMgr_BroadcastEvent(
                                 (IARM_EventId_t)IARM_BUS_DSMGR_EVENT_HDMI_IN_VIDEO_MODE_UPDATE,
                                 (void *)&hdmi_in_videoMode_eventData,
                                 sizeof(hdmi_in_videoMode_eventData));
@@ -1001,12 +1114,19 @@ void _dsHdmiInVideoModeUpdateCB(dsHdmiInPort_t port, dsVideoPortResolution_t vid
 void _dsHdmiInAllmChangeCB(dsHdmiInPort_t port, bool allm_mode)
 {
     IARM_Bus_DSMgr_EventData_t hdmi_in_allmMode_eventData;
+    dsEventTraceRecord(dsEVENT_TRACE_HAL_CALLBACK, IARM_BUS_DSMGR_EVENT_HDMI_IN_ALLM_STATUS, port);
 
     INT_INFO("%s:%d - HDMI In ALLM Mode update!!!!!! Port: %d, ALLM Mode: %d\r\n", __FUNCTION__,__LINE__,port, allm_mode);
     hdmi_in_allmMode_eventData.data.hdmi_in_allm_mode.port = port;
     hdmi_in_allmMode_eventData.data.hdmi_in_allm_mode.allm_mode = allm_mode;
 
-    IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,
+    if ((port >= 0) && (port < dsHDMI_IN_PORT_MAX)) {
+        pthread_mutex_lock(&statusLock);
+        m_allPortsStatus.ports[port].allmMode = allm_mode;
+        pthread_mutex_unlock(&statusLock);
+    }
+
+    dsMgr_BroadcastEvent(
                                 (IARM_EventId_t)IARM_BUS_DSMGR_EVENT_HDMI_IN_ALLM_STATUS,
                                 (void *)&hdmi_in_allmMode_eventData,
                                 sizeof(hdmi_in_allmMode_eventData));
@@ -1016,12 +1136,19 @@ void _dsHdmiInAllmChangeCB(dsHdmiInPort_t port, bool allm_mode)
 void _dsHdmiInVRRChangeCB(dsHdmiInPort_t port, dsVRRType_t vrr_type)
 {
     IARM_Bus_DSMgr_EventData_t hdmi_in_vrrMode_eventData;
+    dsEventTraceRecord(dsEVENT_TRACE_HAL_CALLBACK, IARM_BUS_DSMGR_EVENT_HDMI_IN_VRR_STATUS, port);
 
     INT_INFO("%s:%d - HDMI In VRR Mode update!!!!!! Port: %d, VRR TYPE: %d\r\n", __FUNCTION__,__LINE__,port, vrr_type);
     hdmi_in_vrrMode_eventData.data.hdmi_in_vrr_mode.port = port;
     hdmi_in_vrrMode_eventData.data.hdmi_in_vrr_mode.vrr_type = vrr_type;
 
-    IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,
+    if ((port >= 0) && (port < dsHDMI_IN_PORT_MAX)) {
+        pthread_mutex_lock(&statusLock);
+        m_allPortsStatus.ports[port].vrrType = vrr_type;
+        pthread_mutex_unlock(&statusLock);
+    }
+
+    dsMgr_BroadcastEvent(
                                 (IARM_EventId_t)IARM_BUS_DSMGR_EVENT_HDMI_IN_VRR_STATUS,
                                 (void *)&hdmi_in_vrrMode_eventData,
                                 sizeof(hdmi_in_vrrMode_eventData));
@@ -1031,25 +1158,46 @@ void _dsHdmiInVRRChangeCB(dsHdmiInPort_t port, dsVRRType_t vrr_type)
 void _dsHdmiInAviContentTypeChangeCB(dsHdmiInPort_t port, dsAviContentType_t avi_content_type)
 {
     IARM_Bus_DSMgr_EventData_t hdmi_in_contentType_eventData;
+    dsEventTraceRecord(dsEVENT_TRACE_HAL_CALLBACK, IARM_BUS_DSMGR_EVENT_HDMI_IN_AVI_CONTENT_TYPE, port);
 
     INT_INFO("%s:%d - HDMI In Content Type update!!!!!! Port: %d, content type: %d\r\n", __FUNCTION__,__LINE__,port, avi_content_type);
     hdmi_in_contentType_eventData.data.hdmi_in_content_type.port = port;
     hdmi_in_contentType_eventData.data.hdmi_in_content_type.aviContentType = avi_content_type;
 
-    IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,
+    if ((port >= 0) && (port < dsHDMI_IN_PORT_MAX)) {
+        pthread_mutex_lock(&statusLock);
+        m_allPortsStatus.ports[port].aviContentType = avi_content_type;
+        pthread_mutex_unlock(&statusLock);
+    }
+
+    dsMgr_BroadcastEvent(
                                 (IARM_EventId_t)IARM_BUS_DSMGR_EVENT_HDMI_IN_AVI_CONTENT_TYPE,
                                 (void *)&hdmi_in_contentType_eventData,
                                 sizeof(hdmi_in_contentType_eventData));
 }
 
 void _dsHdmiInAVLatencyChangeCB(int audio_latency, int video_latency)
+{
+    dsEventTraceRecord(dsEVENT_TRACE_HAL_CALLBACK, IARM_BUS_DSMGR_EVENT_HDMI_IN_AV_LATENCY, audio_latency);
+
+    INT_DEBUG("%s:%d - HDMI In AV Latency update from HAL, audio_latency: %d, video latency: %d\r\n", __FUNCTION__,__LINE__,audio_latency,video_latency);
+    /* Broadcast by _dsHdmiInAVLatencyPublish once it passes the filter */
+    dsAVLatencyFilterUpdate(audio_latency, video_latency);
+}
+
+static void _dsHdmiInAVLatencyPublish(int audio_latency, int video_latency)
 {
     IARM_Bus_DSMgr_EventData_t hdmi_in_av_latency_eventData;
 
     hdmi_in_av_latency_eventData.data.hdmi_in_av_latency.audio_output_delay = audio_latency;
     hdmi_in_av_latency_eventData.data.hdmi_in_av_latency.video_latency = video_latency;
+
+    pthread_mutex_lock(&statusLock);
+    m_allPortsStatus.audioLatency = audio_latency;
+    m_allPortsStatus.videoLatency = video_latency;
+    pthread_mutex_unlock(&statusLock);
     INT_INFO("%s:%d - HDMI In AV Latency update!!!!!! audio_latency: %d, video latency: %d\r\n", __FUNCTION__,__LINE__,audio_latency,video_latency);
-    IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,
+    dsMgr_BroadcastEvent(
                                 (IARM_EventId_t)IARM_BUS_DSMGR_EVENT_HDMI_IN_AV_LATENCY,
                                 (void *)&hdmi_in_av_latency_eventData,
                                 sizeof(hdmi_in_av_latency_eventData));
@@ -1062,14 +1210,50 @@ IARM_Result_t _dsGetEDIDBytesInfo (void *arg)
     dsError_t eRet = dsERR_GENERAL;
 
     dsGetEDIDBytesInfoParam_t *param = (dsGetEDIDBytesInfoParam_t *) arg;
-    memset (param->edid, '\0', MAX_EDID_BYTES_LEN);
+    /* Only capacity bytes of param->edid were sent by the caller */
+    int capacity = DS_RPC_VAR_PARAM_CAPACITY(param, edid);
     unsigned char edidArg[MAX_EDID_BYTES_LEN] = {0};
+    int port = (int)param->iHdmiPort;
+    bool cacheable = (port >= 0) && (port < dsHDMI_IN_PORT_MAX);
+    unsigned int generation = 0;
+
+    if (cacheable) {
+        pthread_mutex_lock(&cacheLock);
+        _dsHdmiInBlobCache_t *cache = &m_blobCache[port];
+        if (cache->edidValid) {
+            param->result = dsERR_NONE;
+            param->length = cache->edidLength;
+            if (param->length <= capacity) {
+                rc = memcpy_s(param->edid, capacity, cache->edid, param->length);
+                if(rc!=EOK)
+                {
+                    ERR_CHK(rc);
+                }
+            }
+            pthread_mutex_unlock(&cacheLock);
+            INT_DEBUG("[srv] %s: port %d served from cache\r\n", __FUNCTION__, port);
+            return IARM_RESULT_SUCCESS;
+        }
+        generation = cache->edidGeneration;
+        pthread_mutex_unlock(&cacheLock);
+    }
+
     IARM_BUS_Lock(lock);
     eRet = getEDIDBytesInfo (param->iHdmiPort, edidArg, &(param->length));
     param->result = eRet;
+    if (cacheable && (eRet == dsERR_NONE) && (param->length > 0) && (param->length <= MAX_EDID_BYTES_LEN)) {
+        pthread_mutex_lock(&cacheLock);
+        _dsHdmiInBlobCache_t *cache = &m_blobCache[port];
+        if (generation == cache->edidGeneration) {
+            memcpy(cache->edid, edidArg, param->length);
+            cache->edidLength = param->length;
+            cache->edidValid = true;
+        }
+        pthread_mutex_unlock(&cacheLock);
+    }
     INT_INFO("[srv] %s: getEDIDBytesInfo eRet: %d\r\n", __FUNCTION__, param->result);
-    if (eRet == dsERR_NONE && param->length > 0 && param->length <= MAX_EDID_BYTES_LEN) {//Make sure the result was true, and there is a valid length.
-        rc = memcpy_s(param->edid,sizeof(param->edid), edidArg, param->length);
+    if (eRet == dsERR_NONE && param->length > 0 && param->length <= capacity) {//Make sure the result was true, and there is a valid length.
+        rc = memcpy_s(param->edid,capacity, edidArg, param->length);
         if(rc!=EOK)
         {
 		ERR_CHK(rc);
@@ -1087,14 +1271,54 @@ IARM_Result_t _dsGetHDMISPDInfo(void *arg)
 
     dsGetHDMISPDInfoParam_t *param = (dsGetHDMISPDInfoParam_t *)arg;
 
+    int capacity = DS_RPC_VAR_PARAM_CAPACITY(param, spdInfo);
+    unsigned char spdArg[sizeof(struct dsSpd_infoframe_st)] = {0};
+    int port = (int)param->iHdmiPort;
+    bool cacheable = (port >= 0) && (port < dsHDMI_IN_PORT_MAX);
+    unsigned int generation = 0;
+
+    if (cacheable) {
+        pthread_mutex_lock(&cacheLock);
+        _dsHdmiInBlobCache_t *cache = &m_blobCache[port];
+        if (cache->spdValid) {
+            param->result = dsERR_NONE;
+            param->length = sizeof(struct dsSpd_infoframe_st);
+            if (param->length <= capacity) {
+                rc = memcpy_s(param->spdInfo, capacity, cache->spd, sizeof(struct dsSpd_infoframe_st));
+                if(rc!=EOK)
+                {
+                    ERR_CHK(rc);
+                }
+            }
+            pthread_mutex_unlock(&cacheLock);
+            INT_DEBUG("[srv] %s: port %d served from cache\r\n", __FUNCTION__, port);
+            return IARM_RESULT_SUCCESS;
+        }
+        generation = cache->spdGeneration;
+        pthread_mutex_unlock(&cacheLock);
+    }
+
     IARM_BUS_Lock(lock);
 
-    memset (param->spdInfo, '\0', sizeof(struct dsSpd_infoframe_st));
-    unsigned char spdArg[sizeof(struct dsSpd_infoframe_st)] = {0};
     param->result = getHDMISPDInfo(param->iHdmiPort, spdArg);
+    param->length = sizeof(struct dsSpd_infoframe_st);
+    /* All zeroes: no infoframe from the source yet, so ask the HAL again next time */
+    bool received = false;
+    for (size_t i = 0; (i < sizeof(spdArg)) && !received; i++) {
+        received = (0 != spdArg[i]);
+    }
+    if (cacheable && received && (param->result == dsERR_NONE)) {
+        pthread_mutex_lock(&cacheLock);
+        _dsHdmiInBlobCache_t *cache = &m_blobCache[port];
+        if (generation == cache->spdGeneration) {
+            memcpy(cache->spd, spdArg, sizeof(cache->spd));
+            cache->spdValid = true;
+        }
+        pthread_mutex_unlock(&cacheLock);
+    }
     INT_INFO("[srv] %s: dsGetHDMISPDInfo eRet: %d\r\n", __FUNCTION__, param->result);
-    if (param->result == dsERR_NONE) {
-            rc = memcpy_s(param->spdInfo,sizeof(param->spdInfo), spdArg, sizeof(struct dsSpd_infoframe_st));
+    if ((param->result == dsERR_NONE) && (param->length <= capacity)) {
+            rc = memcpy_s(param->spdInfo,capacity, spdArg, sizeof(struct dsSpd_infoframe_st));
             if(rc!=EOK)
             {
                     ERR_CHK(rc);
@@ -1114,6 +1338,7 @@ IARM_Result_t _dsSetEdidVersion (void *arg)
     IARM_BUS_Lock(lock);
     param->result = setEdidVersion (param->iHdmiPort, param->iEdidVersion);
     m_edidversion[param->iHdmiPort]=param->iEdidVersion;
+    _dsHdmiInSyncPortConfig(param->iHdmiPort);
     INT_INFO("[srv] %s: dsSetEdidVersion Port: %d EDID: %d eRet: %d\r\n", __FUNCTION__, param->iHdmiPort,  param->iEdidVersion, param->result);
     IARM_BUS_Unlock(lock);
     return IARM_RESULT_SUCCESS;
@@ -1223,6 +1448,9 @@ static dsError_t setEdid2AllmSupport (dsHdmiInPort_t iHdmiPort, bool allmSupport
     INT_INFO("setEdid2AllmSupport to ds-hal:  EDID Allm Bit: %d\n", allmSupport);
     if (0 != dsSetEdid2AllmSupportFunc) {
         eRet = dsSetEdid2AllmSupportFunc (iHdmiPort, allmSupport);
+        if (eRet == dsERR_NONE) {
+            _dsHdmiInInvalidateEdid(iHdmiPort);
+        }
         INT_INFO("[srv] %s: dsSetEdid2AllmSupportFunc eRet: %d \r\n", __FUNCTION__, eRet);
     }
     else {
@@ -1248,6 +1476,7 @@ IARM_Result_t _dsSetEdid2AllmSupport (void *arg)
     {
         updateEdidAllmBitValuesInPersistence(param->iHdmiPort,param->allmSupport);
         m_edidallmsupport[param->iHdmiPort] = param->allmSupport;
+        _dsHdmiInSyncPortConfig(param->iHdmiPort);
     }   
     IARM_BUS_Unlock(lock);
     return IARM_RESULT_SUCCESS;
@@ -1312,6 +1541,9 @@ static dsError_t setVRRSupport (dsHdmiInPort_t iHdmiPort, bool vrrSupport) {
     INT_INFO("setVRRSupport to ds-hal:  EDID VRR Bit: %d\n", vrrSupport);
     if (0 != dsHdmiInSetVRRSupportFunc) {
         eRet = dsHdmiInSetVRRSupportFunc (iHdmiPort, vrrSupport);
+        if (eRet == dsERR_NONE) {
+            _dsHdmiInInvalidateEdid(iHdmiPort);
+        }
         INT_INFO("[srv] %s: dsHdmiInSetVRRSupportFunc eRet: %d \r\n", __FUNCTION__, eRet);
     }
     else {
@@ -1337,6 +1569,7 @@ IARM_Result_t _dsSetVRRSupport (void *arg)
     {
         updateVRRBitValuesInPersistence(param->iHdmiPort,param->vrrSupport);
         m_vrrsupport[param->iHdmiPort] = param->vrrSupport;
+        _dsHdmiInSyncPortConfig(param->iHdmiPort);
     }
     IARM_BUS_Unlock(lock);
     return IARM_RESULT_SUCCESS;
@@ -1449,5 +1682,139 @@ IARM_Result_t _dsGetHdmiVersion (void *arg)
     IARM_BUS_Unlock(lock);
     return IARM_RESULT_SUCCESS;
 }
+
+static void _dsHdmiInInvalidateEdid(dsHdmiInPort_t port)
+{
+    if ((port < 0) || (port >= dsHDMI_IN_PORT_MAX)) {
+        return;
+    }
+    pthread_mutex_lock(&cacheLock);
+    m_blobCache[port].edidValid = false;
+    m_blobCache[port].edidGeneration++;
+    pthread_mutex_unlock(&cacheLock);
+}
+
+static void _dsHdmiInInvalidateSpd(dsHdmiInPort_t port)
+{
+    if ((port < 0) || (port >= dsHDMI_IN_PORT_MAX)) {
+        return;
+    }
+    pthread_mutex_lock(&cacheLock);
+    m_blobCache[port].spdValid = false;
+    m_blobCache[port].spdGeneration++;
+    pthread_mutex_unlock(&cacheLock);
+}
+
+/* Copies the EDID settings of the port into the snapshot; called with fpLock held */
+static void _dsHdmiInSyncPortConfig(dsHdmiInPort_t port)
+{
+    if ((port < 0) || (port >= dsHDMI_IN_PORT_MAX)) {
+        return;
+    }
+    pthread_mutex_lock(&statusLock);
+    dsHdmiInPortStatus_t *portStatus = &m_allPortsStatus.ports[port];
+    portStatus->edidVersion = m_edidversion[port];
+    portStatus->edidAllmSupport = m_edidallmsupport[port];
+    portStatus->vrrSupport = m_vrrsupport[port];
+    pthread_mutex_unlock(&statusLock);
+}
+
+/* Refreshes the active port from the HAL; called with fpLock held */
+static void _dsHdmiInSyncActivePort(void)
+{
+    dsHdmiInStatus_t status;
+    memset(&status, 0, sizeof(status));
+    if (dsERR_NONE != dsHdmiInGetStatus(&status)) {
+        return;
+    }
+    pthread_mutex_lock(&statusLock);
+    m_allPortsStatus.activePort = status.activePort;
+    m_allPortsStatus.isPresented = status.isPresented;
+    for (int i = 0; i < dsHDMI_IN_PORT_MAX; i++) {
+        m_allPortsStatus.ports[i].isConnected = status.isPortConnected[i];
+    }
+    pthread_mutex_unlock(&statusLock);
+}
+
+/*
+ * Queries the HAL once at init for what no callback reports until it
+ * changes; from then on the callbacks and setters keep the snapshot current.
+ * Called with fpLock held.
+ */
+static void _dsHdmiInSeedAllPortsStatus(void)
+{
+    dsHdmiInAllPortsStatus_t seed;
+    memset(&seed, 0, sizeof(seed));
+    seed.numPorts = noOfSupportedHdmiInputs;
+    seed.activePort = dsHDMI_IN_PORT_NONE;
+
+    for (int i = 0; i < dsHDMI_IN_PORT_MAX; i++) {
+        dsHdmiInPortStatus_t *portStatus = &seed.ports[i];
+        portStatus->signalStatus = dsHDMI_IN_SIGNAL_STATUS_NONE;
+        portStatus->vrrType = dsVRR_NONE;
+        portStatus->aviContentType = dsAVICONTENT_TYPE_NOT_SIGNALLED;
+        if (i >= noOfSupportedHdmiInputs) {
+            continue;
+        }
+        dsHdmiInPort_t port = static_cast<dsHdmiInPort_t>(i);
+        dsHdmiInVrrStatus_t vrrStatus = {dsVRR_NONE,0};
+        portStatus->isArcCapable = hdmiInCap_gs.isPortArcCapable[i];
+        portStatus->edidVersion = m_edidversion[i];
+        portStatus->edidAllmSupport = m_edidallmsupport[i];
+        portStatus->vrrSupport = m_vrrsupport[i];
+        getAllmStatus(port, &portStatus->allmMode);
+        if (dsERR_NONE == getVRRStatus(port, &vrrStatus)) {
+            portStatus->vrrType = vrrStatus.vrrType;
+        }
+        getHdmiVersion(port, &portStatus->hdmiVersion);
+    }
+
+    int audioLatency = 0;
+    int videoLatency = 0;
+    if (dsERR_NONE == getAVLatency_hal(&audioLatency, &videoLatency)) {
+        seed.audioLatency = audioLatency;
+        seed.videoLatency = videoLatency;
+    }
+
+    dsHdmiInStatus_t status;
+    memset(&status, 0, sizeof(status));
+    if (dsERR_NONE == dsHdmiInGetStatus(&status)) {
+        seed.activePort = status.activePort;
+        seed.isPresented = status.isPresented;
+        for (int i = 0; i < dsHDMI_IN_PORT_MAX; i++) {
+            seed.ports[i].isConnected = status.isPortConnected[i];
+        }
+        if ((status.activePort >= 0) && (status.activePort < dsHDMI_IN_PORT_MAX)) {
+            dsHdmiInGetCurrentVideoMode(&seed.ports[status.activePort].resolution);
+        }
+    }
+
+    pthread_mutex_lock(&statusLock);
+    m_allPortsStatus = seed;
+    pthread_mutex_unlock(&statusLock);
+}
+
+IARM_Result_t _dsHdmiInGetAllPortsStatus (void *arg)
+{
+    _DEBUG_ENTER();
+
+    dsHdmiInAllPortsStatusParam_t *param = (dsHdmiInAllPortsStatusParam_t *) arg;
+
+    /* Served from the snapshot without fpLock, so it does not wait behind HAL calls */
+    if (PROFILE_TV == profileType)
+    {
+        pthread_mutex_lock(&statusLock);
+        param->status = m_allPortsStatus;
+        pthread_mutex_unlock(&statusLock);
+        param->result = dsERR_NONE;
+    }
+    else
+    {
+        INT_INFO("[%d][%s]: its Other Profile\r\n", __LINE__, __FUNCTION__);
+        param->result = dsERR_GENERAL;
+    }
+    INT_DEBUG("[srv] %s: %d ports, active port %d\r\n", __FUNCTION__, param->status.numPorts, param->status.activePort);
+    return IARM_RESULT_SUCCESS;
+}
 /** @} */
 /** @} */
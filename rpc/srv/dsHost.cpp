@@ -50,12 +50,13 @@
 
 #include "safec_lib.h"
 #include "dsMgr.h"
+#include "dsPerfStats.h"
 
 static int m_isInitialized = 0;
 static pthread_mutex_t hostLock = PTHREAD_MUTEX_INITIALIZER;
 
-#define IARM_BUS_Lock(lock) pthread_mutex_lock(&hostLock)
-#define IARM_BUS_Unlock(lock) pthread_mutex_unlock(&hostLock)
+#define IARM_BUS_Lock(lock) dsPerfMutexLock(&hostLock)
+#define IARM_BUS_Unlock(lock) dsPerfMutexUnlock(&hostLock)
 
 
 IARM_Result_t _dsGetPreferredSleepMode(void *arg);
@@ -86,7 +87,7 @@ IARM_Result_t dsHostMgr_init()
         _SleepMode = stringToEnum(std::move(mode));        
         IARM_Bus_DSMgr_EventData_t eventData = {0};
         eventData.data.sleepModeInfo.sleepMode = _SleepMode;
-        IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,(IARM_EventId_t)IARM_BUS_DSMGR_EVENT_SLEEP_MODE_CHANGED,(void *)&eventData, sizeof(eventData));
+        dsMgr_BroadcastEvent((IARM_EventId_t)IARM_BUS_DSMGR_EVENT_SLEEP_MODE_CHANGED,(void *)&eventData, sizeof(eventData));
         INT_INFO("Broadcast Event IARM_BUS_DSMGR_EVENT_SLEEP_MODE_CHANGED :%d. \n",_SleepMode);
     }
     catch(...)
@@ -95,13 +96,13 @@ IARM_Result_t dsHostMgr_init()
     }
 
     if (!m_isInitialized) {
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetPreferredSleepMode,_dsGetPreferredSleepMode);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetPreferredSleepMode,_dsSetPreferredSleepMode);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetCPUTemperature,_dsGetCPUTemperature);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetVersion,_dsGetVersion);
-        IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetSocIDFromSDK,_dsGetSocIDFromSDK);
-	IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetHostEDID,_dsGetHostEDID);
-	IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetMS12ConfigType,_dsGetMS12ConfigType);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetPreferredSleepMode,_dsGetPreferredSleepMode);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetPreferredSleepMode,_dsSetPreferredSleepMode);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetCPUTemperature,_dsGetCPUTemperature);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetVersion,_dsGetVersion);
+        dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetSocIDFromSDK,_dsGetSocIDFromSDK);
+	dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetHostEDID,_dsGetHostEDID);
+	dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetMS12ConfigType,_dsGetMS12ConfigType);
 
         
         uint32_t  halVersion = 0x10000;
@@ -132,7 +133,7 @@ IARM_Result_t _dsSetPreferredSleepMode(void *arg)
         _SleepMode  = param->mode;
         IARM_Bus_DSMgr_EventData_t eventData;
         eventData.data.sleepModeInfo.sleepMode = _SleepMode;
-        IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,(IARM_EventId_t)IARM_BUS_DSMGR_EVENT_SLEEP_MODE_CHANGED,(void *)&eventData, sizeof(eventData));
+        dsMgr_BroadcastEvent((IARM_EventId_t)IARM_BUS_DSMGR_EVENT_SLEEP_MODE_CHANGED,(void *)&eventData, sizeof(eventData));
         INT_INFO("callaing IARM_BUS_DSMGR_EVENT_SLEEP_MODE_CHANGED :%d \n",_SleepMode);
         ret = IARM_RESULT_SUCCESS;
     }
@@ -296,13 +297,25 @@ IARM_Result_t _dsGetSocIDFromSDK(void *arg)
     }
 
     if (param != NULL) {
+        /* The HAL may use all of DS_DEVICEID_LEN_MAX, the caller only sent capacity bytes */
+        char socID[DS_DEVICEID_LEN_MAX] = {0};
+        int capacity = DS_RPC_VAR_PARAM_CAPACITY(param, socID);
+
         param->result = dsERR_GENERAL;
+        param->length = 0;
 
         if (func != NULL) {
-            param->result = func(param->socID);
+            param->result = func(socID);
+        }
+        if (param->result == dsERR_NONE) {
+            socID[sizeof(socID) - 1] = '\0';
+            param->length = (int)strlen(socID) + 1;
+            if (param->length <= capacity) {
+                memcpy(param->socID, socID, param->length);
+            }
         }
+        INT_INFO("dsSRV: _dsGetSocIDFromSDK SocID : %s\n", socID);
     }
-    INT_INFO("dsSRV: _dsGetSocIDFromSDK SocID : %s\n",param->socID);
 
     IARM_BUS_Unlock(lock);
 
@@ -349,10 +362,13 @@ IARM_Result_t _dsGetHostEDID(void *arg)
         int length = 0;
         dsError_t ret = func(edidBytes, &length);
         if (ret == dsERR_NONE && length <= 1024) {
+            int capacity = DS_RPC_VAR_PARAM_CAPACITY(param, bytes);
             INT_INFO("dsSRV ::getHostEDID returns %d bytes\r\n", length);
-            rc = memcpy_s(param->bytes,sizeof(param->bytes),edidBytes,EDID_MAX_DATA_SIZE);
-            if(rc!=EOK){
-                    ERR_CHK(rc);
+            if (length <= capacity) {
+                rc = memcpy_s(param->bytes,capacity,edidBytes,length);
+                if(rc!=EOK){
+                        ERR_CHK(rc);
+                }
             }
             param->length = length;
         }
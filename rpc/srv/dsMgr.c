@@ -29,6 +29,7 @@
 
 #include "dsMgr.h"
 #include "libIARM.h"
+#include "libIBus.h"
 #include "dsError.h"
 #include "libIARM.h"
 #include "dsHost.h"
@@ -37,6 +38,8 @@
 #include <string.h>
 #include "dsserverlogger.h"
 #include "dsTelemetry.h"
+#include "dsEventTrace.h"
+#include "dsPerfStats.h"
 
 #include <iostream>
 #include "hostPersistence.hpp"
@@ -107,6 +110,56 @@ profile_t searchRdkProfile(void) {
     return ret;
 }
 
+/**
+ * @brief Broadcast a DSMgr event, recording the broadcast in the event trace ring.
+ */
+IARM_Result_t dsMgr_BroadcastEvent(IARM_EventId_t eventId, void *data, size_t len)
+{
+    IARM_Result_t ret;
+
+    dsEventTraceRecord(dsEVENT_TRACE_BROADCAST_BEGIN, eventId, 0);
+    ret = IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME, eventId, data, len);
+    dsEventTraceRecord(dsEVENT_TRACE_BROADCAST_END, eventId, ret);
+    return ret;
+}
+
+static IARM_Result_t _dsDumpEventTrace(void *arg)
+{
+    dsEventTraceDumpParam_t *param = (dsEventTraceDumpParam_t *)arg;
+
+    if (NULL == param) {
+        return IARM_RESULT_INVALID_PARAM;
+    }
+
+    /* Always a file of dsMgr's own naming, whatever the caller sent */
+    memset(param->path, 0, sizeof(param->path));
+    param->records = dsEventTraceDumpToFile(param->path, sizeof(param->path));
+    param->result = (param->records < 0) ? dsERR_GENERAL : dsERR_NONE;
+    INT_INFO("[%s]: dumped %d event trace records to '%s'\r\n", __FUNCTION__, param->records, param->path);
+
+    return IARM_RESULT_SUCCESS;
+}
+
+static IARM_Result_t _dsSetLogLevel(void *arg)
+{
+    dsLogLevelParam_t *param = (dsLogLevelParam_t *)arg;
+
+    if (NULL == param) {
+        return IARM_RESULT_INVALID_PARAM;
+    }
+
+    if (0 == dsLogModuleSetLevel(param->module, param->level)) {
+        param->result = dsERR_NONE;
+        INT_INFO("[%s]: log level of '%s' set to %d\r\n", __FUNCTION__,
+               (-1 == param->module) ? "all" : dsLogModuleName(param->module), param->level);
+    }
+    else {
+        param->result = dsERR_INVALID_PARAM;
+    }
+
+    return IARM_RESULT_SUCCESS;
+}
+
 IARM_Result_t dsMgr_init()
 {
     IARM_Result_t ret = IARM_RESULT_SUCCESS;
@@ -132,6 +185,17 @@ IARM_Result_t dsMgr_init()
 	dsHdmiInMgr_init();
 	dsCompositeInMgr_init();
 
+	dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsDumpEventTrace, _dsDumpEventTrace);
+	dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetLogLevel, _dsSetLogLevel);
+	dsPerfStatsInit();
+	if (0 != dsLogModuleWatchConfig(DS_LOG_LEVEL_CONFIG_FILE)) {
+		INT_WARNING("[%s]: cannot watch %s for log level changes\r\n", __FUNCTION__, DS_LOG_LEVEL_CONFIG_FILE);
+	}
+	if (dsEventTraceInstallFromEnv() > 0) {
+		INT_INFO("[%s]: event trace dump signal installed\r\n", __FUNCTION__);
+	}
+	dsTelemetryAggStart(0);
+
 	return ret;
 }
 
@@ -147,6 +211,7 @@ IARM_Result_t dsMgr_term()
 	dsHostMgr_term();
 	dsHdmiInMgr_term();
 	dsCompositeInMgr_term();
+	dsTelemetryAggStop();
 
     if (dsFreeConfig() != dsERR_NONE) {
 		INT_ERROR("Failed to free device configurations\r\n");
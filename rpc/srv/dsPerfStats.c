@@ -0,0 +1,199 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2025 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+
+/**
+* @defgroup devicesettings
+* @{
+* @defgroup rpc
+* @{
+**/
+
+
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include "libIBus.h"
+#include "dsMgr.h"
+#include "dsRpc.h"
+#include "dsPerfStats.h"
+#include "dsserverlogger.h"
+
+typedef struct _dsPerfMethod_t {
+    const char *name;
+    IARM_BusCall_t handler;
+    uint64_t calls;
+    uint64_t errors;
+    uint64_t totalUs;
+    uint64_t maxUs;
+    uint64_t lockWaitUs;
+    uint64_t lockHeldUs;
+} dsPerfMethod_t;
+
+__thread dsPerfCall_t dsPerfCurrentCall = { -1, 0, 0, 0, 0 };
+
+static dsPerfMethod_t perfMethods[DS_PERF_MAX_METHODS];
+static int perfMethodCount = 0;     /* written once per registration, read with acquire */
+static pthread_mutex_t perfRegisterLock = PTHREAD_MUTEX_INITIALIZER;
+
+static inline void _dsPerfAdd(uint64_t *counter, uint64_t value)
+{
+    __atomic_fetch_add(counter, value, __ATOMIC_RELAXED);
+}
+
+static inline void _dsPerfMax(uint64_t *counter, uint64_t value)
+{
+    uint64_t current = __atomic_load_n(counter, __ATOMIC_RELAXED);
+    while ((value > current) &&
+           !__atomic_compare_exchange_n(counter, &current, value, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+    }
+}
+
+static IARM_Result_t _dsPerfInvoke(int slot, void *arg)
+{
+    dsPerfMethod_t *method = &perfMethods[slot];
+    dsPerfCall_t saved = dsPerfCurrentCall;
+
+    dsPerfCurrentCall.slot = slot;
+    dsPerfCurrentCall.lockDepth = 0;
+    dsPerfCurrentCall.lockWaitUs = 0;
+    dsPerfCurrentCall.lockHeldUs = 0;
+    dsPerfCurrentCall.lockedAtUs = 0;
+
+    uint64_t start = dsPerfNowUs();
+    IARM_Result_t ret = method->handler(arg);
+    uint64_t elapsed = dsPerfNowUs() - start;
+
+    _dsPerfAdd(&method->calls, 1);
+    if (IARM_RESULT_SUCCESS != ret) {
+        _dsPerfAdd(&method->errors, 1);
+    }
+    _dsPerfAdd(&method->totalUs, elapsed);
+    _dsPerfMax(&method->maxUs, elapsed);
+    _dsPerfAdd(&method->lockWaitUs, dsPerfCurrentCall.lockWaitUs);
+    _dsPerfAdd(&method->lockHeldUs, dsPerfCurrentCall.lockHeldUs);
+
+    dsPerfCurrentCall = saved;
+    return ret;
+}
+
+/*
+ * IARM calls a handler with the call argument only, so each slot gets its
+ * own entry point that knows the slot number.
+ */
+template <int N>
+struct dsPerfTrampolines {
+    static IARM_Result_t call(void *arg)
+    {
+        return _dsPerfInvoke(N - 1, arg);
+    }
+    static void fill(IARM_BusCall_t *table)
+    {
+        table[N - 1] = call;
+        dsPerfTrampolines<N - 1>::fill(table);
+    }
+};
+
+template <>
+struct dsPerfTrampolines<0> {
+    static void fill(IARM_BusCall_t *table)
+    {
+        (void)table;
+    }
+};
+
+static IARM_BusCall_t perfTrampolines[DS_PERF_MAX_METHODS];
+
+/**
+ * @brief Register an RPC handler of dsMgr with per method performance counters.
+ */
+IARM_Result_t dsMgr_RegisterCall(const char *methodName, IARM_BusCall_t handler)
+{
+    int slot = -1;
+
+    pthread_mutex_lock(&perfRegisterLock);
+    if (0 == perfMethodCount) {
+        dsPerfTrampolines<DS_PERF_MAX_METHODS>::fill(perfTrampolines);
+    }
+    if (perfMethodCount < DS_PERF_MAX_METHODS) {
+        slot = perfMethodCount;
+        perfMethods[slot].name = methodName;
+        perfMethods[slot].handler = handler;
+        __atomic_store_n(&perfMethodCount, slot + 1, __ATOMIC_RELEASE);
+    }
+    pthread_mutex_unlock(&perfRegisterLock);
+
+    if (slot < 0) {
+        INT_WARNING("[%s]: no counter slot left for '%s', registering it untracked\r\n", __FUNCTION__, methodName);
+        return IARM_Bus_RegisterCall(methodName, handler);
+    }
+    return IARM_Bus_RegisterCall(methodName, perfTrampolines[slot]);
+}
+
+static IARM_Result_t _dsGetPerfStats(void *arg)
+{
+    dsPerfStatsParam_t *param = (dsPerfStatsParam_t *)arg;
+
+    if (NULL == param) {
+        return IARM_RESULT_INVALID_PARAM;
+    }
+
+    int total = __atomic_load_n(&perfMethodCount, __ATOMIC_ACQUIRE);
+    param->total = total;
+    param->count = 0;
+    if ((param->first < 0) || (param->first > total)) {
+        param->result = dsERR_INVALID_PARAM;
+        return IARM_RESULT_SUCCESS;
+    }
+
+    for (int i = param->first; (i < total) && (param->count < DS_PERF_STATS_PAGE); i++) {
+        dsPerfMethod_t *method = &perfMethods[i];
+        dsPerfStat_t *stat = &param->stats[param->count++];
+
+        snprintf(stat->method, sizeof(stat->method), "%s", method->name);
+        if (param->reset) {
+            stat->calls = __atomic_exchange_n(&method->calls, 0, __ATOMIC_RELAXED);
+            stat->errors = __atomic_exchange_n(&method->errors, 0, __ATOMIC_RELAXED);
+            stat->totalUs = __atomic_exchange_n(&method->totalUs, 0, __ATOMIC_RELAXED);
+            stat->maxUs = __atomic_exchange_n(&method->maxUs, 0, __ATOMIC_RELAXED);
+            stat->lockWaitUs = __atomic_exchange_n(&method->lockWaitUs, 0, __ATOMIC_RELAXED);
+            stat->lockHeldUs = __atomic_exchange_n(&method->lockHeldUs, 0, __ATOMIC_RELAXED);
+        }
+        else {
+            stat->calls = __atomic_load_n(&method->calls, __ATOMIC_RELAXED);
+            stat->errors = __atomic_load_n(&method->errors, __ATOMIC_RELAXED);
+            stat->totalUs = __atomic_load_n(&method->totalUs, __ATOMIC_RELAXED);
+            stat->maxUs = __atomic_load_n(&method->maxUs, __ATOMIC_RELAXED);
+            stat->lockWaitUs = __atomic_load_n(&method->lockWaitUs, __ATOMIC_RELAXED);
+            stat->lockHeldUs = __atomic_load_n(&method->lockHeldUs, __ATOMIC_RELAXED);
+        }
+    }
+    param->result = dsERR_NONE;
+
+    return IARM_RESULT_SUCCESS;
+}
+
+void dsPerfStatsInit(void)
+{
+    dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetPerfStats, _dsGetPerfStats);
+}
+
+
+/** @} */
+/** @} */
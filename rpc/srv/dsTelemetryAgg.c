@@ -0,0 +1,271 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2025 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+
+/**
+* @defgroup devicesettings
+* @{
+* @defgroup rpc
+* @{
+**/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <pthread.h>
+#include <sys/time.h>
+#include "dsTelemetry.h"
+#include "dsTelemetryAgg.h"
+#include "dsserverlogger.h"
+
+typedef enum _dsTelemetryKind_t {
+    dsTELEMETRY_COUNTER = 0,
+    dsTELEMETRY_GAUGE,
+    dsTELEMETRY_HISTOGRAM
+} dsTelemetryKind_t;
+
+typedef struct _dsTelemetryEntry_t {
+    char marker[DS_TELEMETRY_MARKER_LEN_MAX];
+    dsTelemetryKind_t kind;
+    bool dirty;                 /* touched since the last flush */
+    long count;                 /* counter total or histogram samples */
+    double gauge;
+    unsigned int min;
+    unsigned int max;
+    unsigned long long sum;
+    unsigned int buckets[DS_TELEMETRY_HIST_BUCKETS];
+} dsTelemetryEntry_t;
+
+/* Upper bounds in ms, the last bucket takes everything above */
+static const unsigned int histBoundsMs[DS_TELEMETRY_HIST_BUCKETS - 1] = {
+    10, 25, 50, 100, 250, 500, 1000, 2500, 5000
+};
+
+static pthread_mutex_t aggLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t aggCond = PTHREAD_COND_INITIALIZER;
+static pthread_t aggThread;
+static bool aggRunning = false;
+static unsigned int aggIntervalSec = DS_TELEMETRY_FLUSH_INTERVAL_SEC;
+static int aggCount = 0;
+static dsTelemetryEntry_t aggEntries[DS_TELEMETRY_AGG_MAX_MARKERS];
+
+/* Entry of marker, created on first use. Called with aggLock held; NULL when not aggregating. */
+static dsTelemetryEntry_t *_dsTelemetryEntry(const char *marker, dsTelemetryKind_t kind)
+{
+    if (!aggRunning) {
+        return NULL;
+    }
+    for (int i = 0; i < aggCount; i++) {
+        if ((aggEntries[i].kind == kind) && (0 == strcmp(aggEntries[i].marker, marker))) {
+            return &aggEntries[i];
+        }
+    }
+    if ((aggCount == DS_TELEMETRY_AGG_MAX_MARKERS) || (strlen(marker) >= DS_TELEMETRY_MARKER_LEN_MAX)) {
+        return NULL;
+    }
+    dsTelemetryEntry_t *entry = &aggEntries[aggCount++];
+    memset(entry, 0, sizeof(*entry));
+    snprintf(entry->marker, sizeof(entry->marker), "%s", marker);
+    entry->kind = kind;
+    return entry;
+}
+
+void dsTelemetryAggCount(const char *marker, int delta)
+{
+    pthread_mutex_lock(&aggLock);
+    dsTelemetryEntry_t *entry = _dsTelemetryEntry(marker, dsTELEMETRY_COUNTER);
+    if (entry) {
+        entry->count += delta;
+        entry->dirty = true;
+    }
+    pthread_mutex_unlock(&aggLock);
+
+    if (NULL == entry) {
+        t2_event_d((char *)marker, delta);
+    }
+}
+
+void dsTelemetryAggGauge(const char *marker, double value)
+{
+    pthread_mutex_lock(&aggLock);
+    dsTelemetryEntry_t *entry = _dsTelemetryEntry(marker, dsTELEMETRY_GAUGE);
+    if (entry) {
+        entry->gauge = value;
+        entry->dirty = true;
+    }
+    pthread_mutex_unlock(&aggLock);
+
+    if (NULL == entry) {
+        t2_event_f((char *)marker, value);
+    }
+}
+
+void dsTelemetryAggLatencyMs(const char *marker, unsigned int ms)
+{
+    pthread_mutex_lock(&aggLock);
+    dsTelemetryEntry_t *entry = _dsTelemetryEntry(marker, dsTELEMETRY_HISTOGRAM);
+    if (entry) {
+        int bucket = 0;
+        while ((bucket < DS_TELEMETRY_HIST_BUCKETS - 1) && (ms > histBoundsMs[bucket])) {
+            bucket++;
+        }
+        entry->buckets[bucket]++;
+        if ((0 == entry->count) || (ms < entry->min)) {
+            entry->min = ms;
+        }
+        if (ms > entry->max) {
+            entry->max = ms;
+        }
+        entry->sum += ms;
+        entry->count++;
+        entry->dirty = true;
+    }
+    pthread_mutex_unlock(&aggLock);
+
+    if (NULL == entry) {
+        t2_event_d((char *)marker, (int)ms);
+    }
+}
+
+static void _dsTelemetrySend(const dsTelemetryEntry_t *entry)
+{
+    char value[160];
+
+    switch (entry->kind) {
+    case dsTELEMETRY_COUNTER:
+        t2_event_d((char *)entry->marker, (int)entry->count);
+        break;
+    case dsTELEMETRY_GAUGE:
+        t2_event_f((char *)entry->marker, entry->gauge);
+        break;
+    case dsTELEMETRY_HISTOGRAM: {
+        int len = snprintf(value, sizeof(value), "%ld,%u,%u,%llu", entry->count, entry->min, entry->max,
+                           entry->sum / (unsigned long long)entry->count);
+        for (int i = 0; (i < DS_TELEMETRY_HIST_BUCKETS) && (len < (int)sizeof(value)); i++) {
+            len += snprintf(value + len, sizeof(value) - len, ",%u", entry->buckets[i]);
+        }
+        t2_event_s((char *)entry->marker, value);
+        break;
+    }
+    }
+}
+
+void dsTelemetryAggFlush(void)
+{
+    dsTelemetryEntry_t pending[DS_TELEMETRY_AGG_MAX_MARKERS];
+    int count = 0;
+
+    /* Snapshot and reset under the lock, send without it */
+    pthread_mutex_lock(&aggLock);
+    for (int i = 0; i < aggCount; i++) {
+        dsTelemetryEntry_t *entry = &aggEntries[i];
+        if (!entry->dirty) {
+            continue;
+        }
+        pending[count++] = *entry;
+        entry->dirty = false;
+        if (entry->kind != dsTELEMETRY_GAUGE) {
+            entry->count = 0;
+            entry->min = entry->max = 0;
+            entry->sum = 0;
+            memset(entry->buckets, 0, sizeof(entry->buckets));
+        }
+    }
+    pthread_mutex_unlock(&aggLock);
+
+    for (int i = 0; i < count; i++) {
+        _dsTelemetrySend(&pending[i]);
+    }
+    if (count > 0) {
+        INT_DEBUG("[%s]: sent %d aggregated telemetry markers\r\n", __FUNCTION__, count);
+    }
+}
+
+static void *_dsTelemetryFlushThread(void *arg)
+{
+    (void)arg;
+    pthread_mutex_lock(&aggLock);
+    while (aggRunning) {
+        struct timeval now;
+        struct timespec deadline;
+        gettimeofday(&now, NULL);
+        deadline.tv_sec = now.tv_sec + aggIntervalSec;
+        deadline.tv_nsec = now.tv_usec * 1000;
+
+        int rc = 0;
+        while (aggRunning && (ETIMEDOUT != rc)) {
+            rc = pthread_cond_timedwait(&aggCond, &aggLock, &deadline);
+        }
+        pthread_mutex_unlock(&aggLock);
+        dsTelemetryAggFlush();
+        pthread_mutex_lock(&aggLock);
+    }
+    pthread_mutex_unlock(&aggLock);
+    return NULL;
+}
+
+int dsTelemetryAggStart(unsigned int intervalSec)
+{
+    if (0 == intervalSec) {
+        const char *env = getenv("DS_TELEMETRY_FLUSH_SEC");
+        intervalSec = env ? (unsigned int)atoi(env) : 0;
+        if (0 == intervalSec) {
+            intervalSec = DS_TELEMETRY_FLUSH_INTERVAL_SEC;
+        }
+    }
+
+    pthread_mutex_lock(&aggLock);
+    if (aggRunning) {
+        aggIntervalSec = intervalSec;
+        pthread_mutex_unlock(&aggLock);
+        return 0;
+    }
+    aggIntervalSec = intervalSec;
+    aggRunning = true;
+    if (0 != pthread_create(&aggThread, NULL, _dsTelemetryFlushThread, NULL)) {
+        aggRunning = false;
+        pthread_mutex_unlock(&aggLock);
+        INT_ERROR("[%s]: cannot start the telemetry flush thread\r\n", __FUNCTION__);
+        return -1;
+    }
+    pthread_mutex_unlock(&aggLock);
+    INT_INFO("[%s]: aggregating telemetry, flush every %u s\r\n", __FUNCTION__, intervalSec);
+    return 0;
+}
+
+void dsTelemetryAggStop(void)
+{
+    pthread_mutex_lock(&aggLock);
+    if (!aggRunning) {
+        pthread_mutex_unlock(&aggLock);
+        return;
+    }
+    aggRunning = false;
+    pthread_cond_signal(&aggCond);
+    pthread_mutex_unlock(&aggLock);
+
+    /* The thread flushes once more on its way out */
+    pthread_join(aggThread, NULL);
+}
+
+
+/** @} */
+/** @} */
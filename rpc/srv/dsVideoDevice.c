@@ -43,6 +43,8 @@
 #include "libIBus.h"
 #include "dsRpc.h"
 #include "dsMgr.h"
+#include "dsPerfStats.h"
+#include "dsEventTrace.h"
 #include "dsserverlogger.h"
 #include "hostPersistence.hpp"
 #include <dlfcn.h>
@@ -57,8 +59,8 @@ static pthread_mutex_t dsLock = PTHREAD_MUTEX_INITIALIZER;
 static dsVideoZoom_t srv_dfc = dsVIDEO_ZOOM_FULL;
 static bool force_disable_hdr = true;
 
-#define IARM_BUS_Lock(lock) pthread_mutex_lock(&dsLock)
-#define IARM_BUS_Unlock(lock) pthread_mutex_unlock(&dsLock)
+#define IARM_BUS_Lock(lock) dsPerfMutexLock(&dsLock)
+#define IARM_BUS_Unlock(lock) dsPerfMutexUnlock(&dsLock)
 
 IARM_Result_t _dsVideoDeviceInit(void *arg);
 IARM_Result_t _dsGetVideoDevice(void *arg);
@@ -82,7 +84,7 @@ void _dsFramerateStatusPreChangeCB(unsigned int inputStatus);
 
 IARM_Result_t dsVideoDeviceMgr_init()
 {
-   IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsVideoDeviceInit, _dsVideoDeviceInit);
+   dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsVideoDeviceInit, _dsVideoDeviceInit);
    IARM_BUS_Lock(lock);
 
 	try
@@ -147,18 +149,18 @@ IARM_Result_t _dsVideoDeviceInit(void *arg)
    
 	if (!m_isInitialized) {
 
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetVideoDevice,_dsGetVideoDevice);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetDFC,_dsSetDFC);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetDFC,_dsGetDFC);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsVideoDeviceTerm,_dsVideoDeviceTerm);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetHDRCapabilities,_dsGetHDRCapabilities); 
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetSupportedVideoCodingFormats, _dsGetSupportedVideoCodingFormats); 
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetVideoCodecInfo, _dsGetVideoCodecInfo); 
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetForceDisableHDR, _dsForceDisableHDR); 
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetFRFMode, _dsSetFRFMode);
-                IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetFRFMode, _dsGetFRFMode);
-                IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetCurrentDisframerate, _dsGetCurrentDisframerate);
-                IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetDisplayframerate, _dsSetDisplayframerate);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetVideoDevice,_dsGetVideoDevice);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetDFC,_dsSetDFC);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetDFC,_dsGetDFC);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsVideoDeviceTerm,_dsVideoDeviceTerm);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetHDRCapabilities,_dsGetHDRCapabilities); 
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetSupportedVideoCodingFormats, _dsGetSupportedVideoCodingFormats); 
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetVideoCodecInfo, _dsGetVideoCodecInfo); 
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetForceDisableHDR, _dsForceDisableHDR); 
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetFRFMode, _dsSetFRFMode);
+                dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetFRFMode, _dsGetFRFMode);
+                dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetCurrentDisframerate, _dsGetCurrentDisframerate);
+                dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetDisplayframerate, _dsSetDisplayframerate);
 
 		typedef dsError_t (*_dsFramerateStatusPreChangeCB_t)(dsRegisterFrameratePreChangeCB_t CBFunc);
                 static _dsFramerateStatusPreChangeCB_t frameratePreChangeCB = 0;
@@ -249,7 +251,7 @@ IARM_Result_t _dsSetDFC(void *arg)
 				dsSetDFC(param->handle,param->dfc);
 				eventData.data.dfc.zoomsettings = dsVIDEO_ZOOM_NONE;
 				srv_dfc = param->dfc;
-				IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,(IARM_EventId_t)IARM_BUS_DSMGR_EVENT_ZOOM_SETTINGS,(void *)&eventData, sizeof(eventData));
+				dsMgr_BroadcastEvent((IARM_EventId_t)IARM_BUS_DSMGR_EVENT_ZOOM_SETTINGS,(void *)&eventData, sizeof(eventData));
 				device::HostPersistence::getInstance().persistHostProperty("VideoDevice.DFC","None");
 			}
 			else if(param->dfc == dsVIDEO_ZOOM_FULL)
@@ -258,7 +260,7 @@ IARM_Result_t _dsSetDFC(void *arg)
 				dsSetDFC(param->handle,param->dfc);
 				eventData.data.dfc.zoomsettings =  dsVIDEO_ZOOM_FULL;
 				srv_dfc = param->dfc;
-				IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,(IARM_EventId_t)IARM_BUS_DSMGR_EVENT_ZOOM_SETTINGS,(void *)&eventData, sizeof(eventData));
+				dsMgr_BroadcastEvent((IARM_EventId_t)IARM_BUS_DSMGR_EVENT_ZOOM_SETTINGS,(void *)&eventData, sizeof(eventData));
 				device::HostPersistence::getInstance().persistHostProperty("VideoDevice.DFC","Full");
 
 			}
@@ -268,7 +270,7 @@ IARM_Result_t _dsSetDFC(void *arg)
 				dsSetDFC(param->handle,param->dfc);
 				eventData.data.dfc.zoomsettings =  dsVIDEO_ZOOM_FULL;
 				srv_dfc = param->dfc;
-				IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,(IARM_EventId_t)IARM_BUS_DSMGR_EVENT_ZOOM_SETTINGS,(void *)&eventData, sizeof(eventData));
+				dsMgr_BroadcastEvent((IARM_EventId_t)IARM_BUS_DSMGR_EVENT_ZOOM_SETTINGS,(void *)&eventData, sizeof(eventData));
 				device::HostPersistence::getInstance().persistHostProperty("VideoDevice.DFC","Full");
 			}
 			else
@@ -648,7 +650,7 @@ static int _dsSendDisplayFrameRateStatusChangeEventCallBack(dsFramerateParam_t *
     memmove(_eventData.data.DisplayFrameRateChange.framerate, displayframerate->framerate, sizeof(_eventData.data.DisplayFrameRateChange));
     __TIMESTAMP();
     printf("%s:%d - Framerate status change update!!!!!! \r\n", __PRETTY_FUNCTION__,__LINE__);
-    IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,
+    dsMgr_BroadcastEvent(
                             (IARM_EventId_t)_eventId,
                             (void *)&_eventData,
                             sizeof(_eventData));
@@ -658,10 +660,11 @@ static int _dsSendDisplayFrameRateStatusChangeEventCallBack(dsFramerateParam_t *
 void _dsFramerateStatusPreChangeCB(unsigned int inputStatus)
 {
     IARM_Bus_DSMgr_EventData_t _eventData;
+    dsEventTraceRecord(dsEVENT_TRACE_HAL_CALLBACK, IARM_BUS_DSMGR_EVENT_DISPLAY_FRAMRATE_PRECHANGE, inputStatus);
 
     INT_INFO("%s:%d - Framerate status prechange update!!!!!! \r\n", __PRETTY_FUNCTION__,__LINE__);
 
-    IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,
+    dsMgr_BroadcastEvent(
                                 (IARM_EventId_t)IARM_BUS_DSMGR_EVENT_DISPLAY_FRAMRATE_PRECHANGE,
                                 (void *)&_eventData,
                                 sizeof(_eventData));
@@ -671,10 +674,11 @@ void _dsFramerateStatusPreChangeCB(unsigned int inputStatus)
 void _dsFramerateStatusPostChangeCB(unsigned int inputStatus)
 {
     IARM_Bus_DSMgr_EventData_t _eventData;
+    dsEventTraceRecord(dsEVENT_TRACE_HAL_CALLBACK, IARM_BUS_DSMGR_EVENT_DISPLAY_FRAMRATE_POSTCHANGE, inputStatus);
 
     INT_INFO("%s:%d - Framerate status changed update!!!!!! \r\n", __PRETTY_FUNCTION__,__LINE__);
 
-    IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,
+    dsMgr_BroadcastEvent(
                                 (IARM_EventId_t)IARM_BUS_DSMGR_EVENT_DISPLAY_FRAMRATE_POSTCHANGE,
                                 (void *)&_eventData,
                                 sizeof(_eventData));
@@ -27,6 +27,8 @@
 **/
 
 
+#define DS_LOG_MODULE dsLOG_MODULE_VIDEOPORT
+
 #include "dsVideoPort.h"
 #include "dsDisplay.h"
 #include "dsTelemetry.h"
@@ -47,6 +49,8 @@
 #include "libIBus.h"
 #include "dsRpc.h"
 #include "dsMgr.h"
+#include "dsPerfStats.h"
+#include "dsEventTrace.h"
 #include <iostream>
 #include <string.h>
 #include "hostPersistence.hpp"
@@ -77,8 +81,8 @@ static bool force_disable_4K = false;
 static const dsDisplayColorDepth_t DEFAULT_COLOR_DEPTH = dsDISPLAY_COLORDEPTH_AUTO;
 static dsDisplayColorDepth_t hdmiColorDept = DEFAULT_COLOR_DEPTH;
 #define NULL_HANDLE 0
-#define IARM_BUS_Lock(lock) pthread_mutex_lock(&dsLock)
-#define IARM_BUS_Unlock(lock) pthread_mutex_unlock(&dsLock)
+#define IARM_BUS_Lock(lock) dsPerfMutexLock(&dsLock)
+#define IARM_BUS_Unlock(lock) dsPerfMutexUnlock(&dsLock)
 
 IARM_Result_t _dsVideoPortInit(void *arg);
 IARM_Result_t _dsGetVideoPort(void *arg);
@@ -259,7 +263,7 @@ IARM_Result_t dsVideoPortMgr_init()
 		INT_INFO("Exception in getting force-disable-4K setting at start up.\r\n");
 	}
 	IARM_BUS_Unlock(lock);  //CID:136282 - Data race condition
-	IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsVideoPortInit, _dsVideoPortInit);
+	dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsVideoPortInit, _dsVideoPortInit);
     return IARM_RESULT_SUCCESS;
 }
 
@@ -291,41 +295,41 @@ IARM_Result_t _dsVideoPortInit(void *arg)
 		   dsRegisterHdcpStatusCallback(handle,_dsHdcpCallback);
 		#endif
 		
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetVideoPort,_dsGetVideoPort);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsIsVideoPortEnabled,_dsIsVideoPortEnabled);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsIsDisplayConnected,_dsIsDisplayConnected);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsIsDisplaySurround,_dsIsDisplaySurround);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetSurroundMode,_dsGetSurroundMode);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsEnableVideoPort,_dsEnableVideoPort);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetResolution,_dsSetResolution);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetResolution,_dsGetResolution);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsVideoPortTerm,_dsVideoPortTerm);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsEnableHDCP ,_dsEnableHDCP);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsIsHDCPEnabled,_dsIsHDCPEnabled);
-	    IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetHDCPStatus ,_dsGetHDCPStatus); 
-	    IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetHDCPProtocol ,_dsGetHDCPProtocol);
-	    IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetHDCPReceiverProtocol ,_dsGetHDCPReceiverProtocol);
-	    IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetHDCPCurrentProtocol ,_dsGetHDCPCurrentProtocol);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsIsVideoPortActive ,_dsIsVideoPortActive); 
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetTVHDRCapabilities,_dsGetTVHDRCapabilities);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetSupportedTVResolution,_dsSupportedTvResolutions);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetForceDisable4K, _dsSetForceDisable4K); 
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetForceDisable4K, _dsGetForceDisable4K); 
-                IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsIsOutputHDR,_dsIsOutputHDR);
-                IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsResetOutputToSDR,_dsResetOutputToSDR);
-                IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetHdmiPreference,_dsSetHdmiPreference);
-                IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetHdmiPreference,_dsGetHdmiPreference);
-                IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetVideoEOTF,_dsGetVideoEOTF);
-                IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetMatrixCoefficients,_dsGetMatrixCoefficients);
-                IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetColorDepth,_dsGetColorDepth);
-                IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetColorSpace,_dsGetColorSpace);
-                IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetQuantizationRange,_dsGetQuantizationRange);
-                IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetCurrentOutputSettings,_dsGetCurrentOutputSettings);
-                IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetBackgroundColor,_dsSetBackgroundColor);
-                IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetForceHDRMode,_dsSetForceHDRMode);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsColorDepthCapabilities,_dsColorDepthCapabilities);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsGetPreferredColorDepth,_dsGetPreferredColorDepth);
-		IARM_Bus_RegisterCall(IARM_BUS_DSMGR_API_dsSetPreferredColorDepth,_dsSetPreferredColorDepth);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetVideoPort,_dsGetVideoPort);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsIsVideoPortEnabled,_dsIsVideoPortEnabled);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsIsDisplayConnected,_dsIsDisplayConnected);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsIsDisplaySurround,_dsIsDisplaySurround);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetSurroundMode,_dsGetSurroundMode);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsEnableVideoPort,_dsEnableVideoPort);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetResolution,_dsSetResolution);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetResolution,_dsGetResolution);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsVideoPortTerm,_dsVideoPortTerm);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsEnableHDCP ,_dsEnableHDCP);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsIsHDCPEnabled,_dsIsHDCPEnabled);
+	    dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetHDCPStatus ,_dsGetHDCPStatus); 
+	    dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetHDCPProtocol ,_dsGetHDCPProtocol);
+	    dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetHDCPReceiverProtocol ,_dsGetHDCPReceiverProtocol);
+	    dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetHDCPCurrentProtocol ,_dsGetHDCPCurrentProtocol);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsIsVideoPortActive ,_dsIsVideoPortActive); 
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetTVHDRCapabilities,_dsGetTVHDRCapabilities);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetSupportedTVResolution,_dsSupportedTvResolutions);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetForceDisable4K, _dsSetForceDisable4K); 
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetForceDisable4K, _dsGetForceDisable4K); 
+                dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsIsOutputHDR,_dsIsOutputHDR);
+                dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsResetOutputToSDR,_dsResetOutputToSDR);
+                dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetHdmiPreference,_dsSetHdmiPreference);
+                dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetHdmiPreference,_dsGetHdmiPreference);
+                dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetVideoEOTF,_dsGetVideoEOTF);
+                dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetMatrixCoefficients,_dsGetMatrixCoefficients);
+                dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetColorDepth,_dsGetColorDepth);
+                dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetColorSpace,_dsGetColorSpace);
+                dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetQuantizationRange,_dsGetQuantizationRange);
+                dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetCurrentOutputSettings,_dsGetCurrentOutputSettings);
+                dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetBackgroundColor,_dsSetBackgroundColor);
+                dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetForceHDRMode,_dsSetForceHDRMode);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsColorDepthCapabilities,_dsColorDepthCapabilities);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsGetPreferredColorDepth,_dsGetPreferredColorDepth);
+		dsMgr_RegisterCall(IARM_BUS_DSMGR_API_dsSetPreferredColorDepth,_dsSetPreferredColorDepth);
 	
         dsError_t eRet = _dsVideoFormatUpdateRegisterCB (_dsVideoFormatUpdateCB) ;
         if (dsERR_NONE != eRet) {
@@ -974,6 +978,8 @@ IARM_Result_t _dsSetResolution(void *arg)
 			IARM_BUS_Unlock(lock);
 			return IARM_RESULT_SUCCESS;
 		}
+		uint64_t resolutionChangeStartMs = dsTelemetryNowMs();
+
 		/*!< Resolution Pre Change Event  - IARM_BUS_DSMGR_EVENT_RES_POSTCHANGE */
 		_dsVideoPortPreResolutionCall(&param->resolution);
 
@@ -985,9 +991,15 @@ IARM_Result_t _dsSetResolution(void *arg)
 		
 		if (ret == dsERR_NONE)
 		{
+			/* Pre change event to post change event, as seen by applications */
+			TELEMETRY_LATENCY_MS("SYS_INFO_ResolutionChange_ms", dsTelemetryNowMs() - resolutionChangeStartMs);
 			/*!< Persist Resolution Settings */
 			persistResolution(param);
 		}
+		else
+		{
+			TELEMETRY_COUNT("SYS_ERROR_ResolutionChange_failed");
+		}
 		param->result = ret;
 	}
 		
@@ -1393,7 +1405,7 @@ static int  _dsSendVideoPortPostResolutionCall(dsVideoPortResolution_t *resoluti
 			eventData.data.resn.width = param.width;
 			eventData.data.resn.height = param.height;
 			IARM_BusDaemon_ResolutionPostchange(param);
-			IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,(IARM_EventId_t)IARM_BUS_DSMGR_EVENT_RES_POSTCHANGE,(void *)&eventData, sizeof(eventData));
+			dsMgr_BroadcastEvent((IARM_EventId_t)IARM_BUS_DSMGR_EVENT_RES_POSTCHANGE,(void *)&eventData, sizeof(eventData));
 		}
 	return ret;
 }
@@ -1450,7 +1462,7 @@ static int  _dsVideoPortPreResolutionCall(dsVideoPortResolution_t *resolution)
 			eventData.data.resn.width = param.width;
 			eventData.data.resn.height = param.height;
 			IARM_BusDaemon_ResolutionPrechange(param);
-			IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,(IARM_EventId_t)IARM_BUS_DSMGR_EVENT_RES_PRECHANGE,(void *)&eventData, sizeof(eventData));
+			dsMgr_BroadcastEvent((IARM_EventId_t)IARM_BUS_DSMGR_EVENT_RES_PRECHANGE,(void *)&eventData, sizeof(eventData));
 		}
 	return ret;
 }
@@ -1459,6 +1471,7 @@ static int  _dsVideoPortPreResolutionCall(dsVideoPortResolution_t *resolution)
 void _dsHdcpCallback (intptr_t handle, dsHdcpStatus_t status)
 {
 	IARM_Bus_DSMgr_EventData_t hdcp_eventData;
+	dsEventTraceRecord(dsEVENT_TRACE_HAL_CALLBACK, IARM_BUS_DSMGR_EVENT_HDCP_STATUS, status);
 
 	if (handle == NULL_HANDLE)
 	{
@@ -1474,6 +1487,7 @@ void _dsHdcpCallback (intptr_t handle, dsHdcpStatus_t status)
 
 		case dsHDCP_STATUS_AUTHENTICATIONFAILURE:
 			INT_INFO("DS HDCP Failure Event!!!!!!..\r\n");
+			TELEMETRY_COUNT("HDMI_ERROR_hdcp_auth_failure");
 			 hdcp_eventData.data.hdmi_hdcp.hdcpStatus =  dsHDCP_STATUS_AUTHENTICATIONFAILURE;
 			_hdcpStatus = status;
 			break;
@@ -1509,7 +1523,7 @@ void _dsHdcpCallback (intptr_t handle, dsHdcpStatus_t status)
 	       _dsSyncHdmiStatus(DS_HDMI_TAG_HDCPVERSION, dsHDCP_VERSION_1X);
 	}
 	
-	IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,(IARM_EventId_t)IARM_BUS_DSMGR_EVENT_HDCP_STATUS,(void *)&hdcp_eventData, sizeof(hdcp_eventData));
+	dsMgr_BroadcastEvent((IARM_EventId_t)IARM_BUS_DSMGR_EVENT_HDCP_STATUS,(void *)&hdcp_eventData, sizeof(hdcp_eventData));
 }
 
 IARM_Result_t _dsGetHDCPStatus (void *arg)
@@ -2292,10 +2306,12 @@ IARM_Result_t _dsSetBackgroundColor(void *arg)
 void _dsVideoFormatUpdateCB(dsHDRStandard_t videoFormat)
 {
     IARM_Bus_DSMgr_EventData_t video_format_event_data;
+    dsEventTraceRecord(dsEVENT_TRACE_HAL_CALLBACK, IARM_BUS_DSMGR_EVENT_VIDEO_FORMAT_UPDATE, videoFormat);
+
     INT_INFO("%s: VideoOutPort format:%d \r\n", __FUNCTION__, videoFormat);
     video_format_event_data.data.VideoFormatInfo.videoFormat = videoFormat;
 
-    IARM_Bus_BroadcastEvent(IARM_BUS_DSMGR_NAME,
+    dsMgr_BroadcastEvent(
                            (IARM_EventId_t)IARM_BUS_DSMGR_EVENT_VIDEO_FORMAT_UPDATE,
                            (void *)&video_format_event_data,
                            sizeof(video_format_event_data));
@@ -24,6 +24,8 @@
 * @{
 **/
 
+#define DS_LOG_MODULE dsLOG_MODULE_VIDEOPORT
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -27,6 +27,8 @@
 **/
 
 
+#define DS_LOG_MODULE dsLOG_MODULE_PERSISTENCE
+
 #include <iostream>
 #include <fstream>
 #include <map>
@@ -311,6 +313,49 @@ void HostPersistence::persistHostProperty(const std::string &key, const std::str
     return;
 }
 
+/**
+ * Persists several properties with a single write of the store, e.g. all
+ * the settings changed by one front panel scene. Nothing is written when
+ * every value is already stored.
+ *
+ * @param properties
+ *            keys and values to persist
+ */
+void HostPersistence::persistHostProperties(const std::map<std::string, std::string> &properties)
+{
+    bool changed = false;
+    std::map <std::string, std::string> :: const_iterator it;
+
+    for (it = properties.begin(); it != properties.end(); ++it)
+    {
+        if (it->first.empty() || it->second.empty())
+        {
+            cout << "Given KEY or VALUE is empty..." << endl;
+            throw IllegalArgumentException();
+        }
+        std::map <std::string, std::string> :: const_iterator eFound = _properties.find (it->first);
+        if ((eFound == _properties.end()) || (eFound->second != it->second))
+        {
+            changed = true;
+        }
+    }
+
+    if (!changed) {
+        /* Same values. No need to do anything */
+        return;
+    }
+
+    /* Save a current copy before modifying */
+    writeToFile(filePath + "tmpDB");
+
+    for (it = properties.begin(); it != properties.end(); ++it)
+    {
+        _properties[it->first] = it->second;
+    }
+
+    writeToFile(filePath);
+}
+
 /**
  * Provides a simple utility method for loading the key and defvalue from the backup file.
  *
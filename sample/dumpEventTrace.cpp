@@ -0,0 +1,68 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2016 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+
+/**
+* @defgroup devicesettings
+* @{
+* @defgroup sample
+* @{
+**/
+
+
+#include <stdio.h>
+#include <string.h>
+#include "libIBus.h"
+#include "dsMgr.h"
+#include "dsRpc.h"
+
+/*
+ * Ask dsMgr to write its event trace ring to a file.
+ * Usage: dumpEventTrace
+ * dsMgr writes to a new /tmp/ds_event_trace.<dsMgr pid>.<n> and reports its name.
+ */
+int main()
+{
+	dsEventTraceDumpParam_t param;
+	IARM_Result_t rpcRet;
+
+	memset(&param, 0, sizeof(param));
+
+	IARM_Bus_Init("SampleDSClient");
+	IARM_Bus_Connect();
+
+	rpcRet = IARM_Bus_Call(IARM_BUS_DSMGR_NAME,
+						   (char *)IARM_BUS_DSMGR_API_dsDumpEventTrace,
+						   (void *)&param,
+						   sizeof(param));
+	if (IARM_RESULT_SUCCESS != rpcRet || dsERR_NONE != param.result) {
+		printf("Failed to dump dsMgr event trace, rpc %d result %d\n", rpcRet, param.result);
+	}
+	else {
+		printf("dsMgr dumped %d event trace records to %s\n", param.records, param.path);
+	}
+
+	IARM_Bus_Disconnect();
+	IARM_Bus_Term();
+	return 0;
+}
+
+
+/** @} */
+/** @} */
@@ -0,0 +1,105 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2025 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+
+/**
+* @defgroup devicesettings
+* @{
+* @defgroup sample
+* @{
+**/
+
+
+#include <stdio.h>
+#include <string.h>
+#include "libIBus.h"
+#include "dsMgr.h"
+#include "dsRpc.h"
+
+/*
+ * Print the per RPC method counters of dsMgr. Times are in microseconds;
+ * "hold" is the time the method held its module lock, i.e. spent in the HAL.
+ * Methods that were never called are left out unless -a is given.
+ * Usage: dumpPerfStats [-a] [-r]
+ *   -a  list all methods
+ *   -r  reset the counters after reading them
+ */
+int main(int argc, char *argv[])
+{
+	dsPerfStatsParam_t param;
+	IARM_Result_t rpcRet = IARM_RESULT_SUCCESS;
+	bool all = false;
+	bool reset = false;
+	int first = 0;
+	int total = 0;
+
+	for (int i = 1; i < argc; i++) {
+		if (0 == strcmp(argv[i], "-a")) {
+			all = true;
+		}
+		else if (0 == strcmp(argv[i], "-r")) {
+			reset = true;
+		}
+		else {
+			printf("Usage: %s [-a] [-r]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	IARM_Bus_Init("SampleDSClient");
+	IARM_Bus_Connect();
+
+	printf("%-40s %10s %8s %12s %10s %12s %12s\n", "method", "calls", "errors", "avg", "max", "wait", "hold");
+	do {
+		memset(&param, 0, sizeof(param));
+		param.first = first;
+		param.reset = reset;
+
+		rpcRet = IARM_Bus_Call(IARM_BUS_DSMGR_NAME,
+							   (char *)IARM_BUS_DSMGR_API_dsGetPerfStats,
+							   (void *)&param,
+							   sizeof(param));
+		if (IARM_RESULT_SUCCESS != rpcRet || dsERR_NONE != param.result) {
+			printf("Failed to read dsMgr perf stats, rpc %d result %d\n", rpcRet, param.result);
+			break;
+		}
+
+		for (int i = 0; i < param.count; i++) {
+			const dsPerfStat_t *stat = &param.stats[i];
+			if ((0 == stat->calls) && !all) {
+				continue;
+			}
+			printf("%-40s %10llu %8llu %12llu %10llu %12llu %12llu\n", stat->method,
+				   (unsigned long long)stat->calls, (unsigned long long)stat->errors,
+				   (unsigned long long)(stat->calls ? stat->totalUs / stat->calls : 0),
+				   (unsigned long long)stat->maxUs, (unsigned long long)stat->lockWaitUs,
+				   (unsigned long long)stat->lockHeldUs);
+		}
+		total = param.total;
+		first += param.count;
+	} while ((param.count > 0) && (first < total));
+
+	IARM_Bus_Disconnect();
+	IARM_Bus_Term();
+	return 0;
+}
+
+
+/** @} */
+/** @} */
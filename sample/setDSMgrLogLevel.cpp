@@ -0,0 +1,77 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2016 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+
+/**
+* @defgroup devicesettings
+* @{
+* @defgroup sample
+* @{
+**/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "libIBus.h"
+#include "dsMgr.h"
+#include "dsRpc.h"
+
+/*
+ * Change the log level of a dsMgr module at runtime.
+ * Usage: setDSMgrLogLevel <module|-1> <level>
+ *   module: 0 general, 1 audio, 2 videoport, 3 display, 4 hdmiin, 5 fpd, 6 persistence, -1 all
+ *   level : 0 off, 1 error, 2 warn, 3 info, 4 debug, 5 trace
+ */
+int main(int argc, char *argv[])
+{
+	dsLogLevelParam_t param;
+	IARM_Result_t rpcRet;
+
+	if (argc < 3) {
+		printf("Usage: %s <module|-1> <level>\n", argv[0]);
+		return 1;
+	}
+
+	memset(&param, 0, sizeof(param));
+	param.module = atoi(argv[1]);
+	param.level = atoi(argv[2]);
+
+	IARM_Bus_Init("SampleDSClient");
+	IARM_Bus_Connect();
+
+	rpcRet = IARM_Bus_Call(IARM_BUS_DSMGR_NAME,
+						   (char *)IARM_BUS_DSMGR_API_dsSetLogLevel,
+						   (void *)&param,
+						   sizeof(param));
+	if (IARM_RESULT_SUCCESS != rpcRet || dsERR_NONE != param.result) {
+		printf("Failed to set log level, rpc %d result %d\n", rpcRet, param.result);
+	}
+	else {
+		printf("Log level of module %d set to %d\n", param.module, param.level);
+	}
+
+	IARM_Bus_Disconnect();
+	IARM_Bus_Term();
+	return 0;
+}
+
+
+/** @} */
+/** @} */
@@ -0,0 +1,1051 @@
+/*
+ * Simulated device settings HAL.
+ *
+ * Built as libdshalsim.so by cov_build.sh, it can stand in for the vendor
+ * HAL (install it as RDK_DSHAL_NAME, or build dsMgr with
+ * -DRDK_DSHAL_NAME=\"libdshalsim.so\" -ldshalsim). The dsAudio, dsVideoPort,
+ * dsDisplay, dsHdmiIn and dsFPD entry points work on an in-memory device
+ * model, so values set are read back, and each call can be slowed down and
+ * failed at random to reproduce slow or flaky HALs. Entry points that are
+ * not simulated are left undefined and are reported missing by the dlsym()
+ * lookups of dsMgr, as on platforms that do not implement them.
+ *
+ * The configuration file is read on the first *Init() call from
+ * DSHAL_SIM_CONFIG, see dshal_sim.conf for the format. Random draws use a
+ * fixed seed, so a run with the same configuration and call sequence
+ * injects the same latencies and errors.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <map>
+#include <string>
+#include <vector>
+#include <random>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+
+#include "dsTypes.h"
+#include "dsError.h"
+#include "dsAudio.h"
+#include "dsVideoPort.h"
+#include "dsDisplay.h"
+#include "dsHdmiIn.h"
+#include "dsFPD.h"
+
+using namespace std;
+
+#define SIM_LOG(...)    fprintf(stderr, "[dshal-sim] " __VA_ARGS__)
+
+namespace {
+
+enum LatencyDist {
+    LATENCY_NONE = 0,
+    LATENCY_FIXED,          /* a us */
+    LATENCY_UNIFORM,        /* between a and b us */
+    LATENCY_NORMAL,         /* mean a us, standard deviation b us */
+    LATENCY_EXPONENTIAL     /* mean a us */
+};
+
+struct Fault {
+    LatencyDist dist;
+    double a;
+    double b;
+    double errorRate;
+    dsError_t error;
+
+    Fault() : dist(LATENCY_NONE), a(0), b(0), errorRate(0), error(dsERR_GENERAL) {}
+};
+
+enum ScriptAction {
+    SCRIPT_HOTPLUG,         /* display connected 0|1 */
+    SCRIPT_RXSENSE,         /* rx sense 0|1 */
+    SCRIPT_HDCP,            /* dsHdcpStatus_t */
+    SCRIPT_HDMIIN,          /* hdmi in port, connected 0|1 */
+    SCRIPT_AUDIO            /* audio port type, index, connected 0|1 */
+};
+
+struct ScriptStep {
+    unsigned int atMs;
+    ScriptAction action;
+    int arg[3];
+};
+
+#define SIM_AUDIO_PORTS     dsAUDIOPORT_TYPE_MAX
+#define SIM_VIDEO_HANDLE    ((intptr_t)0x5600)
+#define SIM_DISPLAY_HANDLE  ((intptr_t)0x5d00)
+#define SIM_AUDIO_HANDLE    ((intptr_t)0x5a00)
+
+struct AudioPort {
+    bool enabled;
+    bool muted;
+    bool connected;
+    float level;
+    float gain;
+};
+
+struct Model {
+    bool displayConnected;
+    bool videoEnabled;
+    bool hdcpEnabled;
+    dsHdcpStatus_t hdcpStatus;
+    dsVideoPortResolution_t resolution;
+    vector<unsigned char> edid;
+    AudioPort audio[SIM_AUDIO_PORTS];
+    int hdmiInPorts;
+    bool hdmiInConnected[dsHDMI_IN_PORT_MAX];
+    dsHdmiInPort_t hdmiInActive;
+    dsFPDBrightness_t fpBrightness[dsFPD_INDICATOR_MAX];
+    dsFPDColor_t fpColor[dsFPD_INDICATOR_MAX];
+    dsFPDState_t fpState[dsFPD_INDICATOR_MAX];
+    string fpText;
+};
+
+mutex simLock;
+bool configured = false;
+mt19937 rng(1);
+map<string, Fault> faults;
+Fault defaultFault;
+vector<ScriptStep> script;
+unsigned int scriptRepeatMs = 0;
+Model model;
+
+dsDisplayEventCallback_t displayCallback = NULL;
+dsHDCPStatusCallback_t hdcpCallback = NULL;
+dsHdmiInConnectCB_t hdmiInConnectCallback = NULL;
+dsAudioOutPortConnectCB_t audioConnectCallback = NULL;
+
+mutex scriptLock;
+condition_variable scriptCond;
+thread scriptThread;
+bool scriptRunning = false;
+
+/* A 128 byte EDID 1.3 base block of a 1080p display, "RDK" manufacturer */
+void defaultEdid(vector<unsigned char> &edid)
+{
+    static const unsigned char base[128] = {
+        0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x48, 0x8b, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+        0x01, 0x22, 0x01, 0x03, 0x80, 0x50, 0x2d, 0x78, 0x0a, 0x0d, 0xc9, 0xa0, 0x57, 0x47, 0x98, 0x27,
+        0x12, 0x48, 0x4c, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+        0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x3a, 0x80, 0x18, 0x71, 0x38, 0x2d, 0x40, 0x58, 0x2c,
+        0x45, 0x00, 0x20, 0xc2, 0x31, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x44, 0x53, 0x48,
+        0x41, 0x4c, 0x2d, 0x53, 0x49, 0x4d, 0x0a, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x17,
+        0x3d, 0x0f, 0x44, 0x0f, 0x00, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x10,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    };
+    edid.assign(base, base + sizeof(base));
+    unsigned char sum = 0;
+    for (size_t i = 0; i < 127; i++) {
+        sum += edid[i];
+    }
+    edid[127] = (unsigned char)(0x100 - sum);
+}
+
+void defaultModel()
+{
+    model.displayConnected = true;
+    model.videoEnabled = true;
+    model.hdcpEnabled = true;
+    model.hdcpStatus = dsHDCP_STATUS_AUTHENTICATED;
+    memset(&model.resolution, 0, sizeof(model.resolution));
+    snprintf(model.resolution.name, sizeof(model.resolution.name), "%s", "1080p60");
+    model.resolution.pixelResolution = dsVIDEO_PIXELRES_1920x1080;
+    model.resolution.aspectRatio = dsVIDEO_ASPECT_RATIO_16x9;
+    model.resolution.stereoScopicMode = dsVIDEO_SSMODE_2D;
+    model.resolution.frameRate = dsVIDEO_FRAMERATE_60;
+    model.resolution.interlaced = false;
+    defaultEdid(model.edid);
+    for (int i = 0; i < SIM_AUDIO_PORTS; i++) {
+        model.audio[i].enabled = true;
+        model.audio[i].muted = false;
+        model.audio[i].connected = true;
+        model.audio[i].level = 50;
+        model.audio[i].gain = 0;
+    }
+    model.hdmiInPorts = 3;
+    for (int i = 0; i < dsHDMI_IN_PORT_MAX; i++) {
+        model.hdmiInConnected[i] = false;
+    }
+    model.hdmiInActive = dsHDMI_IN_PORT_NONE;
+    for (int i = 0; i < dsFPD_INDICATOR_MAX; i++) {
+        model.fpBrightness[i] = 100;
+        model.fpColor[i] = 0;
+        model.fpState[i] = dsFPD_STATE_ON;
+    }
+}
+
+bool parseLatency(const vector<string> &words, Fault &fault)
+{
+    /* latency <function|*> fixed <us> | uniform <min> <max> | normal <mean> <sd> | exp <mean> */
+    if (words.size() < 4) {
+        return false;
+    }
+    fault.a = atof(words[3].c_str());
+    fault.b = (words.size() > 4) ? atof(words[4].c_str()) : 0;
+    if (words[2] == "fixed") {
+        fault.dist = LATENCY_FIXED;
+    } else if ((words[2] == "uniform") && (words.size() > 4)) {
+        fault.dist = LATENCY_UNIFORM;
+    } else if ((words[2] == "normal") && (words.size() > 4)) {
+        fault.dist = LATENCY_NORMAL;
+    } else if (words[2] == "exp") {
+        fault.dist = LATENCY_EXPONENTIAL;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+bool parseScript(const vector<string> &words)
+{
+    /* at <ms> hotplug|rxsense <0|1> | hdcp <status> | hdmiin <port> <0|1> | audio <type> <index> <0|1> */
+    static const struct { const char *name; ScriptAction action; size_t args; } actions[] = {
+        { "hotplug", SCRIPT_HOTPLUG, 1 },
+        { "rxsense", SCRIPT_RXSENSE, 1 },
+        { "hdcp", SCRIPT_HDCP, 1 },
+        { "hdmiin", SCRIPT_HDMIIN, 2 },
+        { "audio", SCRIPT_AUDIO, 3 },
+    };
+    if (words.size() < 3) {
+        return false;
+    }
+    for (size_t i = 0; i < sizeof(actions) / sizeof(actions[0]); i++) {
+        if ((words[2] == actions[i].name) && (words.size() == 3 + actions[i].args)) {
+            ScriptStep step;
+            step.atMs = (unsigned int)atoi(words[1].c_str());
+            step.action = actions[i].action;
+            for (size_t j = 0; j < 3; j++) {
+                step.arg[j] = (j < actions[i].args) ? atoi(words[3 + j].c_str()) : 0;
+            }
+            script.push_back(step);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool loadEdid(const char *path)
+{
+    FILE *file = fopen(path, "rb");
+    if (NULL == file) {
+        return false;
+    }
+    unsigned char bytes[1024];
+    size_t length = fread(bytes, 1, sizeof(bytes), file);
+    fclose(file);
+    if ((0 == length) || (length % 128)) {
+        return false;
+    }
+    model.edid.assign(bytes, bytes + length);
+    return true;
+}
+
+bool parseState(const vector<string> &words)
+{
+    /* state display|hdcp|hdmiin-ports <value> */
+    if (words.size() != 3) {
+        return false;
+    }
+    int value = atoi(words[2].c_str());
+    if (words[1] == "display") {
+        model.displayConnected = (0 != value);
+    } else if (words[1] == "hdcp") {
+        model.hdcpStatus = (dsHdcpStatus_t)value;
+    } else if ((words[1] == "hdmiin-ports") && (value >= 0) && (value <= dsHDMI_IN_PORT_MAX)) {
+        model.hdmiInPorts = value;
+    } else if (words[1] == "edid") {
+        return loadEdid(words[2].c_str());
+    } else {
+        return false;
+    }
+    return true;
+}
+
+/* Called with simLock held */
+void configure()
+{
+    if (configured) {
+        return;
+    }
+    configured = true;
+    defaultModel();
+
+    const char *path = getenv("DSHAL_SIM_CONFIG");
+    if (NULL == path) {
+        return;
+    }
+    FILE *file = fopen(path, "r");
+    if (NULL == file) {
+        SIM_LOG("cannot open %s\n", path);
+        return;
+    }
+    char line[512];
+    int lineNo = 0;
+    while (fgets(line, sizeof(line), file)) {
+        lineNo++;
+        vector<string> words;
+        for (char *save = NULL, *word = strtok_r(line, " \t\r\n", &save); word && ('#' != word[0]);
+             word = strtok_r(NULL, " \t\r\n", &save)) {
+            words.push_back(word);
+        }
+        if (words.empty()) {
+            continue;
+        }
+
+        bool ok = false;
+        if ((words[0] == "seed") && (words.size() == 2)) {
+            rng.seed((unsigned int)strtoul(words[1].c_str(), NULL, 0));
+            ok = true;
+        } else if ((words[0] == "latency") && (words.size() > 1)) {
+            Fault &fault = (words[1] == "*") ? defaultFault : faults[words[1]];
+            ok = parseLatency(words, fault);
+        } else if ((words[0] == "error") && (words.size() >= 3)) {
+            /* error <function|*> <rate 0..1> [dsError_t] */
+            Fault &fault = (words[1] == "*") ? defaultFault : faults[words[1]];
+            fault.errorRate = atof(words[2].c_str());
+            fault.error = (words.size() > 3) ? (dsError_t)atoi(words[3].c_str()) : dsERR_GENERAL;
+            ok = true;
+        } else if (words[0] == "state") {
+            ok = parseState(words);
+        } else if (words[0] == "at") {
+            ok = parseScript(words);
+        } else if ((words[0] == "repeat") && (words.size() == 2)) {
+            scriptRepeatMs = (unsigned int)atoi(words[1].c_str());
+            ok = true;
+        }
+        if (!ok) {
+            SIM_LOG("%s:%d: cannot parse '%s'\n", path, lineNo, words[0].c_str());
+        }
+    }
+    fclose(file);
+    SIM_LOG("loaded %s: %zu function overrides, %zu script steps\n", path, faults.size(), script.size());
+}
+
+/*
+ * Every entry point starts here: sleeps for the latency drawn for the
+ * function, then returns the injected error, or dsERR_NONE to go on.
+ */
+dsError_t enter(const char *function)
+{
+    unsigned int sleepUs = 0;
+    dsError_t ret = dsERR_NONE;
+    {
+        lock_guard<mutex> lock(simLock);
+        configure();
+        map<string, Fault>::const_iterator it = faults.find(function);
+        const Fault &fault = (it != faults.end()) ? it->second : defaultFault;
+        double us = 0;
+        switch (fault.dist) {
+        case LATENCY_FIXED:
+            us = fault.a;
+            break;
+        case LATENCY_UNIFORM:
+            us = uniform_real_distribution<double>(fault.a, fault.b)(rng);
+            break;
+        case LATENCY_NORMAL:
+            us = normal_distribution<double>(fault.a, fault.b)(rng);
+            break;
+        case LATENCY_EXPONENTIAL:
+            us = (fault.a > 0) ? exponential_distribution<double>(1.0 / fault.a)(rng) : 0;
+            break;
+        case LATENCY_NONE:
+            break;
+        }
+        sleepUs = (us > 0) ? (unsigned int)us : 0;
+        if ((fault.errorRate > 0) && (uniform_real_distribution<double>(0, 1)(rng) < fault.errorRate)) {
+            ret = fault.error;
+        }
+    }
+    if (sleepUs) {
+        usleep(sleepUs);
+    }
+    return ret;
+}
+
+#define SIM_ENTER() \
+    do { \
+        dsError_t simError = enter(__FUNCTION__); \
+        if (dsERR_NONE != simError) { \
+            return simError; \
+        } \
+    } while (0)
+
+void runStep(const ScriptStep &step)
+{
+    switch (step.action) {
+    case SCRIPT_HOTPLUG:
+    case SCRIPT_RXSENSE: {
+        dsDisplayEvent_t event;
+        if (SCRIPT_HOTPLUG == step.action) {
+            event = step.arg[0] ? dsDISPLAY_EVENT_CONNECTED : dsDISPLAY_EVENT_DISCONNECTED;
+        } else {
+            event = step.arg[0] ? dsDISPLAY_RXSENSE_ON : dsDISPLAY_RXSENSE_OFF;
+        }
+        dsDisplayEventCallback_t callback;
+        {
+            lock_guard<mutex> lock(simLock);
+            if (SCRIPT_HOTPLUG == step.action) {
+                model.displayConnected = (0 != step.arg[0]);
+            }
+            callback = displayCallback;
+        }
+        if (callback) {
+            callback(SIM_DISPLAY_HANDLE, event, NULL);
+        }
+        break;
+    }
+    case SCRIPT_HDCP: {
+        dsHDCPStatusCallback_t callback;
+        {
+            lock_guard<mutex> lock(simLock);
+            model.hdcpStatus = (dsHdcpStatus_t)step.arg[0];
+            callback = hdcpCallback;
+        }
+        if (callback) {
+            callback(SIM_VIDEO_HANDLE, (dsHdcpStatus_t)step.arg[0]);
+        }
+        break;
+    }
+    case SCRIPT_HDMIIN: {
+        if ((step.arg[0] < 0) || (step.arg[0] >= dsHDMI_IN_PORT_MAX)) {
+            break;
+        }
+        dsHdmiInConnectCB_t callback;
+        {
+            lock_guard<mutex> lock(simLock);
+            model.hdmiInConnected[step.arg[0]] = (0 != step.arg[1]);
+            callback = hdmiInConnectCallback;
+        }
+        if (callback) {
+            callback((dsHdmiInPort_t)step.arg[0], 0 != step.arg[1]);
+        }
+        break;
+    }
+    case SCRIPT_AUDIO: {
+        if ((step.arg[0] < 0) || (step.arg[0] >= SIM_AUDIO_PORTS)) {
+            break;
+        }
+        dsAudioOutPortConnectCB_t callback;
+        {
+            lock_guard<mutex> lock(simLock);
+            model.audio[step.arg[0]].connected = (0 != step.arg[2]);
+            callback = audioConnectCallback;
+        }
+        if (callback) {
+            callback((dsAudioPortType_t)step.arg[0], (unsigned int)step.arg[1], 0 != step.arg[2]);
+        }
+        break;
+    }
+    }
+}
+
+void runScript()
+{
+    unique_lock<mutex> lock(scriptLock);
+    do {
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        for (size_t i = 0; (i < script.size()) && scriptRunning; i++) {
+            if (scriptCond.wait_until(lock, start + chrono::milliseconds(script[i].atMs),
+                                      [] { return !scriptRunning; })) {
+                break;
+            }
+            lock.unlock();
+            runStep(script[i]);
+            lock.lock();
+        }
+        if (scriptRepeatMs && scriptRunning) {
+            scriptCond.wait_until(lock, start + chrono::milliseconds(scriptRepeatMs), [] { return !scriptRunning; });
+        }
+    } while (scriptRepeatMs && scriptRunning);
+}
+
+/* The script starts with the first module that is initialized */
+void startScript()
+{
+    {
+        lock_guard<mutex> lock(simLock);
+        configure();
+    }
+    lock_guard<mutex> lock(scriptLock);
+    if (!scriptRunning && !script.empty()) {
+        scriptRunning = true;
+        scriptThread = thread(runScript);
+    }
+}
+
+int simModules = 0;
+
+void moduleInit()
+{
+    startScript();
+    lock_guard<mutex> lock(scriptLock);
+    simModules++;
+}
+
+void moduleTerm()
+{
+    {
+        lock_guard<mutex> lock(scriptLock);
+        if ((simModules > 0) && (0 != --simModules)) {
+            return;
+        }
+        if (!scriptRunning) {
+            return;
+        }
+        scriptRunning = false;
+        scriptCond.notify_all();
+    }
+    scriptThread.join();
+}
+
+AudioPort *audioPort(intptr_t handle)
+{
+    intptr_t index = handle - SIM_AUDIO_HANDLE;
+    return ((index >= 0) && (index < SIM_AUDIO_PORTS)) ? &model.audio[index] : NULL;
+}
+
+}
+
+extern "C" {
+
+/* dsAudio */
+
+dsError_t dsAudioPortInit()
+{
+    SIM_ENTER();
+    moduleInit();
+    return dsERR_NONE;
+}
+
+dsError_t dsAudioPortTerm()
+{
+    SIM_ENTER();
+    moduleTerm();
+    return dsERR_NONE;
+}
+
+dsError_t dsGetAudioPort(dsAudioPortType_t type, int index, intptr_t *handle)
+{
+    SIM_ENTER();
+    if ((NULL == handle) || (type < 0) || (type >= SIM_AUDIO_PORTS) || (0 != index)) {
+        return dsERR_INVALID_PARAM;
+    }
+    *handle = SIM_AUDIO_HANDLE + type;
+    return dsERR_NONE;
+}
+
+dsError_t dsSetAudioMute(intptr_t handle, bool mute)
+{
+    SIM_ENTER();
+    lock_guard<mutex> lock(simLock);
+    AudioPort *port = audioPort(handle);
+    if (NULL == port) {
+        return dsERR_INVALID_PARAM;
+    }
+    port->muted = mute;
+    return dsERR_NONE;
+}
+
+dsError_t dsIsAudioMute(intptr_t handle, bool *muted)
+{
+    SIM_ENTER();
+    lock_guard<mutex> lock(simLock);
+    AudioPort *port = audioPort(handle);
+    if ((NULL == port) || (NULL == muted)) {
+        return dsERR_INVALID_PARAM;
+    }
+    *muted = port->muted;
+    return dsERR_NONE;
+}
+
+dsError_t dsSetAudioLevel(intptr_t handle, float level)
+{
+    SIM_ENTER();
+    lock_guard<mutex> lock(simLock);
+    AudioPort *port = audioPort(handle);
+    if ((NULL == port) || (level < 0) || (level > 100)) {
+        return dsERR_INVALID_PARAM;
+    }
+    port->level = level;
+    return dsERR_NONE;
+}
+
+dsError_t dsGetAudioLevel(intptr_t handle, float *level)
+{
+    SIM_ENTER();
+    lock_guard<mutex> lock(simLock);
+    AudioPort *port = audioPort(handle);
+    if ((NULL == port) || (NULL == level)) {
+        return dsERR_INVALID_PARAM;
+    }
+    *level = port->level;
+    return dsERR_NONE;
+}
+
+dsError_t dsSetAudioGain(intptr_t handle, float gain)
+{
+    SIM_ENTER();
+    lock_guard<mutex> lock(simLock);
+    AudioPort *port = audioPort(handle);
+    if (NULL == port) {
+        return dsERR_INVALID_PARAM;
+    }
+    port->gain = gain;
+    return dsERR_NONE;
+}
+
+dsError_t dsGetAudioGain(intptr_t handle, float *gain)
+{
+    SIM_ENTER();
+    lock_guard<mutex> lock(simLock);
+    AudioPort *port = audioPort(handle);
+    if ((NULL == port) || (NULL == gain)) {
+        return dsERR_INVALID_PARAM;
+    }
+    *gain = port->gain;
+    return dsERR_NONE;
+}
+
+dsError_t dsEnableAudioPort(intptr_t handle, bool enabled)
+{
+    SIM_ENTER();
+    lock_guard<mutex> lock(simLock);
+    AudioPort *port = audioPort(handle);
+    if (NULL == port) {
+        return dsERR_INVALID_PARAM;
+    }
+    port->enabled = enabled;
+    return dsERR_NONE;
+}
+
+dsError_t dsIsAudioPortEnabled(intptr_t handle, bool *enabled)
+{
+    SIM_ENTER();
+    lock_guard<mutex> lock(simLock);
+    AudioPort *port = audioPort(handle);
+    if ((NULL == port) || (NULL == enabled)) {
+        return dsERR_INVALID_PARAM;
+    }
+    *enabled = port->enabled;
+    return dsERR_NONE;
+}
+
+dsError_t dsAudioOutIsConnected(intptr_t handle, bool *connected)
+{
+    SIM_ENTER();
+    lock_guard<mutex> lock(simLock);
+    AudioPort *port = audioPort(handle);
+    if ((NULL == port) || (NULL == connected)) {
+        return dsERR_INVALID_PARAM;
+    }
+    *connected = port->connected;
+    return dsERR_NONE;
+}
+
+dsError_t dsAudioOutRegisterConnectCB(dsAudioOutPortConnectCB_t callback)
+{
+    SIM_ENTER();
+    lock_guard<mutex> lock(simLock);
+    audioConnectCallback = callback;
+    return dsERR_NONE;
+}
+
+/* dsVideoPort */
+
+dsError_t dsVideoPortInit()
+{
+    SIM_ENTER();
+    moduleInit();
+    return dsERR_NONE;
+}
+
+dsError_t dsVideoPortTerm()
+{
+    SIM_ENTER();
+    moduleTerm();
+    return dsERR_NONE;
+}
+
+dsError_t dsGetVideoPort(dsVideoPortType_t type, int index, intptr_t *handle)
+{
+    SIM_ENTER();
+    if ((NULL == handle) || (dsVIDEOPORT_TYPE_HDMI != type) || (0 != index)) {
+        return dsERR_INVALID_PARAM;
+    }
+    *handle = SIM_VIDEO_HANDLE;
+    return dsERR_NONE;
+}
+
+dsError_t dsIsVideoPortEnabled(intptr_t handle, bool *enabled)
+{
+    SIM_ENTER();
+    if ((SIM_VIDEO_HANDLE != handle) || (NULL == enabled)) {
+        return dsERR_INVALID_PARAM;
+    }
+    lock_guard<mutex> lock(simLock);
+    *enabled = model.videoEnabled;
+    return dsERR_NONE;
+}
+
+dsError_t dsEnableVideoPort(intptr_t handle, bool enabled)
+{
+    SIM_ENTER();
+    if (SIM_VIDEO_HANDLE != handle) {
+        return dsERR_INVALID_PARAM;
+    }
+    lock_guard<mutex> lock(simLock);
+    model.videoEnabled = enabled;
+    return dsERR_NONE;
+}
+
+dsError_t dsIsDisplayConnected(intptr_t handle, bool *connected)
+{
+    SIM_ENTER();
+    if ((SIM_VIDEO_HANDLE != handle) || (NULL == connected)) {
+        return dsERR_INVALID_PARAM;
+    }
+    lock_guard<mutex> lock(simLock);
+    *connected = model.displayConnected;
+    return dsERR_NONE;
+}
+
+dsError_t dsIsDisplaySurround(intptr_t handle, bool *surround)
+{
+    SIM_ENTER();
+    if ((SIM_VIDEO_HANDLE != handle) || (NULL == surround)) {
+        return dsERR_INVALID_PARAM;
+    }
+    *surround = false;
+    return dsERR_NONE;
+}
+
+dsError_t dsGetResolution(intptr_t handle, dsVideoPortResolution_t *resolution)
+{
+    SIM_ENTER();
+    if ((SIM_VIDEO_HANDLE != handle) || (NULL == resolution)) {
+        return dsERR_INVALID_PARAM;
+    }
+    lock_guard<mutex> lock(simLock);
+    *resolution = model.resolution;
+    return dsERR_NONE;
+}
+
+dsError_t dsSetResolution(intptr_t handle, dsVideoPortResolution_t *resolution)
+{
+    SIM_ENTER();
+    if ((SIM_VIDEO_HANDLE != handle) || (NULL == resolution)) {
+        return dsERR_INVALID_PARAM;
+    }
+    lock_guard<mutex> lock(simLock);
+    model.resolution = *resolution;
+    return dsERR_NONE;
+}
+
+dsError_t dsIsHDCPEnabled(intptr_t handle, bool *enabled)
+{
+    SIM_ENTER();
+    if ((SIM_VIDEO_HANDLE != handle) || (NULL == enabled)) {
+        return dsERR_INVALID_PARAM;
+    }
+    lock_guard<mutex> lock(simLock);
+    *enabled = model.hdcpEnabled;
+    return dsERR_NONE;
+}
+
+dsError_t dsGetHDCPStatus(intptr_t handle, dsHdcpStatus_t *status)
+{
+    SIM_ENTER();
+    if ((SIM_VIDEO_HANDLE != handle) || (NULL == status)) {
+        return dsERR_INVALID_PARAM;
+    }
+    lock_guard<mutex> lock(simLock);
+    *status = model.hdcpStatus;
+    return dsERR_NONE;
+}
+
+dsError_t dsRegisterHdcpStatusCallback(intptr_t handle, dsHDCPStatusCallback_t callback)
+{
+    SIM_ENTER();
+    lock_guard<mutex> lock(simLock);
+    hdcpCallback = callback;
+    return dsERR_NONE;
+}
+
+/* dsDisplay */
+
+dsError_t dsDisplayInit()
+{
+    SIM_ENTER();
+    moduleInit();
+    return dsERR_NONE;
+}
+
+dsError_t dsDisplayTerm()
+{
+    SIM_ENTER();
+    moduleTerm();
+    return dsERR_NONE;
+}
+
+dsError_t dsGetDisplay(dsVideoPortType_t type, int index, intptr_t *handle)
+{
+    SIM_ENTER();
+    if ((NULL == handle) || (dsVIDEOPORT_TYPE_HDMI != type) || (0 != index)) {
+        return dsERR_INVALID_PARAM;
+    }
+    *handle = SIM_DISPLAY_HANDLE;
+    return dsERR_NONE;
+}
+
+dsError_t dsGetDisplayAspectRatio(intptr_t handle, dsVideoAspectRatio_t *aspectRatio)
+{
+    SIM_ENTER();
+    if ((SIM_DISPLAY_HANDLE != handle) || (NULL == aspectRatio)) {
+        return dsERR_INVALID_PARAM;
+    }
+    *aspectRatio = dsVIDEO_ASPECT_RATIO_16x9;
+    return dsERR_NONE;
+}
+
+dsError_t dsGetEDID(intptr_t handle, dsDisplayEDID_t *edid)
+{
+    SIM_ENTER();
+    if ((SIM_DISPLAY_HANDLE != handle) || (NULL == edid)) {
+        return dsERR_INVALID_PARAM;
+    }
+    lock_guard<mutex> lock(simLock);
+    if (!model.displayConnected) {
+        return dsERR_GENERAL;
+    }
+    memset(edid, 0, sizeof(*edid));
+    edid->productCode = model.edid[10] | (model.edid[11] << 8);
+    edid->serialNumber = model.edid[12] | (model.edid[13] << 8) | (model.edid[14] << 16) | (model.edid[15] << 24);
+    edid->manufactureWeek = model.edid[16];
+    edid->manufactureYear = 1990 + model.edid[17];
+    edid->hdmiDeviceType = true;
+    snprintf(edid->monitorName, sizeof(edid->monitorName), "%s", "DSHAL-SIM");
+    return dsERR_NONE;
+}
+
+dsError_t dsGetEDIDBytes(intptr_t handle, unsigned char *edid, int *length)
+{
+    SIM_ENTER();
+    if ((SIM_DISPLAY_HANDLE != handle) || (NULL == edid) || (NULL == length)) {
+        return dsERR_INVALID_PARAM;
+    }
+    lock_guard<mutex> lock(simLock);
+    if (!model.displayConnected) {
+        return dsERR_GENERAL;
+    }
+    memcpy(edid, &model.edid[0], model.edid.size());
+    *length = (int)model.edid.size();
+    return dsERR_NONE;
+}
+
+dsError_t dsRegisterDisplayEventCallback(intptr_t handle, dsDisplayEventCallback_t callback)
+{
+    SIM_ENTER();
+    lock_guard<mutex> lock(simLock);
+    displayCallback = callback;
+    return dsERR_NONE;
+}
+
+/* dsHdmiIn */
+
+dsError_t dsHdmiInInit()
+{
+    SIM_ENTER();
+    moduleInit();
+    return dsERR_NONE;
+}
+
+dsError_t dsHdmiInTerm()
+{
+    SIM_ENTER();
+    moduleTerm();
+    return dsERR_NONE;
+}
+
+dsError_t dsHdmiInGetNumberOfInputs(uint8_t *numberOfInputs)
+{
+    SIM_ENTER();
+    if (NULL == numberOfInputs) {
+        return dsERR_INVALID_PARAM;
+    }
+    lock_guard<mutex> lock(simLock);
+    *numberOfInputs = (uint8_t)model.hdmiInPorts;
+    return dsERR_NONE;
+}
+
+dsError_t dsHdmiInGetStatus(dsHdmiInStatus_t *status)
+{
+    SIM_ENTER();
+    if (NULL == status) {
+        return dsERR_INVALID_PARAM;
+    }
+    lock_guard<mutex> lock(simLock);
+    memset(status, 0, sizeof(*status));
+    for (int i = 0; i < model.hdmiInPorts; i++) {
+        status->isPortConnected[i] = model.hdmiInConnected[i];
+    }
+    status->activePort = model.hdmiInActive;
+    status->isPresented = (dsHDMI_IN_PORT_NONE != model.hdmiInActive) && model.hdmiInConnected[model.hdmiInActive];
+    return dsERR_NONE;
+}
+
+dsError_t dsHdmiInSelectPort(dsHdmiInPort_t port, bool requestAudioMix, dsVideoPlaneType_t videoPlaneType, bool topMost)
+{
+    SIM_ENTER();
+    lock_guard<mutex> lock(simLock);
+    if ((dsHDMI_IN_PORT_NONE != port) && ((port < 0) || (port >= model.hdmiInPorts))) {
+        return dsERR_INVALID_PARAM;
+    }
+    model.hdmiInActive = port;
+    return dsERR_NONE;
+}
+
+dsError_t dsHdmiInRegisterConnectCB(dsHdmiInConnectCB_t callback)
+{
+    SIM_ENTER();
+    lock_guard<mutex> lock(simLock);
+    hdmiInConnectCallback = callback;
+    return dsERR_NONE;
+}
+
+dsError_t dsGetEDIDBytesInfo(dsHdmiInPort_t port, unsigned char *edid, int *length)
+{
+    SIM_ENTER();
+    if ((port < 0) || (port >= dsHDMI_IN_PORT_MAX) || (NULL == edid) || (NULL == length)) {
+        return dsERR_INVALID_PARAM;
+    }
+    lock_guard<mutex> lock(simLock);
+    memcpy(edid, &model.edid[0], model.edid.size());
+    *length = (int)model.edid.size();
+    return dsERR_NONE;
+}
+
+dsError_t dsGetHDMISPDInfo(dsHdmiInPort_t port, unsigned char *data)
+{
+    SIM_ENTER();
+    if ((port < 0) || (port >= dsHDMI_IN_PORT_MAX) || (NULL == data)) {
+        return dsERR_INVALID_PARAM;
+    }
+    /* An empty source product description infoframe: type 0x83, version 1, length 25 */
+    memset(data, 0, 4 + 25);
+    data[0] = 0x83;
+    data[1] = 0x01;
+    data[2] = 25;
+    return dsERR_NONE;
+}
+
+/* dsFPD */
+
+dsError_t dsFPInit()
+{
+    SIM_ENTER();
+    moduleInit();
+    return dsERR_NONE;
+}
+
+dsError_t dsFPTerm()
+{
+    SIM_ENTER();
+    moduleTerm();
+    return dsERR_NONE;
+}
+
+dsError_t dsSetFPBrightness(dsFPDIndicator_t indicator, dsFPDBrightness_t brightness)
+{
+    SIM_ENTER();
+    if ((indicator < 0) || (indicator >= dsFPD_INDICATOR_MAX) || (brightness > 100)) {
+        return dsERR_INVALID_PARAM;
+    }
+    lock_guard<mutex> lock(simLock);
+    model.fpBrightness[indicator] = brightness;
+    return dsERR_NONE;
+}
+
+dsError_t dsGetFPBrightness(dsFPDIndicator_t indicator, dsFPDBrightness_t *brightness)
+{
+    SIM_ENTER();
+    if ((indicator < 0) || (indicator >= dsFPD_INDICATOR_MAX) || (NULL == brightness)) {
+        return dsERR_INVALID_PARAM;
+    }
+    lock_guard<mutex> lock(simLock);
+    *brightness = model.fpBrightness[indicator];
+    return dsERR_NONE;
+}
+
+dsError_t dsSetFPState(dsFPDIndicator_t indicator, dsFPDState_t state)
+{
+    SIM_ENTER();
+    if ((indicator < 0) || (indicator >= dsFPD_INDICATOR_MAX)) {
+        return dsERR_INVALID_PARAM;
+    }
+    lock_guard<mutex> lock(simLock);
+    model.fpState[indicator] = state;
+    return dsERR_NONE;
+}
+
+dsError_t dsGetFPState(dsFPDIndicator_t indicator, dsFPDState_t *state)
+{
+    SIM_ENTER();
+    if ((indicator < 0) || (indicator >= dsFPD_INDICATOR_MAX) || (NULL == state)) {
+        return dsERR_INVALID_PARAM;
+    }
+    lock_guard<mutex> lock(simLock);
+    *state = model.fpState[indicator];
+    return dsERR_NONE;
+}
+
+dsError_t dsSetFPColor(dsFPDIndicator_t indicator, dsFPDColor_t color)
+{
+    SIM_ENTER();
+    if ((indicator < 0) || (indicator >= dsFPD_INDICATOR_MAX)) {
+        return dsERR_INVALID_PARAM;
+    }
+    lock_guard<mutex> lock(simLock);
+    model.fpColor[indicator] = color;
+    return dsERR_NONE;
+}
+
+dsError_t dsGetFPColor(dsFPDIndicator_t indicator, dsFPDColor_t *color)
+{
+    SIM_ENTER();
+    if ((indicator < 0) || (indicator >= dsFPD_INDICATOR_MAX) || (NULL == color)) {
+        return dsERR_INVALID_PARAM;
+    }
+    lock_guard<mutex> lock(simLock);
+    *color = model.fpColor[indicator];
+    return dsERR_NONE;
+}
+
+dsError_t dsSetFPText(const char *text)
+{
+    SIM_ENTER();
+    if (NULL == text) {
+        return dsERR_INVALID_PARAM;
+    }
+    lock_guard<mutex> lock(simLock);
+    model.fpText = text;
+    return dsERR_NONE;
+}
+
+dsError_t dsSetFPTime(dsFPDTimeFormat_t timeFormat, const unsigned int hours, const unsigned int minutes)
+{
+    SIM_ENTER();
+    if ((hours > 23) || (minutes > 59)) {
+        return dsERR_INVALID_PARAM;
+    }
+    char text[8];
+    snprintf(text, sizeof(text), "%02u:%02u", hours, minutes);
+    lock_guard<mutex> lock(simLock);
+    model.fpText = text;
+    return dsERR_NONE;
+}
+
+}
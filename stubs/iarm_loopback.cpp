@@ -0,0 +1,280 @@
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <map>
+#include <string>
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <condition_variable>
+#include "libIBus.h"
+#include "libIARMCore.h"
+#include "libIBusDaemon.h"
+#include "iarm_loopback.h"
+
+using namespace std;
+
+namespace {
+
+struct Event {
+    string owner;
+    IARM_EventId_t eventId;
+    vector<char> data;
+};
+
+typedef pair<string, IARM_EventId_t> EventKey;
+
+mutex callLock;
+map<string, IARM_BusCall_t> calls;
+atomic<unsigned int> callLatencyUs(0);
+atomic<unsigned long> callCount(0);
+
+mutex eventLock;
+condition_variable eventCond;
+condition_variable idleCond;
+map<EventKey, vector<IARM_EventHandler_t> > eventHandlers;
+deque<Event> eventQueue;
+bool delivering = false;
+bool dispatcherRunning = false;
+thread dispatcher;
+
+void dispatchEvents()
+{
+    unique_lock<mutex> lock(eventLock);
+    while (true) {
+        eventCond.wait(lock, [] { return !eventQueue.empty() || !dispatcherRunning; });
+        if (eventQueue.empty()) {
+            break;
+        }
+        Event event = std::move(eventQueue.front());
+        eventQueue.pop_front();
+        vector<IARM_EventHandler_t> handlers = eventHandlers[EventKey(event.owner, event.eventId)];
+        delivering = true;
+
+        /* Handlers may broadcast or register themselves, call them unlocked */
+        lock.unlock();
+        for (size_t i = 0; i < handlers.size(); i++) {
+            handlers[i](event.owner.c_str(), event.eventId, event.data.empty() ? NULL : &event.data[0], event.data.size());
+        }
+        lock.lock();
+
+        delivering = false;
+        if (eventQueue.empty()) {
+            idleCond.notify_all();
+        }
+    }
+    idleCond.notify_all();
+}
+
+/* Called with eventLock held */
+void startDispatcher()
+{
+    if (!dispatcherRunning) {
+        dispatcherRunning = true;
+        dispatcher = thread(dispatchEvents);
+    }
+}
+
+/* A process that never calls IARM_Bus_Term() would exit with a joinable
+ * dispatcher, which ends in std::terminate. Defined after the objects the
+ * dispatcher uses, so it is destroyed before them. */
+struct DispatcherReaper {
+    ~DispatcherReaper()
+    {
+        IARM_Bus_Term();
+    }
+} dispatcherReaper;
+
+}
+
+void IARM_Loopback_SetCallLatency(unsigned int usec)
+{
+    callLatencyUs = usec;
+}
+
+void IARM_Loopback_FlushEvents(void)
+{
+    unique_lock<mutex> lock(eventLock);
+    idleCond.wait(lock, [] { return (eventQueue.empty() && !delivering) || !dispatcherRunning; });
+}
+
+unsigned long IARM_Loopback_CallCount(void)
+{
+    return callCount;
+}
+
+IARM_Result_t IARM_Malloc(IARM_MemType_t type, size_t size, void **ptr)
+{
+    if (NULL == ptr) {
+        return IARM_RESULT_INVALID_PARAM;
+    }
+    *ptr = malloc(size);
+    return (*ptr || (0 == size)) ? IARM_RESULT_SUCCESS : IARM_RESULT_OOM;
+}
+
+IARM_Result_t IARM_Free(IARM_MemType_t type, void *alloc)
+{
+    free(alloc);
+    return IARM_RESULT_SUCCESS;
+}
+
+IARM_Result_t IARM_Bus_Init(const char* name)
+{
+    const char *latency = getenv("IARM_LOOPBACK_CALL_LATENCY_US");
+    if (latency) {
+        callLatencyUs = (unsigned int)atoi(latency);
+    }
+    return IARM_RESULT_SUCCESS;
+}
+
+IARM_Result_t IARM_Bus_Connect()
+{
+    lock_guard<mutex> lock(eventLock);
+    startDispatcher();
+    return IARM_RESULT_SUCCESS;
+}
+
+IARM_Result_t IARM_Bus_IsConnected(const char* memberName, int* isRegistered)
+{
+    if (isRegistered) {
+        *isRegistered = 1;
+    }
+    return IARM_RESULT_SUCCESS;
+}
+
+IARM_Result_t IARM_Bus_Disconnect(void)
+{
+    return IARM_RESULT_SUCCESS;
+}
+
+IARM_Result_t IARM_Bus_Term(void)
+{
+    {
+        lock_guard<mutex> lock(eventLock);
+        if (!dispatcherRunning) {
+            return IARM_RESULT_SUCCESS;
+        }
+        dispatcherRunning = false;
+        eventCond.notify_all();
+    }
+    /* The dispatcher delivers what is queued before it exits */
+    dispatcher.join();
+    return IARM_RESULT_SUCCESS;
+}
+
+IARM_Result_t IARM_Bus_RegisterEvent(IARM_EventId_t maxEventId)
+{
+    return IARM_RESULT_SUCCESS;
+}
+
+IARM_Result_t IARM_Bus_RegisterEventHandler(const char* ownerName, IARM_EventId_t eventId, IARM_EventHandler_t handler)
+{
+    if ((NULL == ownerName) || (NULL == handler)) {
+        return IARM_RESULT_INVALID_PARAM;
+    }
+    lock_guard<mutex> lock(eventLock);
+    eventHandlers[EventKey(ownerName, eventId)].push_back(handler);
+    return IARM_RESULT_SUCCESS;
+}
+
+IARM_Result_t IARM_Bus_UnRegisterEventHandler(const char* ownerName, IARM_EventId_t eventId)
+{
+    if (NULL == ownerName) {
+        return IARM_RESULT_INVALID_PARAM;
+    }
+    lock_guard<mutex> lock(eventLock);
+    eventHandlers.erase(EventKey(ownerName, eventId));
+    return IARM_RESULT_SUCCESS;
+}
+
+IARM_Result_t IARM_Bus_RemoveEventHandler(const char* ownerName, IARM_EventId_t eventId, IARM_EventHandler_t handler)
+{
+    if (NULL == ownerName) {
+        return IARM_RESULT_INVALID_PARAM;
+    }
+    lock_guard<mutex> lock(eventLock);
+    vector<IARM_EventHandler_t> &handlers = eventHandlers[EventKey(ownerName, eventId)];
+    for (vector<IARM_EventHandler_t>::iterator it = handlers.begin(); it != handlers.end(); ++it) {
+        if (*it == handler) {
+            handlers.erase(it);
+            return IARM_RESULT_SUCCESS;
+        }
+    }
+    return IARM_RESULT_INVALID_PARAM;
+}
+
+IARM_Result_t IARM_Bus_BroadcastEvent(const char *ownerName, IARM_EventId_t eventId, void *arg, size_t argLen)
+{
+    if (NULL == ownerName) {
+        return IARM_RESULT_INVALID_PARAM;
+    }
+    Event event;
+    event.owner = ownerName;
+    event.eventId = eventId;
+    if (arg && argLen) {
+        event.data.assign((const char *)arg, (const char *)arg + argLen);
+    }
+
+    lock_guard<mutex> lock(eventLock);
+    startDispatcher();
+    eventQueue.push_back(std::move(event));
+    eventCond.notify_one();
+    return IARM_RESULT_SUCCESS;
+}
+
+/*
+ * Methods are looked up by name only: every bus member lives in this
+ * process, so the owner name adds nothing.
+ */
+IARM_Result_t IARM_Bus_RegisterCall(const char *methodName, IARM_BusCall_t handler)
+{
+    if ((NULL == methodName) || (NULL == handler)) {
+        return IARM_RESULT_INVALID_PARAM;
+    }
+    lock_guard<mutex> lock(callLock);
+    calls[methodName] = handler;
+    return IARM_RESULT_SUCCESS;
+}
+
+IARM_Result_t IARM_Bus_Call(const char* ownerName, const char* methodName, void* arg, size_t argLen)
+{
+    IARM_BusCall_t handler = NULL;
+
+    if (NULL == methodName) {
+        return IARM_RESULT_INVALID_PARAM;
+    }
+    {
+        lock_guard<mutex> lock(callLock);
+        map<string, IARM_BusCall_t>::const_iterator it = calls.find(methodName);
+        if (it != calls.end()) {
+            handler = it->second;
+        }
+    }
+    if (NULL == handler) {
+        return IARM_RESULT_INVALID_STATE;
+    }
+
+    unsigned int latency = callLatencyUs;
+    if (latency) {
+        usleep(latency);
+    }
+
+    /* The handler works on its own copy of the argument, as over the real bus */
+    vector<char> copy;
+    if (arg && argLen) {
+        copy.assign((const char *)arg, (const char *)arg + argLen);
+    }
+    IARM_Result_t ret = handler(copy.empty() ? NULL : &copy[0]);
+    if (!copy.empty()) {
+        memcpy(arg, &copy[0], argLen);
+    }
+    callCount++;
+    return ret;
+}
+
+IARM_Result_t IARM_BusDaemon_PowerPrechange(IARM_Bus_CommonAPI_PowerPreChange_Param_t preChangeParam)
+{
+    return IARM_RESULT_SUCCESS;
+}
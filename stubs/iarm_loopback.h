@@ -0,0 +1,55 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2025 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/*
+ * In-process loopback implementation of the IARM bus (iarm_loopback.cpp).
+ *
+ * Linked instead of iarm_stubs.cpp, IARM_Bus_Call() runs the handler that
+ * was registered with IARM_Bus_RegisterCall() in the same process, on the
+ * calling thread, with the argument copied in and out as the real bus does.
+ * IARM_Bus_BroadcastEvent() copies the event data and queues it for a
+ * dispatcher thread that calls the handlers registered for the owner and
+ * event id, in broadcast order. This lets rpc/cli talk to rpc/srv and the
+ * libds API run end to end on a plain Linux box.
+ *
+ * IARM_LOOPBACK_CALL_LATENCY_US in the environment, read by IARM_Bus_Init(),
+ * delays every call by that many microseconds to model the IPC round trip.
+ */
+
+#ifndef _IARM_LOOPBACK_H_
+#define _IARM_LOOPBACK_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Delay every IARM_Bus_Call() by usec microseconds, 0 to disable. */
+void IARM_Loopback_SetCallLatency(unsigned int usec);
+
+/** @brief Wait until every event broadcast so far was delivered to its handlers. */
+void IARM_Loopback_FlushEvents(void);
+
+/** @brief Number of IARM_Bus_Call() dispatched to a handler since start. */
+unsigned long IARM_Loopback_CallCount(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _IARM_LOOPBACK_H_ */
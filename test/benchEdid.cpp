@@ -0,0 +1,116 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2016 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+
+/**
+* @defgroup devicesettings
+* @{
+* @defgroup test
+* @{
+**/
+
+
+/*
+ * Measures edid_parser throughput in parses/sec for every EDID given on the
+ * command line (default: the valid samples of edid_corpus/). Logging is
+ * limited to errors while measuring so the debug traces of the parser do not
+ * dominate. Run it before and after parser changes to compare.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "dslogger.h"
+#include "edid-parser.hpp"
+
+using namespace edid_parser;
+
+static const int kIterations = 200000;
+
+static const char *kDefaultCorpus[] = {
+    "edid_corpus/dvi_monitor_1080p.bin",
+    "edid_corpus/hdmi14_tv_1080p.bin",
+    "edid_corpus/hdmi20_tv_4k_hdr.bin",
+    "edid_corpus/hdmi21_tv_eeodb_3ext.bin",
+    "edid_corpus/avr_blockmap_cta_displayid.bin",
+};
+
+template <typename F>
+static double parsesPerSec(F&& fn)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kIterations; i++) {
+        fn();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return kIterations / std::chrono::duration<double>(end - start).count();
+}
+
+static bool load(const char *path, std::vector<uint8_t> &bytes)
+{
+    FILE *file = fopen(path, "rb");
+    if (NULL == file) {
+        return false;
+    }
+    bytes.resize(1024);
+    bytes.resize(fread(bytes.data(), 1, bytes.size(), file));
+    fclose(file);
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    std::vector<const char *> paths;
+    for (int i = 1; i < argc; i++) {
+        paths.push_back(argv[i]);
+    }
+    if (paths.empty()) {
+        paths.assign(kDefaultCorpus, kDefaultCorpus + sizeof(kDefaultCorpus) / sizeof(kDefaultCorpus[0]));
+    }
+
+    DS_SetLogLevel(ERROR_LEVEL);
+
+    printf("edid_parser throughput over %d parses\n", kIterations);
+    printf("  %-32s %6s %14s\n", "EDID", "bytes", "parse/s");
+    for (const char *path : paths) {
+        std::vector<uint8_t> bytes;
+        if (!load(path, bytes)) {
+            printf("  %-32s cannot read\n", path);
+            continue;
+        }
+        const char *name = strrchr(path, '/') ? strrchr(path, '/') + 1 : path;
+        edid_span_t span = { bytes.data(), bytes.size() };
+        edid_data_t data;
+
+        if (EDID_Parse(span, &data) != EDID_STATUS_OK) {
+            printf("  %-32s %6zu %14s\n", name, bytes.size(), "invalid");
+            continue;
+        }
+        double parse = parsesPerSec([&] { EDID_Parse(span, &data); });
+        printf("  %-32s %6zu %14.0f\n", name, bytes.size(), parse);
+    }
+    return 0;
+}
+
+
+/** @} */
+/** @} */
@@ -0,0 +1,142 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2016 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+
+/**
+* @defgroup devicesettings
+* @{
+* @defgroup test
+* @{
+**/
+
+
+/*
+ * Fuzz target for edid_parser::EDID_Verify() and EDID_Parse().
+ *
+ * Built with -fsanitize=fuzzer (make fuzzEdid) this is a libFuzzer target
+ * seeded from edid_corpus/. Built without it (make fuzzEdidReplay) main()
+ * runs every file given on the command line, or stdin when there is none,
+ * through the same entry point; that binary is what afl-fuzz drives with
+ * "@@" and what replays the checked in corpus as a regression test.
+ *
+ * Besides the sanitizers catching out of bounds reads, the parse result is
+ * checked for invariants that callers rely on.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "edid-parser.hpp"
+
+using namespace edid_parser;
+
+#define FUZZ_CHECK(cond)                                                        \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            fprintf(stderr, "fuzzEdid: invariant failed: %s\n", #cond);         \
+            abort();                                                            \
+        }                                                                       \
+    } while (0)
+
+static void checkInvariants(const edid_data_t &data)
+{
+    FUZZ_CHECK(memchr(data.manufacturer_name, '\0', sizeof(data.manufacturer_name)) != NULL);
+    FUZZ_CHECK(memchr(data.monitor_name, '\0', sizeof(data.monitor_name)) != NULL);
+    FUZZ_CHECK(data.svd_count <= EDID_MAX_SVD);
+    for (int i = 0; i < data.svd_count; i++) {
+        // reserved codes keep their slot as VIC 0
+        FUZZ_CHECK((data.svd[i] != 128) && (data.svd[i] < 254));
+    }
+    FUZZ_CHECK(data.hf_vsdb.max_frl_rate <= 15);
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *bytes, size_t size)
+{
+    edid_span_t span = { bytes, size };
+    edid_data_t data;
+
+    edid_status_e verified = EDID_Verify(span);
+
+    memset(&data, 0, sizeof(data));
+    edid_status_e parsed = EDID_Parse(span, &data);
+    if (EDID_STATUS_OK == parsed) {
+        checkInvariants(data);
+    }
+
+    /* The legacy pointer entry points take a mutable buffer and must agree */
+    std::vector<unsigned char> copy(bytes, bytes + size);
+    edid_data_t legacy;
+    memset(&legacy, 0, sizeof(legacy));
+    FUZZ_CHECK(EDID_Verify(copy.data(), copy.size()) == verified);
+    FUZZ_CHECK(EDID_Parse(copy.data(), copy.size(), &legacy) == parsed);
+    FUZZ_CHECK(memcmp(&legacy, &data, sizeof(data)) == 0);
+    return 0;
+}
+
+#ifndef DS_FUZZ_LIBFUZZER
+
+static bool readAll(FILE *file, std::vector<uint8_t> &bytes)
+{
+    uint8_t buf[4096];
+    size_t n;
+
+    bytes.clear();
+    while ((n = fread(buf, 1, sizeof(buf), file)) > 0) {
+        bytes.insert(bytes.end(), buf, buf + n);
+    }
+    return !ferror(file);
+}
+
+int main(int argc, char *argv[])
+{
+    std::vector<uint8_t> bytes;
+
+    if (argc < 2) {
+        if (!readAll(stdin, bytes)) {
+            return 1;
+        }
+        return LLVMFuzzerTestOneInput(bytes.data(), bytes.size());
+    }
+
+    for (int i = 1; i < argc; i++) {
+        FILE *file = fopen(argv[i], "rb");
+        if (NULL == file) {
+            fprintf(stderr, "fuzzEdid: cannot open %s\n", argv[i]);
+            return 1;
+        }
+        bool ok = readAll(file, bytes);
+        fclose(file);
+        if (!ok) {
+            fprintf(stderr, "fuzzEdid: cannot read %s\n", argv[i]);
+            return 1;
+        }
+        LLVMFuzzerTestOneInput(bytes.data(), bytes.size());
+    }
+    printf("fuzzEdid: %d inputs OK\n", argc - 1);
+    return 0;
+}
+
+#endif /* DS_FUZZ_LIBFUZZER */
+
+
+/** @} */
+/** @} */
@@ -0,0 +1,137 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2025 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+
+/**
+* @defgroup devicesettings
+* @{
+* @defgroup test
+* @{
+**/
+
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <vector>
+#include "libIBus.h"
+#include "iarm_loopback.h"
+
+/*
+ * Checks of the loopback IARM bus (stubs/iarm_loopback.cpp): calls reach the
+ * registered handler with a copy of the argument, events reach their
+ * handlers in order on the dispatcher thread, and call latency is injected.
+ */
+
+#define OWNER   "LoopbackTest"
+
+static int failures = 0;
+
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            printf("FAILED %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+            failures++; \
+        } \
+    } while (0)
+
+typedef struct {
+    int in;
+    int out;
+} EchoParam;
+
+static IARM_Result_t echo(void *arg)
+{
+    EchoParam *param = (EchoParam *)arg;
+    param->out = param->in * 2;
+    return IARM_RESULT_SUCCESS;
+}
+
+static std::vector<int> received;
+static pthread_t mainThread;
+static bool deliveredOnMainThread = false;
+
+static void onEvent(const char *owner, IARM_EventId_t eventId, void *data, size_t len)
+{
+    if (pthread_equal(pthread_self(), mainThread)) {
+        deliveredOnMainThread = true;
+    }
+    if ((0 == strcmp(owner, OWNER)) && (sizeof(int) == len)) {
+        received.push_back(*(int *)data);
+    }
+}
+
+static double nowUs()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+int main()
+{
+    mainThread = pthread_self();
+    IARM_Bus_Init(OWNER);
+    IARM_Bus_Connect();
+
+    /* Calls */
+    EchoParam param = { 21, 0 };
+    CHECK(IARM_RESULT_SUCCESS != IARM_Bus_Call(OWNER, "echo", &param, sizeof(param)));
+    IARM_Bus_RegisterCall("echo", echo);
+    CHECK(IARM_RESULT_SUCCESS == IARM_Bus_Call(OWNER, "echo", &param, sizeof(param)));
+    CHECK(42 == param.out);
+    CHECK(1 == IARM_Loopback_CallCount());
+
+    /* Events, in order and off the broadcasting thread */
+    IARM_Bus_RegisterEventHandler(OWNER, 1, onEvent);
+    for (int i = 0; i < 100; i++) {
+        IARM_Bus_BroadcastEvent(OWNER, 1, &i, sizeof(i));
+    }
+    IARM_Bus_BroadcastEvent(OWNER, 2, &param, sizeof(int));
+    IARM_Loopback_FlushEvents();
+    CHECK(100 == received.size());
+    for (size_t i = 0; i < received.size(); i++) {
+        CHECK((int)i == received[i]);
+    }
+    CHECK(!deliveredOnMainThread);
+
+    IARM_Bus_RemoveEventHandler(OWNER, 1, onEvent);
+    IARM_Bus_BroadcastEvent(OWNER, 1, &param, sizeof(int));
+    IARM_Loopback_FlushEvents();
+    CHECK(100 == received.size());
+
+    /* Injected latency */
+    IARM_Loopback_SetCallLatency(2000);
+    double start = nowUs();
+    for (int i = 0; i < 5; i++) {
+        IARM_Bus_Call(OWNER, "echo", &param, sizeof(param));
+    }
+    CHECK(nowUs() - start >= 5 * 2000);
+    IARM_Loopback_SetCallLatency(0);
+
+    IARM_Bus_Disconnect();
+    IARM_Bus_Term();
+
+    printf("%s\n", failures ? "testIarmLoopback FAILED" : "testIarmLoopback passed");
+    return failures ? 1 : 0;
+}
+
+
+/** @} */
+/** @} */